@@ -51,6 +51,15 @@ TOOLCHAIN=GCC_ARM
 # launch configurations for your IDE.
 CONFIG=Debug
 
+# Batched secure service interface (see docs/design_and_implementation.md).
+# 1 -- The CM33 secure project exports secure_batch_call() and
+#      secure_service_call() as non-secure callable functions and writes the
+#      import library linked by the CM33 non-secure project. Requires
+#      TOOLCHAIN=GCC_ARM and the m33s_nsc region of design.modus.
+# 0 -- Not built.
+SECURE_BATCH?=0
+SECURE_BATCH_IMPLIB=../proj_cm33_s/build/secure_batch_cmse_lib.o
+
 # Config file for postbuild sign and merge operations.
 # NOTE: Check the JSON file for the command parameters
 COMBINE_SIGN_JSON?=configs/boot_with_extended_boot.json
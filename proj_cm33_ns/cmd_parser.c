@@ -0,0 +1,603 @@
+/*******************************************************************************
+ * File Name:   cmd_parser.c
+ *
+ * Description: This file contains the parser of the line protocol used to
+ *              change the runtime parameters over the debug UART, and the
+ *              codec of the parameters kept in retained memory. It has no
+ *              device dependencies and does not allocate memory.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "cmd_parser.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CMD_MAX_TOKENS                  (3U)
+#define CMD_MAX_VALUE                   (0xFFFFUL)
+
+#define CMD_ASCII_BACKSPACE             (0x08U)
+#define CMD_ASCII_DELETE                (0x7FU)
+#define CMD_ASCII_FIRST_PRINTABLE       (0x20U)
+
+/* Word 1: magic, power mode and wake level */
+#define CMD_PARAMS_MAGIC                (0xC5UL)
+#define CMD_PARAMS_MAGIC_POS            (24U)
+#define CMD_PARAMS_POWER_POS            (8U)
+#define CMD_PARAMS_HOLD_POS             (16U)
+#define CMD_PARAMS_BYTE_MSK             (0xFFUL)
+#define CMD_PARAMS_HALF_MSK             (0xFFFFUL)
+
+/* Word 2 is the complement of the XOR of words 0 and 1 */
+#define CMD_PARAMS_CHECK(w0, w1)        (~((w0) ^ (w1)))
+
+#define CMD_ARRAY_SIZE(a)               (sizeof(a) / sizeof((a)[0]))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Indexed by cmd_op_t */
+static const char *const op_names[] =
+{
+    "get", "set", "defaults", "stat", "help"
+};
+
+/* Indexed by cmd_param_t */
+static const char *const param_names[] =
+{
+    "period", "hold", "power", "wake"
+};
+
+/* Indexed by cmd_power_t */
+static const char *const power_names[] =
+{
+    "ulp", "lp", "normal"
+};
+
+/* Indexed by cmd_wake_t */
+static const char *const wake_names[] =
+{
+    "high", "low"
+};
+
+/* Indexed by cmd_status_t */
+static const char *const status_names[] =
+{
+    "ok", "empty", "unknown", "arg", "range", "overflow"
+};
+
+/*******************************************************************************
+* Function Name: cmd_lookup
+********************************************************************************
+* Summary:
+* Finds a token in a table of names.
+*
+* Parameters:
+*  token: Token to look up
+*  names: Table of names
+*  num_names: Number of entries in the table
+*  index: Index of the matching entry
+*
+* Return:
+*  bool: true if the token was found
+*
+*******************************************************************************/
+static bool cmd_lookup(const char *token, const char *const names[],
+                       uint32_t num_names, uint32_t *index)
+{
+    for (uint32_t i = 0U; i < num_names; i++)
+    {
+        if (0 == strcmp(token, names[i]))
+        {
+            *index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: cmd_parse_number
+********************************************************************************
+* Summary:
+* Converts a decimal token of at most CMD_MAX_VALUE.
+*
+* Parameters:
+*  token: Token to convert
+*  value: Converted value
+*
+* Return:
+*  cmd_status_t: CMD_ERR_ARG if the token is not a number, CMD_ERR_RANGE if
+*  it is too large
+*
+*******************************************************************************/
+static cmd_status_t cmd_parse_number(const char *token, uint32_t *value)
+{
+    uint32_t result = 0U;
+
+    for (const char *c = token; '\0' != *c; c++)
+    {
+        if ((*c < '0') || (*c > '9'))
+        {
+            return CMD_ERR_ARG;
+        }
+
+        result = (result * 10U) + (uint32_t)(*c - '0');
+        if (result > CMD_MAX_VALUE)
+        {
+            return CMD_ERR_RANGE;
+        }
+    }
+
+    *value = result;
+
+    return CMD_OK;
+}
+
+/*******************************************************************************
+* Function Name: cmd_params_valid
+********************************************************************************
+* Summary:
+* Checks that all parameters are in range.
+*
+* Parameters:
+*  params: Parameters to check
+*
+* Return:
+*  bool: true if the parameters can be used
+*
+*******************************************************************************/
+static bool cmd_params_valid(const cmd_params_t *params)
+{
+    return (params->period_ms >= CMD_MIN_DURATION_MS) &&
+           (params->period_ms <= CMD_MAX_DURATION_MS) &&
+           (params->hold_ms >= CMD_MIN_DURATION_MS) &&
+           (params->hold_ms <= CMD_MAX_DURATION_MS) &&
+           (params->power < (uint8_t)CMD_NUM_POWER_MODES) &&
+           (params->wake < (uint8_t)CMD_NUM_WAKE_LEVELS);
+}
+
+/*******************************************************************************
+* Function Name: cmd_line_reset
+********************************************************************************
+* Summary:
+* Empties a line.
+*
+* Parameters:
+*  line: Line to reset
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_line_reset(cmd_line_t *line)
+{
+    line->len = 0U;
+    line->overflow = false;
+    line->buf[0] = '\0';
+}
+
+/*******************************************************************************
+* Function Name: cmd_line_feed
+********************************************************************************
+* Summary:
+* Adds a received byte to a line. Letters are converted to lower case,
+* backspace removes the last character, and other control characters are
+* dropped, so the protocol can be typed on a terminal. CR or LF ends a
+* line, and blank lines are ignored so that CR LF counts once. Runs in
+* interrupt context.
+*
+* Parameters:
+*  line: Line being received
+*  byte: Received byte
+*
+* Return:
+*  cmd_line_status_t: CMD_LINE_READY when a line is complete. The text in
+*  line->buf is valid until the next call.
+*
+*******************************************************************************/
+cmd_line_status_t cmd_line_feed(cmd_line_t *line, uint8_t byte)
+{
+    if (('\r' == byte) || ('\n' == byte))
+    {
+        if (line->overflow)
+        {
+            cmd_line_reset(line);
+            return CMD_LINE_OVERFLOW;
+        }
+
+        if (0U == line->len)
+        {
+            return CMD_LINE_PENDING;
+        }
+
+        line->buf[line->len] = '\0';
+        line->len = 0U;
+        return CMD_LINE_READY;
+    }
+
+    if ((CMD_ASCII_BACKSPACE == byte) || (CMD_ASCII_DELETE == byte))
+    {
+        if ((0U != line->len) && !line->overflow)
+        {
+            line->len--;
+        }
+        return CMD_LINE_PENDING;
+    }
+
+    if ('\t' == byte)
+    {
+        byte = (uint8_t)' ';
+    }
+
+    if ((byte < CMD_ASCII_FIRST_PRINTABLE) || (byte > (uint8_t)'~'))
+    {
+        return CMD_LINE_PENDING;
+    }
+
+    if (line->len >= CMD_LINE_MAX)
+    {
+        line->overflow = true;
+        return CMD_LINE_PENDING;
+    }
+
+    if ((byte >= (uint8_t)'A') && (byte <= (uint8_t)'Z'))
+    {
+        byte += (uint8_t)('a' - 'A');
+    }
+
+    line->buf[line->len++] = (char)byte;
+
+    return CMD_LINE_PENDING;
+}
+
+/*******************************************************************************
+* Function Name: cmd_parse
+********************************************************************************
+* Summary:
+* Parses a command line. The commands are:
+*
+*  get                     Report the parameters
+*  set period <ms>         LED toggle period while the input is active
+*  set hold <ms>           LED on time before Hibernate
+*  set power ulp|lp|normal Comparator power mode
+*  set wake high|low       Comparator output level that keeps the device
+*                          active
+*  defaults                Restore the built-in parameters
+*  stat                    Report a telemetry snapshot
+*  help                    List the commands
+*
+* Tokens are separated by one or more spaces. Range checks of the values
+* are done by cmd_params_apply().
+*
+* Parameters:
+*  text: NUL-terminated line in lower case, at most CMD_LINE_MAX characters
+*  cmd: Parsed command
+*
+* Return:
+*  cmd_status_t: CMD_OK if cmd is valid
+*
+*******************************************************************************/
+cmd_status_t cmd_parse(const char *text, cmd_t *cmd)
+{
+    char buf[CMD_LINE_MAX + 1U];
+    char *tokens[CMD_MAX_TOKENS];
+    uint32_t num_tokens = 0U;
+    uint32_t index;
+    size_t len = strlen(text);
+
+    if (len > CMD_LINE_MAX)
+    {
+        return CMD_ERR_OVERFLOW;
+    }
+
+    /* Split a copy of the line at the spaces */
+    memcpy(buf, text, len + 1U);
+    for (char *c = buf; '\0' != *c; )
+    {
+        if (' ' == *c)
+        {
+            *c++ = '\0';
+            continue;
+        }
+
+        if (num_tokens >= CMD_MAX_TOKENS)
+        {
+            return CMD_ERR_ARG;
+        }
+        tokens[num_tokens++] = c;
+
+        while (('\0' != *c) && (' ' != *c))
+        {
+            c++;
+        }
+    }
+
+    if (0U == num_tokens)
+    {
+        return CMD_ERR_EMPTY;
+    }
+
+    if (!cmd_lookup(tokens[0], op_names, CMD_ARRAY_SIZE(op_names), &index))
+    {
+        return CMD_ERR_UNKNOWN;
+    }
+
+    cmd->op = (uint8_t)index;
+    cmd->param = 0U;
+    cmd->value = 0U;
+
+    if ((uint8_t)CMD_OP_SET != cmd->op)
+    {
+        return (1U == num_tokens) ? CMD_OK : CMD_ERR_ARG;
+    }
+
+    if (3U != num_tokens)
+    {
+        return CMD_ERR_ARG;
+    }
+
+    if (!cmd_lookup(tokens[1], param_names, CMD_ARRAY_SIZE(param_names), &index))
+    {
+        return CMD_ERR_UNKNOWN;
+    }
+    cmd->param = (uint8_t)index;
+
+    switch ((cmd_param_t)cmd->param)
+    {
+        case CMD_PARAM_POWER:
+            return cmd_lookup(tokens[2], power_names, CMD_ARRAY_SIZE(power_names),
+                              &cmd->value) ? CMD_OK : CMD_ERR_ARG;
+
+        case CMD_PARAM_WAKE:
+            return cmd_lookup(tokens[2], wake_names, CMD_ARRAY_SIZE(wake_names),
+                              &cmd->value) ? CMD_OK : CMD_ERR_ARG;
+
+        case CMD_PARAM_PERIOD:
+        case CMD_PARAM_HOLD:
+        default:
+            return cmd_parse_number(tokens[2], &cmd->value);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cmd_params_default
+********************************************************************************
+* Summary:
+* Loads the built-in parameters.
+*
+* Parameters:
+*  params: Parameters to initialize
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_params_default(cmd_params_t *params)
+{
+    params->period_ms = (uint16_t)CMD_DEFAULT_PERIOD_MS;
+    params->hold_ms = (uint16_t)CMD_DEFAULT_HOLD_MS;
+    params->power = (uint8_t)CMD_POWER_ULP;
+    params->wake = (uint8_t)CMD_WAKE_HIGH;
+}
+
+/*******************************************************************************
+* Function Name: cmd_params_apply
+********************************************************************************
+* Summary:
+* Applies a parsed command to the parameters. The parameters are left
+* unchanged if a value is out of range.
+*
+* Parameters:
+*  params: Parameters to update
+*  cmd: Parsed command
+*
+* Return:
+*  cmd_status_t: CMD_OK, or CMD_ERR_RANGE
+*
+*******************************************************************************/
+cmd_status_t cmd_params_apply(cmd_params_t *params, const cmd_t *cmd)
+{
+    cmd_params_t updated = *params;
+
+    if ((uint8_t)CMD_OP_DEFAULTS == cmd->op)
+    {
+        cmd_params_default(params);
+        return CMD_OK;
+    }
+
+    if ((uint8_t)CMD_OP_SET != cmd->op)
+    {
+        return CMD_OK;
+    }
+
+    if (cmd->value > CMD_MAX_VALUE)
+    {
+        return CMD_ERR_RANGE;
+    }
+
+    switch ((cmd_param_t)cmd->param)
+    {
+        case CMD_PARAM_PERIOD:
+            updated.period_ms = (uint16_t)cmd->value;
+            break;
+
+        case CMD_PARAM_HOLD:
+            updated.hold_ms = (uint16_t)cmd->value;
+            break;
+
+        case CMD_PARAM_POWER:
+            updated.power = (uint8_t)cmd->value;
+            break;
+
+        case CMD_PARAM_WAKE:
+            updated.wake = (uint8_t)cmd->value;
+            break;
+
+        default:
+            return CMD_ERR_UNKNOWN;
+    }
+
+    if (!cmd_params_valid(&updated))
+    {
+        return CMD_ERR_RANGE;
+    }
+
+    *params = updated;
+
+    return CMD_OK;
+}
+
+/*******************************************************************************
+* Function Name: cmd_params_encode
+********************************************************************************
+* Summary:
+* Packs the parameters into words for the backup registers.
+*
+* Parameters:
+*  params: Parameters to encode
+*  words: Encoded parameters
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_params_encode(const cmd_params_t *params,
+                       uint32_t words[CMD_PARAMS_NUM_WORDS])
+{
+    words[0] = (uint32_t)params->period_ms |
+               ((uint32_t)params->hold_ms << CMD_PARAMS_HOLD_POS);
+    words[1] = (CMD_PARAMS_MAGIC << CMD_PARAMS_MAGIC_POS) |
+               ((uint32_t)params->power << CMD_PARAMS_POWER_POS) |
+               (uint32_t)params->wake;
+    words[2] = CMD_PARAMS_CHECK(words[0], words[1]);
+}
+
+/*******************************************************************************
+* Function Name: cmd_params_decode
+********************************************************************************
+* Summary:
+* Unpacks the parameters read from the backup registers.
+*
+* Parameters:
+*  words: Encoded parameters
+*  params: Decoded parameters, unchanged if the words are not valid
+*
+* Return:
+*  bool: false if the words do not hold valid parameters
+*
+*******************************************************************************/
+bool cmd_params_decode(const uint32_t words[CMD_PARAMS_NUM_WORDS],
+                       cmd_params_t *params)
+{
+    cmd_params_t decoded;
+
+    if ((CMD_PARAMS_MAGIC != (words[1] >> CMD_PARAMS_MAGIC_POS)) ||
+        (CMD_PARAMS_CHECK(words[0], words[1]) != words[2]))
+    {
+        return false;
+    }
+
+    decoded.period_ms = (uint16_t)(words[0] & CMD_PARAMS_HALF_MSK);
+    decoded.hold_ms = (uint16_t)(words[0] >> CMD_PARAMS_HOLD_POS);
+    decoded.power = (uint8_t)((words[1] >> CMD_PARAMS_POWER_POS) & CMD_PARAMS_BYTE_MSK);
+    decoded.wake = (uint8_t)(words[1] & CMD_PARAMS_BYTE_MSK);
+
+    if (!cmd_params_valid(&decoded))
+    {
+        return false;
+    }
+
+    *params = decoded;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: cmd_status_name
+********************************************************************************
+* Summary:
+* Returns the name of a status used in replies.
+*
+* Parameters:
+*  status: Status
+*
+* Return:
+*  const char *: Name of the status
+*
+*******************************************************************************/
+const char *cmd_status_name(cmd_status_t status)
+{
+    return ((uint32_t)status < CMD_ARRAY_SIZE(status_names)) ?
+            status_names[status] : "?";
+}
+
+/*******************************************************************************
+* Function Name: cmd_power_name
+********************************************************************************
+* Summary:
+* Returns the name of a comparator power mode used in commands and replies.
+*
+* Parameters:
+*  power: cmd_power_t
+*
+* Return:
+*  const char *: Name of the power mode
+*
+*******************************************************************************/
+const char *cmd_power_name(uint8_t power)
+{
+    return (power < CMD_ARRAY_SIZE(power_names)) ? power_names[power] : "?";
+}
+
+/*******************************************************************************
+* Function Name: cmd_wake_name
+********************************************************************************
+* Summary:
+* Returns the name of a wake level used in commands and replies.
+*
+* Parameters:
+*  wake: cmd_wake_t
+*
+* Return:
+*  const char *: Name of the wake level
+*
+*******************************************************************************/
+const char *cmd_wake_name(uint8_t wake)
+{
+    return (wake < CMD_ARRAY_SIZE(wake_names)) ? wake_names[wake] : "?";
+}
+
+/* [] END OF FILE */
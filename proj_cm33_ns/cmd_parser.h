@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * File Name:   cmd_parser.h
+ *
+ * Description: This file is the public interface of cmd_parser.c and
+ *              contains the runtime parameters set over the debug UART.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _CMD_PARSER_H_
+#define _CMD_PARSER_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest command line, without the line terminator */
+#define CMD_LINE_MAX                    (32U)
+
+/* Size of the encoded parameters in the backup registers */
+#define CMD_PARAMS_NUM_WORDS            (3U)
+
+/* Parameter defaults, as built into the example */
+#define CMD_DEFAULT_PERIOD_MS           (500U)
+#define CMD_DEFAULT_HOLD_MS             (2000U)
+
+/* Range of the LED timing parameters. The upper limit is the longest step
+ * of an LED pattern (LED_PATTERN_DURATION_Msk in led_pattern.h). */
+#define CMD_MIN_DURATION_MS             (10U)
+#define CMD_MAX_DURATION_MS             (0x3FFFU)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Comparator power mode */
+typedef enum
+{
+    CMD_POWER_ULP               = 0,
+    CMD_POWER_LP                = 1,
+    CMD_POWER_NORMAL            = 2,
+    CMD_NUM_POWER_MODES         = 3
+} cmd_power_t;
+
+/* Comparator output level that keeps the device active. The device
+ * hibernates at the other level and wakes on the return to this one. */
+typedef enum
+{
+    CMD_WAKE_HIGH               = 0,
+    CMD_WAKE_LOW                = 1,
+    CMD_NUM_WAKE_LEVELS         = 2
+} cmd_wake_t;
+
+/* Runtime parameters */
+typedef struct
+{
+    uint16_t period_ms;                 /* LED toggle period while active */
+    uint16_t hold_ms;                   /* LED on time before Hibernate */
+    uint8_t  power;                     /* cmd_power_t */
+    uint8_t  wake;                      /* cmd_wake_t */
+} cmd_params_t;
+
+/* Command operation */
+typedef enum
+{
+    CMD_OP_GET                  = 0,    /* Report the parameters */
+    CMD_OP_SET                  = 1,    /* Change one parameter */
+    CMD_OP_DEFAULTS             = 2,    /* Restore the built-in parameters */
+    CMD_OP_STAT                 = 3,    /* Report a telemetry snapshot */
+    CMD_OP_HELP                 = 4     /* List the commands */
+} cmd_op_t;
+
+/* Parameter addressed by CMD_OP_SET */
+typedef enum
+{
+    CMD_PARAM_PERIOD            = 0,
+    CMD_PARAM_HOLD              = 1,
+    CMD_PARAM_POWER             = 2,
+    CMD_PARAM_WAKE              = 3
+} cmd_param_t;
+
+/* Parsed command */
+typedef struct
+{
+    uint8_t  op;                        /* cmd_op_t */
+    uint8_t  param;                     /* cmd_param_t, CMD_OP_SET only */
+    uint32_t value;                     /* CMD_OP_SET only */
+} cmd_t;
+
+/* Result of parsing or applying a command */
+typedef enum
+{
+    CMD_OK                      = 0,
+    CMD_ERR_EMPTY               = 1,    /* Blank line */
+    CMD_ERR_UNKNOWN             = 2,    /* Unknown command or parameter */
+    CMD_ERR_ARG                 = 3,    /* Missing, extra or malformed argument */
+    CMD_ERR_RANGE               = 4,    /* Value out of range */
+    CMD_ERR_OVERFLOW            = 5     /* Line longer than CMD_LINE_MAX */
+} cmd_status_t;
+
+/* Result of feeding a byte to a line */
+typedef enum
+{
+    CMD_LINE_PENDING            = 0,    /* Line not complete yet */
+    CMD_LINE_READY              = 1,    /* Line complete, see cmd_line_t.buf */
+    CMD_LINE_OVERFLOW           = 2     /* Line too long, discarded */
+} cmd_line_status_t;
+
+/* Line being received */
+typedef struct
+{
+    char    buf[CMD_LINE_MAX + 1U];     /* NUL-terminated when complete */
+    uint8_t len;
+    bool    overflow;                   /* Discarding up to the next terminator */
+} cmd_line_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void cmd_line_reset(cmd_line_t *line);
+cmd_line_status_t cmd_line_feed(cmd_line_t *line, uint8_t byte);
+cmd_status_t cmd_parse(const char *text, cmd_t *cmd);
+void cmd_params_default(cmd_params_t *params);
+cmd_status_t cmd_params_apply(cmd_params_t *params, const cmd_t *cmd);
+void cmd_params_encode(const cmd_params_t *params,
+                       uint32_t words[CMD_PARAMS_NUM_WORDS]);
+bool cmd_params_decode(const uint32_t words[CMD_PARAMS_NUM_WORDS],
+                       cmd_params_t *params);
+const char *cmd_status_name(cmd_status_t status);
+const char *cmd_power_name(uint8_t power);
+const char *cmd_wake_name(uint8_t wake);
+
+#endif /* _CMD_PARSER_H_ */
+
+/* [] END OF FILE */
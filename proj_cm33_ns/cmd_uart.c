@@ -0,0 +1,505 @@
+/*******************************************************************************
+ * File Name:   cmd_uart.c
+ *
+ * Description: This file contains the command interface on the debug UART.
+ *              Received bytes are assembled into lines in the UART
+ *              interrupt, and the commands are executed from the main loop
+ *              by cmd_uart_process(). The runtime parameters are kept in the
+ *              backup registers, so they survive Hibernate and resets.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cmd_uart.h"
+#include "led_pattern.h"
+#include "board_config.h"
+#include "retained_data.h"
+#include "telemetry.h"
+
+#if (RETAINED_PARAMS_NUM_WORDS != CMD_PARAMS_NUM_WORDS)
+#error "Backup register allocation does not match the parameter size"
+#endif
+
+#if (CMD_SESSION_TIMEOUT_MS > LED_PATTERN_TIMEOUT_MAX_MS)
+#error "CMD_SESSION_TIMEOUT_MS exceeds the MCWDT timeout range"
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Indexed by cmd_power_t */
+static const cy_en_lpcomp_pwr_t cmd_power_modes[CMD_NUM_POWER_MODES] =
+{
+    CY_LPCOMP_MODE_ULP,
+    CY_LPCOMP_MODE_LP,
+    CY_LPCOMP_MODE_NORMAL
+};
+
+static const cy_stc_sysint_t cmd_uart_irq_cfg =
+{
+    .intrSrc        = CYBSP_DEBUG_UART_IRQ,
+    .intrPriority   = CMD_UART_IRQ_PRIORITY
+};
+
+static const cy_stc_sysint_t cmd_rx_wake_irq_cfg =
+{
+    .intrSrc        = CYBSP_DEBUG_UART_RX_IRQ,
+    .intrPriority   = CMD_UART_IRQ_PRIORITY
+};
+
+static cmd_params_t params;
+
+/* Line being received, owned by the UART interrupt */
+static cmd_line_t rx_line;
+
+/* Last complete line, handed from the UART interrupt to the main loop */
+static char pending_line[CMD_LINE_MAX + 1U];
+static cmd_line_status_t pending_status;
+static volatile bool pending_ready = false;
+static volatile uint32_t dropped_lines = 0U;
+
+/* Command session: the CPU uses Sleep instead of DeepSleep, so that the UART
+ * keeps receiving. rx_activity records data received in the current period
+ * of the session timeout. */
+static volatile bool session_active = false;
+static volatile bool rx_activity = false;
+
+/*******************************************************************************
+* Function Name: cmd_uart_load_defaults
+********************************************************************************
+* Summary:
+* Loads the built-in parameters, with the comparator power mode of the
+* board configuration.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_uart_load_defaults(void)
+{
+    cmd_params_default(&params);
+
+    for (uint32_t i = 0U; i < (uint32_t)CMD_NUM_POWER_MODES; i++)
+    {
+        if (BOARD_LPCOMP_POWER_MODE == cmd_power_modes[i])
+        {
+            params.power = (uint8_t)i;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_store
+********************************************************************************
+* Summary:
+* Writes the parameters to the backup registers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_uart_store(void)
+{
+    uint32_t words[CMD_PARAMS_NUM_WORDS];
+
+    cmd_params_encode(&params, words);
+    Cy_SysPm_BackupWordStore(RETAINED_PARAMS_WORD, words, CMD_PARAMS_NUM_WORDS);
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_rx_isr
+********************************************************************************
+* Summary:
+* UART interrupt handler. Feeds the received bytes to the line parser and
+* hands complete lines to the main loop. A line completed while the previous
+* one is still pending is dropped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_uart_rx_isr(void)
+{
+    cmd_line_status_t status;
+
+    while (0U != Cy_SCB_UART_GetNumInRxFifo(CYBSP_DEBUG_UART_HW))
+    {
+        status = cmd_line_feed(&rx_line,
+                               (uint8_t)Cy_SCB_UART_Get(CYBSP_DEBUG_UART_HW));
+        rx_activity = true;
+
+        if (CMD_LINE_PENDING == status)
+        {
+            continue;
+        }
+
+        if (pending_ready)
+        {
+            dropped_lines++;
+            continue;
+        }
+
+        memcpy(pending_line, rx_line.buf, sizeof(pending_line));
+        pending_status = status;
+        pending_ready = true;
+    }
+
+    Cy_SCB_ClearRxInterrupt(CYBSP_DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+}
+
+/*******************************************************************************
+* Function Name: cmd_rx_wake_isr
+********************************************************************************
+* Summary:
+* RX pin interrupt handler. The falling edge of a start bit wakes the CPU
+* from DeepSleep and opens a command session, and starts its timeout. The
+* byte that caused the wakeup is not received correctly, so the partial line
+* is discarded.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_rx_wake_isr(void)
+{
+    Cy_GPIO_ClearInterrupt(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN);
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 0U);
+
+    cmd_line_reset(&rx_line);
+    session_active = true;
+    rx_activity = false;
+    led_pattern_timeout_start(CMD_SESSION_TIMEOUT_MS);
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_print_params
+********************************************************************************
+* Summary:
+* Replies with the current parameters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_uart_print_params(void)
+{
+    printf("OK period=%u hold=%u power=%s wake=%s\r\n",
+           (unsigned int)params.period_ms, (unsigned int)params.hold_ms,
+           cmd_power_name(params.power), cmd_wake_name(params.wake));
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_print_stat
+********************************************************************************
+* Summary:
+* Replies with a snapshot of the telemetry block.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cmd_uart_print_stat(void)
+{
+    const telemetry_block_t *block = (const telemetry_block_t *)TELEMETRY_BLOCK_ADDR;
+    telemetry_section_t cm33;
+    telemetry_section_t cm55;
+
+    if (!telemetry_read(block, TELEMETRY_CORE_CM33, &cm33))
+    {
+        printf("ERR busy\r\n");
+        return;
+    }
+
+    if (!telemetry_read(block, TELEMETRY_CORE_CM55, &cm55))
+    {
+        (void)memset(&cm55, 0, sizeof(cm55));
+    }
+
+    printf("OK boot_us=%lu wake=%lu deepsleep_wakes=%lu sleeps=%lu "
+           "storms=%lu absorbed=%lu cm55_idle=%lu cm55_off=%lu dropped=%lu\r\n",
+           (unsigned long)cm33.boot_time_us, (unsigned long)cm33.last_wake,
+           (unsigned long)cm33.deepsleep_wakes, (unsigned long)cm33.sleep_entries,
+           (unsigned long)cm33.storms, (unsigned long)cm33.absorbed,
+           (unsigned long)cm55.idle_state, (unsigned long)cm55.off_request,
+           (unsigned long)dropped_lines);
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_init
+********************************************************************************
+* Summary:
+* Restores the parameters from the backup registers, or loads the built-in
+* ones, and enables the UART receive interrupt and the RX pin wakeup. Must
+* be called after init_retarget_io().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_uart_init(void)
+{
+    uint32_t words[CMD_PARAMS_NUM_WORDS];
+
+    Cy_SysPm_BackupWordReStore(RETAINED_PARAMS_WORD, words, CMD_PARAMS_NUM_WORDS);
+    if (!cmd_params_decode(words, &params))
+    {
+        cmd_uart_load_defaults();
+        cmd_uart_store();
+    }
+
+    cmd_line_reset(&rx_line);
+    pending_ready = false;
+    session_active = false;
+
+    Cy_SCB_UART_ClearRxFifo(CYBSP_DEBUG_UART_HW);
+    Cy_SCB_ClearRxInterrupt(CYBSP_DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+    Cy_SCB_SetRxInterruptMask(CYBSP_DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+    Cy_SysInt_Init(&cmd_uart_irq_cfg, cmd_uart_rx_isr);
+    NVIC_EnableIRQ(cmd_uart_irq_cfg.intrSrc);
+
+    /* Armed by cmd_uart_sleep() before each DeepSleep entry */
+    Cy_GPIO_SetInterruptEdge(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN,
+                             CY_GPIO_INTR_FALLING);
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 0U);
+    Cy_SysInt_Init(&cmd_rx_wake_irq_cfg, cmd_rx_wake_isr);
+    NVIC_EnableIRQ(cmd_rx_wake_irq_cfg.intrSrc);
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_process
+********************************************************************************
+* Summary:
+* Executes the pending command line, if any, replies on the UART, and stores
+* changed parameters in the backup registers. Replies start with "OK" or
+* with "ERR" and the reason.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CMD_CHANGED_* flags of the parameters that changed
+*
+*******************************************************************************/
+uint32_t cmd_uart_process(void)
+{
+    char line[CMD_LINE_MAX + 1U];
+    cmd_line_status_t line_status;
+    cmd_params_t previous = params;
+    cmd_status_t status;
+    cmd_t cmd;
+    uint32_t interrupt_state;
+    uint32_t changed = 0U;
+
+    if (!pending_ready)
+    {
+        return 0U;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    memcpy(line, pending_line, sizeof(line));
+    line_status = pending_status;
+    pending_ready = false;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if (CMD_LINE_OVERFLOW == line_status)
+    {
+        status = CMD_ERR_OVERFLOW;
+    }
+    else
+    {
+        status = cmd_parse(line, &cmd);
+    }
+
+    if ((CMD_OK == status) && ((uint8_t)CMD_OP_DEFAULTS == cmd.op))
+    {
+        cmd_uart_load_defaults();
+    }
+    else if (CMD_OK == status)
+    {
+        status = cmd_params_apply(&params, &cmd);
+    }
+
+    if (CMD_OK != status)
+    {
+        printf("ERR %s\r\n", cmd_status_name(status));
+        return 0U;
+    }
+
+    switch ((cmd_op_t)cmd.op)
+    {
+        case CMD_OP_STAT:
+            cmd_uart_print_stat();
+            break;
+
+        case CMD_OP_HELP:
+            printf("OK get | set period <ms> | set hold <ms> | "
+                   "set power ulp|lp|normal | set wake high|low | "
+                   "defaults | stat\r\n");
+            break;
+
+        case CMD_OP_GET:
+        case CMD_OP_SET:
+        case CMD_OP_DEFAULTS:
+        default:
+            cmd_uart_print_params();
+            break;
+    }
+
+    if ((previous.period_ms != params.period_ms) ||
+        (previous.hold_ms != params.hold_ms))
+    {
+        changed |= CMD_CHANGED_TIMING;
+    }
+    if (previous.power != params.power)
+    {
+        changed |= CMD_CHANGED_POWER;
+    }
+    if (previous.wake != params.wake)
+    {
+        changed |= CMD_CHANGED_WAKE;
+    }
+
+    if (0U != changed)
+    {
+        cmd_uart_store();
+    }
+
+    return changed;
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_get_params
+********************************************************************************
+* Summary:
+* Returns the current runtime parameters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  const cmd_params_t *: Current parameters
+*
+*******************************************************************************/
+const cmd_params_t *cmd_uart_get_params(void)
+{
+    return &params;
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_lpcomp_power
+********************************************************************************
+* Summary:
+* Returns the comparator power mode selected by the parameters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_lpcomp_pwr_t: Comparator power mode
+*
+*******************************************************************************/
+cy_en_lpcomp_pwr_t cmd_uart_lpcomp_power(void)
+{
+    return cmd_power_modes[params.power];
+}
+
+/*******************************************************************************
+* Function Name: cmd_uart_sleep
+********************************************************************************
+* Summary:
+* Puts the CPU to sleep until the next interrupt. Outside of a command
+* session, the CPU enters DeepSleep with the RX pin armed to wake it. During
+* a session, the CPU enters Sleep so that the UART keeps receiving. When
+* the session timeout expires, it is restarted if data was received since
+* it started, and the session ends otherwise. The expiry interrupt wakes the
+* CPU, so the session ends even if nothing else does. May be called with
+* interrupts masked. The interrupts then run only after the caller unmasks
+* them, so data waiting in the RX FIFO also counts as received, and an
+* expiry is seen on the next call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_uart_sleep(void)
+{
+    if (session_active && led_pattern_timeout_expired())
+    {
+        if (rx_activity ||
+            (0U != Cy_SCB_UART_GetNumInRxFifo(CYBSP_DEBUG_UART_HW)))
+        {
+            rx_activity = false;
+            led_pattern_timeout_start(CMD_SESSION_TIMEOUT_MS);
+        }
+        else
+        {
+            session_active = false;
+        }
+    }
+
+    if (session_active)
+    {
+        Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        return;
+    }
+
+    Cy_GPIO_ClearInterrupt(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN);
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 1U);
+    Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+}
+
+/* [] END OF FILE */
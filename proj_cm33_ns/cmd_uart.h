@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * File Name:   cmd_uart.h
+ *
+ * Description: This file is the public interface of cmd_uart.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _CMD_UART_H_
+#define _CMD_UART_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "cmd_parser.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Priority of the UART receive and RX pin wakeup interrupts */
+#define CMD_UART_IRQ_PRIORITY           (7U)
+
+/* A command session is timed in periods of this length from the wakeup that
+ * opened it. The session ends, and the CPU returns to DeepSleep, at the end
+ * of the first period without received data, so between one and two
+ * periods after the last byte. */
+#define CMD_SESSION_TIMEOUT_MS          (1000U)
+
+/* Parameters changed by cmd_uart_process() */
+#define CMD_CHANGED_TIMING              (1UL << 0U)
+#define CMD_CHANGED_POWER               (1UL << 1U)
+#define CMD_CHANGED_WAKE                (1UL << 2U)
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void cmd_uart_init(void);
+uint32_t cmd_uart_process(void);
+const cmd_params_t *cmd_uart_get_params(void);
+cy_en_lpcomp_pwr_t cmd_uart_lpcomp_power(void);
+void cmd_uart_sleep(void);
+
+#endif /* _CMD_UART_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,609 @@
+/*******************************************************************************
+ * File Name:   led_pattern.c
+ *
+ * Description: This file contains the LED pattern engine. Patterns are played
+ *              out on USER LED1 (red) and USER LED2 (green) from the MCWDT
+ *              interrupt, so the CPU sleeps between LED edges instead of
+ *              busy-waiting in Cy_SysLib_Delay(). Counter 1 of the same
+ *              MCWDT, which shares its interrupt, provides a one-shot
+ *              timeout to the other modules.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "led_pattern.h"
+#include "cmd_uart.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LED_PATTERN_TIMER_HW        (CYBSP_CM33_LPTIMER_0_HW)
+#define LED_PATTERN_TIMER_IRQ       (CYBSP_CM33_LPTIMER_0_IRQ)
+#define LED_PATTERN_TIMER_PRIORITY  (7U)
+
+/* MCWDT counters 0 and 1 are clocked from the 32.768 kHz LFCLK */
+#define LED_PATTERN_LFCLK_HZ        (32768U)
+#define LED_PATTERN_MAX_TICKS       (65536U)
+
+/* Three LFCLK cycles for counter control to take effect */
+#define LED_PATTERN_MCWDT_WAIT_US   (93U)
+
+#define LED_ON                      (1U)
+#define LED_OFF                     (0U)
+
+/* Error code flash timing */
+#define LED_ERROR_FLASH_MS          (200U)
+#define LED_ERROR_PAUSE_MS          (1000U)
+
+/* Green flash at the start of a back-off dwell */
+#define LED_DWELL_FLASH_MS          (50U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Step durations are changed at runtime by led_pattern_set_timing() */
+static uint16_t active_blink_steps[] =
+{
+    LED_PATTERN_STEP(LED_ON,  LED_OFF, 500U),
+    LED_PATTERN_STEP(LED_OFF, LED_OFF, 500U)
+};
+
+static uint16_t hibernate_hold_steps[] =
+{
+    LED_PATTERN_STEP(LED_ON,  LED_OFF, 2000U),
+    LED_PATTERN_STEP(LED_OFF, LED_OFF, 0U)
+};
+
+/* USER LED1 toggles every 500 ms while the input is at the active level */
+const led_pattern_t led_pattern_active_blink =
+{
+    .steps      = active_blink_steps,
+    .num_steps  = (uint8_t)CY_ARRAY_SIZE(active_blink_steps),
+    .repeat     = LED_PATTERN_REPEAT_FOREVER
+};
+
+/* USER LED1 on for 2 seconds before entering Hibernate */
+const led_pattern_t led_pattern_hibernate_hold =
+{
+    .steps      = hibernate_hold_steps,
+    .num_steps  = (uint8_t)CY_ARRAY_SIZE(hibernate_hold_steps),
+    .repeat     = 1U
+};
+
+/* Error code: <code> red flashes followed by a pause with the green LED on */
+static uint16_t error_steps[(2U * LED_PATTERN_MAX_ERROR_CODE) + 1U];
+static led_pattern_t led_pattern_error =
+{
+    .steps      = error_steps,
+    .num_steps  = 0U,
+    .repeat     = LED_PATTERN_REPEAT_FOREVER
+};
+
+/* Back-off dwell: short green flash, then both LEDs off for the rest */
+static uint16_t dwell_steps[3];
+static led_pattern_t led_pattern_dwell =
+{
+    .steps      = dwell_steps,
+    .num_steps  = (uint8_t)CY_ARRAY_SIZE(dwell_steps),
+    .repeat     = 1U
+};
+
+static const cy_stc_mcwdt_config_t led_pattern_timer_config =
+{
+    .c0Match        = 0U,
+    .c0Mode         = CY_MCWDT_MODE_INT,
+    .c0ClearOnMatch = 1U,
+    .c1Match        = 0U,
+    .c1Mode         = CY_MCWDT_MODE_INT,
+    .c1ClearOnMatch = 1U,
+    .c2Mode         = CY_MCWDT_MODE_NONE,
+    .c0c1Cascade    = false,
+    .c1c2Cascade    = false
+};
+
+static const cy_stc_sysint_t led_pattern_irq_cfg =
+{
+    .intrSrc        = LED_PATTERN_TIMER_IRQ,
+    .intrPriority   = LED_PATTERN_TIMER_PRIORITY
+};
+
+/* Playback state, updated from the MCWDT interrupt */
+static const led_pattern_t * volatile current_pattern = NULL;
+static uint32_t current_step;
+static uint32_t plays_left;
+static uint32_t ticks_left;
+
+/* One-shot timeout on counter 1 */
+static bool timeout_running = false;
+static volatile bool timeout_expired = false;
+
+/*******************************************************************************
+* Function Name: led_pattern_arm
+********************************************************************************
+* Summary:
+* Programs the MCWDT match for the next chunk of the current step. Steps
+* longer than the 16-bit counter range are split into several chunks.
+*
+* Parameters:
+*  wait_us: Time to wait for the new match value to take effect
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void led_pattern_arm(uint16_t wait_us)
+{
+    uint32_t ticks = (ticks_left > LED_PATTERN_MAX_TICKS) ?
+                      LED_PATTERN_MAX_TICKS : ticks_left;
+
+    ticks_left -= ticks;
+
+    /* The counter clears on match, so the period is match + 1 */
+    Cy_MCWDT_SetMatch(LED_PATTERN_TIMER_HW, CY_MCWDT_COUNTER0,
+                      ticks - 1U, wait_us);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_apply_step
+********************************************************************************
+* Summary:
+* Drives the LEDs for the current step and loads its duration. Returns false
+* when the step ends the pattern.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the step has a duration to wait for
+*
+*******************************************************************************/
+static bool led_pattern_apply_step(void)
+{
+    uint16_t step = current_pattern->steps[current_step];
+    uint32_t duration_ms = (uint32_t)step & LED_PATTERN_DURATION_Msk;
+
+    Cy_GPIO_Write(CYBSP_LED_RED_PORT, CYBSP_LED_RED_PIN,
+                  ((uint32_t)step >> LED_PATTERN_RED_Pos) & 1U);
+    Cy_GPIO_Write(CYBSP_LED_GREEN_PORT, CYBSP_LED_GREEN_PIN,
+                  ((uint32_t)step >> LED_PATTERN_GREEN_Pos) & 1U);
+
+    ticks_left = (duration_ms * LED_PATTERN_LFCLK_HZ) / 1000U;
+
+    return (0U != ticks_left);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_timer_isr
+********************************************************************************
+* Summary:
+* MCWDT interrupt handler. A counter 1 match ends the timeout. A counter 0
+* match advances the current pattern by one step, or continues the current
+* step if it spans more than one counter period.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void led_pattern_timer_isr(void)
+{
+    uint32_t status = Cy_MCWDT_GetInterruptStatusMasked(LED_PATTERN_TIMER_HW);
+
+    if (0U != (status & CY_MCWDT_CTR1))
+    {
+        Cy_MCWDT_ClearInterrupt(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1);
+        Cy_MCWDT_Disable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1, 0U);
+        timeout_running = false;
+        timeout_expired = true;
+    }
+
+    if (0U == (status & CY_MCWDT_CTR0))
+    {
+        return;
+    }
+
+    Cy_MCWDT_ClearInterrupt(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0);
+
+    if (NULL == current_pattern)
+    {
+        return;
+    }
+
+    /* The counter was just cleared, so the new match is far enough ahead
+     * to not need the synchronization wait. */
+    if (0U != ticks_left)
+    {
+        led_pattern_arm(0U);
+        return;
+    }
+
+    current_step++;
+    if (current_step >= current_pattern->num_steps)
+    {
+        current_step = 0U;
+        if ((LED_PATTERN_REPEAT_FOREVER != current_pattern->repeat) &&
+            (0U == --plays_left))
+        {
+            led_pattern_stop();
+            return;
+        }
+    }
+
+    if (led_pattern_apply_step())
+    {
+        led_pattern_arm(0U);
+    }
+    else
+    {
+        Cy_MCWDT_Disable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0, 0U);
+        current_pattern = NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_init
+********************************************************************************
+* Summary:
+* Initializes the MCWDT that times the LED patterns. The MCWDT keeps running
+* in DeepSleep, so patterns continue while the CPU sleeps.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_init(void)
+{
+    Cy_MCWDT_Init(LED_PATTERN_TIMER_HW, &led_pattern_timer_config);
+    Cy_MCWDT_SetInterruptMask(LED_PATTERN_TIMER_HW,
+                              CY_MCWDT_CTR0 | CY_MCWDT_CTR1);
+    timeout_running = false;
+    timeout_expired = false;
+
+    Cy_SysInt_Init(&led_pattern_irq_cfg, led_pattern_timer_isr);
+    NVIC_EnableIRQ(led_pattern_irq_cfg.intrSrc);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_play
+********************************************************************************
+* Summary:
+* Starts playing a pattern from its first step. Does nothing if the pattern
+* is already playing, so it can be called on every pass of the main loop.
+*
+* Parameters:
+*  pattern: Pattern to play
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_play(const led_pattern_t *pattern)
+{
+    uint32_t interrupt_state;
+
+    if ((pattern == current_pattern) || (0U == pattern->num_steps))
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    Cy_MCWDT_Disable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0,
+                     LED_PATTERN_MCWDT_WAIT_US);
+    Cy_MCWDT_ClearInterrupt(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0);
+
+    current_pattern = pattern;
+    current_step = 0U;
+    plays_left = pattern->repeat;
+
+    if (led_pattern_apply_step())
+    {
+        led_pattern_arm(LED_PATTERN_MCWDT_WAIT_US);
+        Cy_MCWDT_ResetCounters(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0,
+                               LED_PATTERN_MCWDT_WAIT_US);
+        Cy_MCWDT_Enable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0,
+                        LED_PATTERN_MCWDT_WAIT_US);
+    }
+    else
+    {
+        current_pattern = NULL;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_play_error
+********************************************************************************
+* Summary:
+* Flashes an error code on the red LED, each time followed by a pause with
+* the green LED on.
+*
+* Parameters:
+*  code: Number of flashes, 1 to LED_PATTERN_MAX_ERROR_CODE
+*  repeat: Number of plays, or LED_PATTERN_REPEAT_FOREVER to flash the code
+*          until another pattern is started
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_play_error(uint8_t code, uint8_t repeat)
+{
+    uint32_t n = 0U;
+
+    if (code > LED_PATTERN_MAX_ERROR_CODE)
+    {
+        code = LED_PATTERN_MAX_ERROR_CODE;
+    }
+
+    led_pattern_stop();
+
+    for (uint32_t i = 0U; i < code; i++)
+    {
+        error_steps[n++] = LED_PATTERN_STEP(LED_ON,  LED_OFF, LED_ERROR_FLASH_MS);
+        error_steps[n++] = LED_PATTERN_STEP(LED_OFF, LED_OFF, LED_ERROR_FLASH_MS);
+    }
+    error_steps[n++] = LED_PATTERN_STEP(LED_OFF, LED_ON, LED_ERROR_PAUSE_MS);
+
+    led_pattern_error.num_steps = (uint8_t)n;
+    led_pattern_error.repeat = repeat;
+    led_pattern_play(&led_pattern_error);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_play_dwell
+********************************************************************************
+* Summary:
+* Plays a one-shot dwell of the given length, marked by a short flash of the
+* green LED. Used to delay re-arming the wakeup source while the wake
+* governor backs off.
+*
+* Parameters:
+*  dwell_ms: Dwell length, at most LED_PATTERN_DURATION_Msk milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_play_dwell(uint16_t dwell_ms)
+{
+    if (dwell_ms <= LED_DWELL_FLASH_MS)
+    {
+        dwell_ms = LED_DWELL_FLASH_MS + 1U;
+    }
+
+    led_pattern_stop();
+
+    dwell_steps[0] = LED_PATTERN_STEP(LED_OFF, LED_ON,  LED_DWELL_FLASH_MS);
+    dwell_steps[1] = LED_PATTERN_STEP(LED_OFF, LED_OFF, dwell_ms - LED_DWELL_FLASH_MS);
+    dwell_steps[2] = LED_PATTERN_STEP(LED_OFF, LED_OFF, 0U);
+
+    led_pattern_play(&led_pattern_dwell);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_set_timing
+********************************************************************************
+* Summary:
+* Changes the toggle period of led_pattern_active_blink and the on time of
+* led_pattern_hibernate_hold. A pattern that is playing uses the new timing
+* from its next step.
+*
+* Parameters:
+*  period_ms: Toggle period, at most LED_PATTERN_DURATION_Msk milliseconds
+*  hold_ms: On time, at most LED_PATTERN_DURATION_Msk milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_set_timing(uint16_t period_ms, uint16_t hold_ms)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    active_blink_steps[0] = LED_PATTERN_STEP(LED_ON,  LED_OFF, period_ms);
+    active_blink_steps[1] = LED_PATTERN_STEP(LED_OFF, LED_OFF, period_ms);
+    hibernate_hold_steps[0] = LED_PATTERN_STEP(LED_ON, LED_OFF, hold_ms);
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_stop
+********************************************************************************
+* Summary:
+* Stops the current pattern and turns both LEDs off.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_stop(void)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    Cy_MCWDT_Disable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR0, 0U);
+    current_pattern = NULL;
+
+    Cy_GPIO_Write(CYBSP_LED_RED_PORT, CYBSP_LED_RED_PIN, LED_OFF);
+    Cy_GPIO_Write(CYBSP_LED_GREEN_PORT, CYBSP_LED_GREEN_PIN, LED_OFF);
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_is_active
+********************************************************************************
+* Summary:
+* Returns whether a pattern is playing.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if a pattern is playing
+*
+*******************************************************************************/
+bool led_pattern_is_active(void)
+{
+    return (NULL != current_pattern);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_wait
+********************************************************************************
+* Summary:
+* Puts the CPU to sleep with cmd_uart_sleep() until the current pattern has
+* finished, so that an open command session keeps receiving. The check and
+* the sleep are done with interrupts masked so that the final pattern
+* interrupt cannot be missed. Must not be called while a pattern with
+* LED_PATTERN_REPEAT_FOREVER is playing.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_wait(void)
+{
+    uint32_t interrupt_state;
+
+    for (;;)
+    {
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+        if (!led_pattern_is_active())
+        {
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+            break;
+        }
+
+        cmd_uart_sleep();
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_timeout_start
+********************************************************************************
+* Summary:
+* Starts the one-shot timeout on MCWDT counter 1, or restarts it if it is
+* running. The expiry raises an interrupt, so it also wakes the CPU from
+* Sleep and DeepSleep.
+*
+* Parameters:
+*  timeout_ms: Timeout, at most LED_PATTERN_TIMEOUT_MAX_MS
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_timeout_start(uint16_t timeout_ms)
+{
+    uint32_t ticks = ((uint32_t)timeout_ms * LED_PATTERN_LFCLK_HZ) / 1000U;
+    uint32_t interrupt_state;
+
+    CY_ASSERT((0U != ticks) && (ticks <= LED_PATTERN_MAX_TICKS));
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    /* The counter clears on match, so the period is match + 1 */
+    Cy_MCWDT_SetMatch(LED_PATTERN_TIMER_HW, CY_MCWDT_COUNTER1, ticks - 1U, 0U);
+    Cy_MCWDT_ResetCounters(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1,
+                           LED_PATTERN_MCWDT_WAIT_US);
+    Cy_MCWDT_ClearInterrupt(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1);
+    if (!timeout_running)
+    {
+        Cy_MCWDT_Enable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1,
+                        LED_PATTERN_MCWDT_WAIT_US);
+        timeout_running = true;
+    }
+    timeout_expired = false;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_timeout_stop
+********************************************************************************
+* Summary:
+* Stops the timeout without it expiring.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void led_pattern_timeout_stop(void)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    Cy_MCWDT_Disable(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1, 0U);
+    Cy_MCWDT_ClearInterrupt(LED_PATTERN_TIMER_HW, CY_MCWDT_CTR1);
+    timeout_running = false;
+    timeout_expired = false;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: led_pattern_timeout_expired
+********************************************************************************
+* Summary:
+* Returns whether the timeout started by led_pattern_timeout_start() has
+* expired. The expiry is seen only after its interrupt has run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the timeout has expired
+*
+*******************************************************************************/
+bool led_pattern_timeout_expired(void)
+{
+    return timeout_expired;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * File Name:   led_pattern.h
+ *
+ * Description: This file is the public interface of led_pattern.c and
+ *              contains the LED pattern descriptor encoding.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _LED_PATTERN_H_
+#define _LED_PATTERN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* A pattern step is one 16-bit word: LED levels in the two upper bits and the
+ * step duration in milliseconds in the lower 14 bits. A duration of zero ends
+ * the pattern with the LEDs left at the levels of that step. */
+#define LED_PATTERN_RED_Pos         (15U)
+#define LED_PATTERN_GREEN_Pos       (14U)
+#define LED_PATTERN_DURATION_Msk    (0x3FFFU)
+
+#define LED_PATTERN_STEP(red, green, ms) \
+                    ((uint16_t)((((uint16_t)(red) & 1U) << LED_PATTERN_RED_Pos) | \
+                    (((uint16_t)(green) & 1U) << LED_PATTERN_GREEN_Pos) | \
+                    ((uint16_t)(ms) & LED_PATTERN_DURATION_Msk)))
+
+/* Pattern repeat count meaning "play until another pattern is started" */
+#define LED_PATTERN_REPEAT_FOREVER  (0U)
+
+/* Longest error code that can be flashed by led_pattern_play_error() */
+#define LED_PATTERN_MAX_ERROR_CODE  (8U)
+
+/* Longest timeout of led_pattern_timeout_start(): the 16-bit MCWDT counter
+ * at 32.768 kHz */
+#define LED_PATTERN_TIMEOUT_MAX_MS  (2000U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* LED pattern descriptor */
+typedef struct
+{
+    const uint16_t *steps;      /* Steps encoded with LED_PATTERN_STEP() */
+    uint8_t         num_steps;
+    uint8_t         repeat;     /* Number of plays, or LED_PATTERN_REPEAT_FOREVER */
+} led_pattern_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const led_pattern_t led_pattern_active_blink;
+extern const led_pattern_t led_pattern_hibernate_hold;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void led_pattern_init(void);
+void led_pattern_play(const led_pattern_t *pattern);
+void led_pattern_play_error(uint8_t code, uint8_t repeat);
+void led_pattern_play_dwell(uint16_t dwell_ms);
+void led_pattern_set_timing(uint16_t period_ms, uint16_t hold_ms);
+void led_pattern_stop(void);
+bool led_pattern_is_active(void);
+void led_pattern_wait(void);
+void led_pattern_timeout_start(uint16_t timeout_ms);
+void led_pattern_timeout_stop(void);
+bool led_pattern_timeout_expired(void);
+
+#endif /* _LED_PATTERN_H_ */
+
+/* [] END OF FILE */
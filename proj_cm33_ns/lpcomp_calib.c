@@ -0,0 +1,449 @@
+/*******************************************************************************
+ * File Name:   lpcomp_calib.c
+ *
+ * Description: This file contains the production test calibration of the
+ *              LPComp trip point against the ULP reference and the per-device
+ *              calibration table that is applied on every wakeup.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "lpcomp_calib.h"
+#include "retarget_io_init.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LPCOMP_CALIB_SETTLE_TIME_US     (50U)
+#define LPCOMP_CALIB_CRC_INIT           (0xFFFFU)
+#define LPCOMP_CALIB_CRC_POLY           (0x1021U)
+#define LPCOMP_CALIB_PERMILLE           (1000U)
+
+/* 10%..90% width of a Gaussian transition per sample on the wrong side of
+ * the trip point, in 1/1000 of the sample step: 2.563 * sqrt(2 * pi) / 2 */
+#define LPCOMP_CALIB_BAND_PER_ERROR     (3212)
+
+/* The table must fill exactly one RRAM write block */
+_Static_assert(sizeof(lpcomp_calib_table_t) == LPCOMP_CALIB_TABLE_SIZE,
+               "lpcomp_calib_table_t does not match LPCOMP_CALIB_TABLE_SIZE");
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Power modes in table order */
+static const cy_en_lpcomp_pwr_t calib_modes[LPCOMP_CALIB_NUM_MODES] =
+{
+    CY_LPCOMP_MODE_ULP,
+    CY_LPCOMP_MODE_LP,
+    CY_LPCOMP_MODE_NORMAL
+};
+
+/* Samples of the sweep in progress, one bit per sample, set when the
+ * output was in the new state */
+static uint32_t calib_samples[(LPCOMP_CALIB_NUM_SAMPLES + 31U) / 32U];
+
+/*******************************************************************************
+* Function Name: calib_mode_index
+********************************************************************************
+* Summary:
+* Returns the table index for an LPComp power mode.
+*
+* Parameters:
+*  power: LPComp power mode
+*
+* Return:
+*  uint32_t: Table index, LPCOMP_CALIB_NUM_MODES if the mode has no entry
+*
+*******************************************************************************/
+static uint32_t calib_mode_index(cy_en_lpcomp_pwr_t power)
+{
+    uint32_t idx;
+
+    for (idx = 0U; idx < LPCOMP_CALIB_NUM_MODES; idx++)
+    {
+        if (calib_modes[idx] == power)
+        {
+            break;
+        }
+    }
+
+    return idx;
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_crc16
+********************************************************************************
+* Summary:
+* Computes the CRC-16/CCITT of a byte array.
+*
+* Parameters:
+*  data: Bytes to protect
+*  size: Number of bytes
+*
+* Return:
+*  uint16_t: CRC value
+*
+*******************************************************************************/
+uint16_t lpcomp_calib_crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = LPCOMP_CALIB_CRC_INIT;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8U);
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = (0U != (crc & 0x8000U)) ?
+                  (uint16_t)((crc << 1U) ^ LPCOMP_CALIB_CRC_POLY) :
+                  (uint16_t)(crc << 1U);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: calib_sample
+********************************************************************************
+* Summary:
+* Returns one sample of a sweep.
+*
+* Parameters:
+*  samples: Sweep samples, one bit per sample
+*  idx: Sample index
+*
+* Return:
+*  uint32_t: 1 if the output was in the new state, else 0
+*
+*******************************************************************************/
+static inline uint32_t calib_sample(const uint32_t *samples, uint32_t idx)
+{
+    return (samples[idx / 32U] >> (idx % 32U)) & 1U;
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_fit
+********************************************************************************
+* Summary:
+* Fits the switching level and the width of the transition region to the
+* samples of one edge of the tester ramp, at the resolution of single
+* samples.
+*
+* The switching level splits the ramp so that the number of samples before
+* it equals the number of samples in the old state. Input noise moves as
+* many samples across the split in each direction, so the level is not
+* biased by the noise, and a noiseless comparator is located to within half
+* a sample.
+*
+* The samples that fall on the wrong side of the split are counted and
+* converted to the 10%..90% width of a Gaussian transition that produces as
+* many of them on average. A noiseless comparator gives a band of 0,
+* independent of the bin width.
+*
+* Parameters:
+*  samples: Sweep samples, one bit per sample, set in the new state
+*  num_bins: Number of bins covering the ramp
+*  samples_per_bin: Samples taken in each bin
+*  start_mv: Ramp level at the start of the first sample
+*  end_mv: Ramp level at the end of the last sample
+*  trip_mv: Switching level
+*  band_mv: Width of the transition region
+*
+* Return:
+*  bool: false if the ramp does not cover the transition, that is if the
+*  first bin is not mostly in the old state or the last bin is not mostly
+*  in the new state
+*
+*******************************************************************************/
+bool lpcomp_calib_fit(const uint32_t *samples, uint32_t num_bins,
+                      uint16_t samples_per_bin, int16_t start_mv,
+                      int16_t end_mv, int16_t *trip_mv, uint16_t *band_mv)
+{
+    int32_t span = (int32_t)end_mv - (int32_t)start_mv;
+    uint32_t num_samples = num_bins * samples_per_bin;
+    uint32_t first = 0U;
+    uint32_t last = 0U;
+    uint32_t split = 0U;
+    uint32_t errors = 0U;
+
+    for (uint32_t s = 0U; s < samples_per_bin; s++)
+    {
+        first += calib_sample(samples, s);
+        last += calib_sample(samples, num_samples - samples_per_bin + s);
+    }
+
+    /* The transition must lie inside the ramp */
+    if (((2U * first) >= samples_per_bin) || ((2U * last) < samples_per_bin))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        split += 1U - calib_sample(samples, i);
+    }
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        if (calib_sample(samples, i) != ((i < split) ? 0U : 1U))
+        {
+            errors++;
+        }
+    }
+
+    /* Rounded to the nearest millivolt */
+    *trip_mv = (int16_t)(start_mv + (((2 * span * (int32_t)split) +
+                                      ((span < 0) ? -(int32_t)num_samples :
+                                                    (int32_t)num_samples)) /
+                                     (2 * (int32_t)num_samples)));
+    *band_mv = (uint16_t)(((uint64_t)errors * (uint32_t)((span < 0) ? -span : span) *
+                           LPCOMP_CALIB_BAND_PER_ERROR) /
+                          ((uint64_t)num_samples * LPCOMP_CALIB_PERMILLE));
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: calib_sweep_edge
+********************************************************************************
+* Summary:
+* Samples the comparator output over one edge of the tester ramp and returns
+* the switching level and the width of the transition region.
+*
+* Parameters:
+*  base: LPComp base address
+*  channel: LPComp channel
+*  new_state: Output state the comparator switches to on this edge
+*  start_mv: Ramp level at the start of the edge
+*  end_mv: Ramp level at the end of the edge
+*  trip_mv: Switching level
+*  band_mv: Width of the transition region
+*
+* Return:
+*  bool: false if the edge does not cover the transition
+*
+*******************************************************************************/
+static bool calib_sweep_edge(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                             uint32_t new_state, int16_t start_mv,
+                             int16_t end_mv, int16_t *trip_mv,
+                             uint16_t *band_mv)
+{
+    memset(calib_samples, 0, sizeof(calib_samples));
+
+    /* Sample in the middle of each sample period */
+    for (uint32_t i = 0U; i < LPCOMP_CALIB_NUM_SAMPLES; i++)
+    {
+        Cy_SysLib_DelayUs(LPCOMP_CALIB_SAMPLE_PERIOD_US / 2U);
+        if (new_state == Cy_LPComp_GetCompare(base, channel))
+        {
+            calib_samples[i / 32U] |= 1UL << (i % 32U);
+        }
+        Cy_SysLib_DelayUs(LPCOMP_CALIB_SAMPLE_PERIOD_US -
+                          (LPCOMP_CALIB_SAMPLE_PERIOD_US / 2U));
+    }
+
+    return lpcomp_calib_fit(calib_samples, LPCOMP_CALIB_NUM_BINS,
+                            LPCOMP_CALIB_SAMPLES_PER_BIN, start_mv, end_mv,
+                            trip_mv, band_mv);
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_get
+********************************************************************************
+* Summary:
+* Returns the stored calibration entry for an LPComp power mode. The table is
+* read in place from RRAM, so no sweep or copy is needed on wakeup.
+*
+* Parameters:
+*  power: LPComp power mode
+*
+* Return:
+*  const lpcomp_calib_entry_t*: Calibration entry, NULL if not calibrated
+*
+*******************************************************************************/
+const lpcomp_calib_entry_t *lpcomp_calib_get(cy_en_lpcomp_pwr_t power)
+{
+    const lpcomp_calib_table_t *table =
+                        (const lpcomp_calib_table_t *)LPCOMP_CALIB_RRAM_ADDR;
+    uint32_t idx = calib_mode_index(power);
+
+    if ((LPCOMP_CALIB_NUM_MODES == idx) ||
+        (LPCOMP_CALIB_MAGIC != table->magic) ||
+        (LPCOMP_CALIB_VERSION != table->version) ||
+        (0U == (table->valid_mask & (1U << idx))) ||
+        (table->crc != lpcomp_calib_crc16((const uint8_t *)table,
+                                          offsetof(lpcomp_calib_table_t, crc))))
+    {
+        return NULL;
+    }
+
+    return &table->entry[idx];
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_get_hysteresis
+********************************************************************************
+* Summary:
+* Returns the hysteresis setting for the given power mode. Hysteresis is
+* enabled when the measured noise band of the device would otherwise cause
+* the output to chatter around the trip point, and disabled for a power
+* mode without a valid calibration.
+*
+* Parameters:
+*  power: LPComp power mode
+*
+* Return:
+*  cy_en_lpcomp_hyst_t: Hysteresis setting
+*
+*******************************************************************************/
+cy_en_lpcomp_hyst_t lpcomp_calib_get_hysteresis(cy_en_lpcomp_pwr_t power)
+{
+    const lpcomp_calib_entry_t *entry = lpcomp_calib_get(power);
+
+    return ((NULL != entry) &&
+            (entry->noise_band_mv > LPCOMP_CALIB_HYST_THRESHOLD_MV)) ?
+            CY_LPCOMP_HYST_ENABLE : CY_LPCOMP_HYST_DISABLE;
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_apply
+********************************************************************************
+* Summary:
+* Applies the stored calibration for the given power mode, which sets the
+* hysteresis as returned by lpcomp_calib_get_hysteresis().
+*
+* Parameters:
+*  base: LPComp base address
+*  channel: LPComp channel
+*  power: LPComp power mode
+*
+* Return:
+*  const lpcomp_calib_entry_t*: Applied entry, NULL if not calibrated
+*
+*******************************************************************************/
+const lpcomp_calib_entry_t *lpcomp_calib_apply(LPCOMP_Type *base,
+                                cy_en_lpcomp_channel_t channel,
+                                cy_en_lpcomp_pwr_t power)
+{
+    const lpcomp_calib_entry_t *entry = lpcomp_calib_get(power);
+
+    if (NULL != entry)
+    {
+        Cy_LPComp_SetHysteresis(base, channel,
+                                lpcomp_calib_get_hysteresis(power));
+    }
+
+    return entry;
+}
+
+/*******************************************************************************
+* Function Name: lpcomp_calib_run
+********************************************************************************
+* Summary:
+* Runs the production test calibration. For every power mode, the ready
+* marker is sent on the debug UART, the rising and falling edges of the
+* tester ramp are sampled and the fitted trip points are stored in RRAM.
+* The comparator is then returned to the power mode the application runs
+* in, and settled.
+*
+* Parameters:
+*  base: LPComp base address
+*  channel: LPComp channel
+*  power: Power mode to restore on exit
+*  context: LPComp context
+*
+* Return:
+*  bool: true if at least one power mode was calibrated and stored
+*
+*******************************************************************************/
+bool lpcomp_calib_run(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                      cy_en_lpcomp_pwr_t power, cy_stc_lpcomp_context_t *context)
+{
+    lpcomp_calib_table_t table;
+    uint16_t band_fall_mv;
+
+    memset(&table, 0, sizeof(table));
+    table.magic = LPCOMP_CALIB_MAGIC;
+    table.version = LPCOMP_CALIB_VERSION;
+
+    for (uint32_t idx = 0U; idx < LPCOMP_CALIB_NUM_MODES; idx++)
+    {
+        lpcomp_calib_entry_t *entry = &table.entry[idx];
+
+        Cy_LPComp_SetPower(base, channel, calib_modes[idx], context);
+        Cy_SysLib_DelayUs(LPCOMP_CALIB_SETTLE_TIME_US);
+
+        printf("LPCOMP_CALIB_READY %u\r\n", (unsigned int)idx);
+        while (cy_retarget_io_is_tx_active()) {};
+
+        if (calib_sweep_edge(base, channel, 1U,
+                             LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                             &entry->trip_rise_mv, &entry->noise_band_mv) &&
+            calib_sweep_edge(base, channel, 0U,
+                             LPCOMP_CALIB_RAMP_END_MV, LPCOMP_CALIB_RAMP_START_MV,
+                             &entry->trip_fall_mv, &band_fall_mv))
+        {
+            /* Keep the wider of the two transition regions */
+            if (band_fall_mv > entry->noise_band_mv)
+            {
+                entry->noise_band_mv = band_fall_mv;
+            }
+            entry->offset_mv = (int16_t)((((int32_t)entry->trip_rise_mv +
+                                           (int32_t)entry->trip_fall_mv) / 2) -
+                                         LPCOMP_CALIB_NOMINAL_TRIP_MV);
+            table.valid_mask |= (uint8_t)(1U << idx);
+        }
+
+        printf("LPCOMP_CALIB_DONE %u %d %d %u %d\r\n", (unsigned int)idx,
+               entry->trip_rise_mv, entry->trip_fall_mv,
+               (unsigned int)entry->noise_band_mv, entry->offset_mv);
+    }
+
+    Cy_LPComp_SetPower(base, channel, power, context);
+    Cy_SysLib_DelayUs(LPCOMP_CALIB_SETTLE_TIME_US);
+
+    if (0U == table.valid_mask)
+    {
+        return false;
+    }
+
+    table.crc = lpcomp_calib_crc16((const uint8_t *)&table,
+                                   offsetof(lpcomp_calib_table_t, crc));
+
+    return (CY_RRAM_SUCCESS == Cy_RRAM_NvmWriteByteArray(RRAMC0,
+                                        LPCOMP_CALIB_RRAM_ADDR,
+                                        (const uint8_t *)&table, sizeof(table)));
+}
+
+/* [] END OF FILE */
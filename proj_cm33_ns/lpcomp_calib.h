@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * File Name:   lpcomp_calib.h
+ *
+ * Description: This file is the public interface of lpcomp_calib.c and
+ *              contains the calibration table layout and sweep parameters.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _LPCOMP_CALIB_H_
+#define _LPCOMP_CALIB_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Calibration table identification */
+#define LPCOMP_CALIB_MAGIC              (0x4C43U)
+#define LPCOMP_CALIB_VERSION            (2U)
+
+/* One table entry per LPComp power mode: ULP, LP and Normal */
+#define LPCOMP_CALIB_NUM_MODES          (3U)
+
+/* Size of the table in RRAM. Kept a multiple of the RRAM write granule. */
+#define LPCOMP_CALIB_TABLE_SIZE         (32U)
+
+/* RRAM location of the calibration table: the m33_calib region, which
+ * belongs to the CM33 non-secure domain and is not part of any image. It
+ * starts where the slot of the signed CM33 secure image ends. */
+#ifndef LPCOMP_CALIB_RRAM_ADDR
+#define LPCOMP_CALIB_RRAM_ADDR          (CYMEM_CM33_0_m33_calib_START)
+#endif
+
+/* Nominal trip point of the comparator against the ULP reference. The
+ * stored offset is the calibrated trip point minus this value. */
+#ifndef LPCOMP_CALIB_NOMINAL_TRIP_MV
+#define LPCOMP_CALIB_NOMINAL_TRIP_MV    (450)
+#endif
+
+/* Production test sweep. The tester drives a triangular ramp on VINP from
+ * LPCOMP_CALIB_RAMP_START_MV to LPCOMP_CALIB_RAMP_END_MV and back, each
+ * edge lasting LPCOMP_CALIB_RAMP_DURATION_MS, starting as soon as it receives
+ * the ready marker on the debug UART. */
+#define LPCOMP_CALIB_RAMP_START_MV      (0)
+#define LPCOMP_CALIB_RAMP_END_MV        (900)
+#define LPCOMP_CALIB_RAMP_DURATION_MS   (1024U)
+#define LPCOMP_CALIB_NUM_BINS           (64U)
+#define LPCOMP_CALIB_SAMPLES_PER_BIN    (16U)
+#define LPCOMP_CALIB_NUM_SAMPLES        (LPCOMP_CALIB_NUM_BINS * LPCOMP_CALIB_SAMPLES_PER_BIN)
+#define LPCOMP_CALIB_SAMPLE_PERIOD_US   ((LPCOMP_CALIB_RAMP_DURATION_MS * 1000U) / \
+                                                    LPCOMP_CALIB_NUM_SAMPLES)
+
+/* Hysteresis is enabled when the measured noise band exceeds this value */
+#define LPCOMP_CALIB_HYST_THRESHOLD_MV  (10U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Calibration result for one LPComp power mode */
+typedef struct
+{
+    int16_t  trip_rise_mv;  /* Input level at which the output goes HIGH */
+    int16_t  trip_fall_mv;  /* Input level at which the output goes LOW */
+    uint16_t noise_band_mv; /* Width of the 10%..90% transition region */
+    int16_t  offset_mv;     /* Trip point midpoint minus LPCOMP_CALIB_NOMINAL_TRIP_MV */
+} lpcomp_calib_entry_t;
+
+/* Per-device calibration table as stored in RRAM */
+typedef struct
+{
+    uint16_t magic;
+    uint8_t  version;
+    uint8_t  valid_mask;    /* Bit n set when entry[n] holds a valid result */
+    lpcomp_calib_entry_t entry[LPCOMP_CALIB_NUM_MODES];
+    uint8_t  reserved[2];
+    uint16_t crc;           /* CRC-16/CCITT of all preceding bytes */
+} lpcomp_calib_table_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+bool lpcomp_calib_fit(const uint32_t *samples, uint32_t num_bins,
+                      uint16_t samples_per_bin, int16_t start_mv,
+                      int16_t end_mv, int16_t *trip_mv, uint16_t *band_mv);
+uint16_t lpcomp_calib_crc16(const uint8_t *data, uint32_t size);
+const lpcomp_calib_entry_t *lpcomp_calib_get(cy_en_lpcomp_pwr_t power);
+cy_en_lpcomp_hyst_t lpcomp_calib_get_hysteresis(cy_en_lpcomp_pwr_t power);
+const lpcomp_calib_entry_t *lpcomp_calib_apply(LPCOMP_Type *base,
+                                cy_en_lpcomp_channel_t channel,
+                                cy_en_lpcomp_pwr_t power);
+bool lpcomp_calib_run(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                      cy_en_lpcomp_pwr_t power, cy_stc_lpcomp_context_t *context);
+
+#endif /* _LPCOMP_CALIB_H_ */
+
+/* [] END OF FILE */
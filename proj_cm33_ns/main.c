@@ -38,22 +38,28 @@
 #include "cybsp.h"
 #include "cy_pdl.h"
 #include "retarget_io_init.h"
+#include "lpcomp_calib.h"
+#include "led_pattern.h"
+#include "wake_governor.h"
+#include "telemetry.h"
+#include "xip_benchmark.h"
+#include "strategy_bench.h"
+#include "fault.h"
+#include "board_config.h"
+#include "cmd_uart.h"
+#include "secure_client.h"
 
 /*******************************************************************************
  * Macros
  *******************************************************************************/
-#define RED_LED_PORT                (GPIO_PRT16)
-#define RED_LED_PIN                 (7U)
 #define CM55_BOOT_WAIT_TIME_USEC    (10U)
-#define LPCOMP_ULP_SETTLE_TIME      (50U)
 #define LPCOMP_OUTPUT_LOW           (0U)
 #define LPCOMP_OUTPUT_HIGH          (1U)
-#define TOGGLE_LED_PERIOD_MS        (500U)
-#define LED_ON_DUR_BEFORE_HIB_IN_MS (2000U)
-#define PIN_VINP                    (P10_4)
-#define PIN_VINM                    (P10_5)
 #define CM55_BOOT_WAIT_TIME_USEC    (10U)
 
+/* Plays of the error code flashed after a recovered fault */
+#define FAULT_LED_PLAYS             (2U)
+
 /* App boot address for CM55 project */
 #define CM55_APP_BOOT_ADDR          (CYMEM_CM33_0_m55_nvm_START + \
                                         CYBSP_MCUBOOT_HEADER_SIZE)
@@ -63,12 +69,249 @@
  *******************************************************************************/
 cy_stc_lpcomp_context_t lpcomp_context;
 
+static bool cm55_enabled = false;
+
 const cy_stc_sysint_t lpcomp_irq_cfg =
 {
         .intrSrc = lpcomp_0_comp_0_IRQ,
         .intrPriority = 7u
 };
 
+/*******************************************************************************
+ * Function Name: lpcomp_isr
+ *******************************************************************************
+ * Summary:
+ * LPComp interrupt handler. The interrupt is only used to wake the CPU from
+ * DeepSleep, so the handler just clears it.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void lpcomp_isr(void)
+{
+    Cy_LPComp_ClearInterrupt(lpcomp_0_comp_0_HW, CY_LPCOMP_COMP0);
+}
+
+/*******************************************************************************
+ * Function Name: telemetry_record_wake
+ *******************************************************************************
+ * Summary:
+ * Publishes the wake cause and the wake governor counters in the shared 
+ * telemetry block.
+ *
+ * Parameters:
+ *  cause: Cause of the wakeup
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void telemetry_record_wake(telemetry_wake_t cause)
+{
+    const wake_governor_state_t *governor = wake_governor_get_state();
+    telemetry_section_t *section = telemetry_begin(TELEMETRY_CORE_CM33);
+
+    section->last_wake = (uint32_t)cause;
+    if (TELEMETRY_WAKE_DEEPSLEEP == cause)
+    {
+        section->deepsleep_wakes++;
+    }
+    section->storms = governor->storms;
+    section->absorbed = governor->absorbed;
+
+    telemetry_end(TELEMETRY_CORE_CM33);
+}
+
+/*******************************************************************************
+ * Function Name: telemetry_record_sleep
+ *******************************************************************************
+ * Summary:
+ * Adds the active time since the last wakeup to the telemetry histogram 
+ * before the CPU goes to sleep.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void telemetry_record_sleep(void)
+{
+    telemetry_section_t *section = telemetry_begin(TELEMETRY_CORE_CM33);
+
+    telemetry_hist_add(section, telemetry_timer_us());
+    section->sleep_entries++;
+
+    telemetry_end(TELEMETRY_CORE_CM33);
+}
+
+/*******************************************************************************
+ * Function Name: cm55_power_off_if_requested
+ *******************************************************************************
+ * Summary:
+ * Powers the CM55 off when its idle policy requested it in the telemetry 
+ * block. The CM55 cannot remove its own power, so it waits in DeepSleep 
+ * until the CM33 does.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void cm55_power_off_if_requested(void)
+{
+    telemetry_section_t cm55;
+
+    if (cm55_enabled &&
+        telemetry_read((const telemetry_block_t *)TELEMETRY_BLOCK_ADDR,
+                                            TELEMETRY_CORE_CM55, &cm55) &&
+        (0U != cm55.off_request))
+    {
+        Cy_SysDisableCM55(MXCM55);
+        cm55_enabled = false;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: lpcomp_active_level
+ *******************************************************************************
+ * Summary:
+ * Returns the comparator output level that keeps the device active, as set
+ * by the wake parameter.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: LPCOMP_OUTPUT_HIGH or LPCOMP_OUTPUT_LOW
+ *
+ ******************************************************************************/
+static uint32_t lpcomp_active_level(void)
+{
+    return ((uint8_t)CMD_WAKE_LOW == cmd_uart_get_params()->wake) ?
+                                        LPCOMP_OUTPUT_LOW : LPCOMP_OUTPUT_HIGH;
+}
+
+/*******************************************************************************
+ * Function Name: lpcomp_set_hysteresis
+ *******************************************************************************
+ * Summary:
+ * Applies the comparator hysteresis: enabled while the wake governor backs 
+ * off from a wake storm, and the calibrated setting once the back-off level 
+ * has decayed to zero.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void lpcomp_set_hysteresis(void)
+{
+    Cy_LPComp_SetHysteresis(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                wake_governor_get_hysteresis(
+                    lpcomp_calib_get_hysteresis(cmd_uart_lpcomp_power())));
+}
+
+/*******************************************************************************
+ * Function Name: lpcomp_set_power
+ *******************************************************************************
+ * Summary:
+ * Switches the comparator to the power mode set over the command interface
+ * and applies the calibration stored for that mode.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void lpcomp_set_power(void)
+{
+    Cy_LPComp_SetPower(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                                    cmd_uart_lpcomp_power(), &lpcomp_context);
+    Cy_SysLib_DelayUs(BOARD_LPCOMP_SETTLE_TIME_US);
+    (void)lpcomp_calib_apply(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                                                    cmd_uart_lpcomp_power());
+    lpcomp_set_hysteresis();
+}
+
+/*******************************************************************************
+ * Function Name: lpcomp_hibernate_wakeup_source
+ *******************************************************************************
+ * Summary:
+ * Returns the Hibernate wakeup source for the return of the comparator
+ * output to the active level.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Wakeup source for Cy_SysPm_SetHibernateWakeupSource()
+ *
+ ******************************************************************************/
+static uint32_t lpcomp_hibernate_wakeup_source(void)
+{
+    return (LPCOMP_OUTPUT_HIGH == lpcomp_active_level()) ?
+           (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH :
+           (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_LOW;
+}
+
+/*******************************************************************************
+ * Function Name: deepsleep_until_lpcomp_active
+ *******************************************************************************
+ * Summary:
+ * Stays in DeepSleep until the comparator output returns to the active level. 
+ * Used instead of Hibernate during a wake storm, so the wakeup does not pay 
+ * for a full boot.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void deepsleep_until_lpcomp_active(void)
+{
+    uint32_t interrupt_state;
+    uint32_t active_level = lpcomp_active_level();
+
+    Cy_LPComp_SetInterruptTriggerMode(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                        (LPCOMP_OUTPUT_HIGH == active_level) ?
+                        CY_LPCOMP_INTR_RISING : CY_LPCOMP_INTR_FALLING);
+    Cy_LPComp_ClearInterrupt(lpcomp_0_comp_0_HW, CY_LPCOMP_COMP0);
+    Cy_LPComp_SetInterruptMask(lpcomp_0_comp_0_HW, CY_LPCOMP_COMP0);
+
+    for (;;)
+    {
+        /* Check and sleep with interrupts masked so the edge cannot be lost */
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+        if (active_level == Cy_LPComp_GetCompare(lpcomp_0_comp_0_HW, 
+                                                        CY_LPCOMP_CHANNEL_0))
+        {
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+            break;
+        }
+
+        /* DeepSleep, or Sleep while a UART command is being received */
+        cmd_uart_sleep();
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    Cy_LPComp_SetInterruptMask(lpcomp_0_comp_0_HW, 0U);
+}
+
 /*******************************************************************************
  * Function Name: main
  *******************************************************************************
@@ -78,6 +321,8 @@ const cy_stc_sysint_t lpcomp_irq_cfg =
  * It performs the following tasks:
  * 1. System Hibernate if LP < Vref. 
  * 2. Toggle LED1 at 500ms if LP > Vref.
+ * The timing, the comparator power mode and the polarity can be changed at 
+ * runtime over the debug UART (see cmd_uart.c).
  * 
  * Parameters:
  *  void
@@ -89,16 +334,31 @@ const cy_stc_sysint_t lpcomp_irq_cfg =
 int main(void)
 {
     cy_rslt_t result;
+    const lpcomp_calib_entry_t *calib;
+    const wake_governor_state_t *governor;
+    uint32_t dwell_ms;
+    telemetry_wake_t wake_cause = TELEMETRY_WAKE_POWER_ON;
+    telemetry_section_t *telemetry;
+    fault_record_t fault;
+    bool fault_recovered;
+    cy_en_syspm_status_t pm_status;
+    const cmd_params_t *params;
+    uint32_t changed;
+
+    /* Start timing the boot for the telemetry block */
+    telemetry_timer_start();
 
     /* Initialize the device and board peripherals */
     result = cybsp_init();
 
-    /* Board initialization failed. Stop program execution. */
+    /* Board initialization failed. Record the fault and recover. */
     if (CY_RSLT_SUCCESS != result)
     {
-        handle_app_error();
+        fault_handle(FAULT_SITE_NS_BSP_INIT, result);
     }
 
+    fault_set_phase(FAULT_PHASE_INIT);
+
     /* Enable global interrupts */
     __enable_irq();
 
@@ -112,6 +372,18 @@ int main(void)
     printf("************ "
             "PSOC Edge MCU: Wakeup from Hibernate using a low-power comparator "
             "************ \r\n\n");
+    printf("Board: %s\r\n\n", BOARD_NAME);
+
+    /* Restore the wake rate history from the backup registers */
+    wake_governor_init();
+
+    /* Restore the runtime parameters and accept commands on the debug UART */
+    cmd_uart_init();
+    params = cmd_uart_get_params();
+    led_pattern_set_timing(params->period_ms, params->hold_ms);
+
+    /* A fault recorded before the last reset or Hibernate */
+    fault_recovered = fault_get_last(&fault);
 
     /* Check Reset Reason for reset when wake up from Hibernate */
     if(CY_SYSLIB_RESET_HIB_WAKEUP == (Cy_SysLib_GetResetReason() & 
@@ -121,6 +393,37 @@ int main(void)
         /* The reset has occurred on a wakeup from Hibernate power mode */
         printf("Wakeup from the Hibernate mode\r\n");
 
+        /* The fault handler waits for its back-off in Hibernate. Its RTC 
+         * alarm wakeup is not a comparator wakeup of the main loop. */
+        if (!fault_recovered)
+        {
+            wake_governor_record_wake(false);
+        }
+        wake_cause = TELEMETRY_WAKE_HIBERNATE;
+    }
+
+    /* Set up the shared telemetry block before the CM55 is started */
+    telemetry_init(TELEMETRY_CORE_CM33);
+    telemetry_record_wake(wake_cause);
+    telemetry = telemetry_begin(TELEMETRY_CORE_CM33);
+    telemetry->idle_hint_ms = BOARD_CM55_IDLE_HINT_MS;
+    telemetry_end(TELEMETRY_CORE_CM33);
+
+    governor = wake_governor_get_state();
+    if (0U != governor->storms)
+    {
+        printf("Wake storms absorbed: %u, wakeups served from DeepSleep: %u\r\n\n",
+                (unsigned int)governor->storms, (unsigned int)governor->absorbed);
+    }
+
+    /* Report the fault recorded before the last reset or Hibernate */
+    if (fault_recovered)
+    {
+        printf("Recovered from fault: site %u, status 0x%08lX, core %u, "
+               "phase %u, %u consecutive, reset reason 0x%08lX\r\n\n",
+               (unsigned int)fault.site, (unsigned long)fault.status,
+               (unsigned int)fault.core, (unsigned int)fault.phase,
+               (unsigned int)fault.count, (unsigned long)fault.reset_reason);
     }
 
     Cy_LPComp_Init(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0, 
@@ -133,48 +436,175 @@ int main(void)
     /* Enable the local reference voltage */
     Cy_LPComp_UlpReferenceEnable(lpcomp_0_comp_0_HW);
 
-    /* Low comparator power and speed */
+    /* Comparator power and speed: the board default (ULP) unless changed 
+     * over the debug UART */
     Cy_LPComp_SetPower(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0, 
-                                            CY_LPCOMP_MODE_ULP, &lpcomp_context);
+                                            cmd_uart_lpcomp_power(), &lpcomp_context);
 
     /* It needs 50 micro-seconds start-up time to settle in ULP mode after the 
      * block is enabled */
-    Cy_SysLib_DelayUs(LPCOMP_ULP_SETTLE_TIME);
+    Cy_SysLib_DelayUs(BOARD_LPCOMP_SETTLE_TIME_US);
+
+#if defined(LPCOMP_CALIB_PRODUCTION_TEST)
+    /* Calibrate against the tester ramp once, when no table is stored yet */
+    if (NULL == lpcomp_calib_get(cmd_uart_lpcomp_power()))
+    {
+        if (!lpcomp_calib_run(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                              cmd_uart_lpcomp_power(), &lpcomp_context))
+        {
+            printf("LPComp calibration failed.\r\n\n");
+        }
+    }
+#endif /* defined(LPCOMP_CALIB_PRODUCTION_TEST) */
+
+    /* Apply the stored per-device calibration of the ULP trip point */
+    calib = lpcomp_calib_apply(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0,
+                                                    cmd_uart_lpcomp_power());
+    if (NULL != calib)
+    {
+        printf("Calibrated LPComp trip point: %d mV rising, %d mV falling, "
+               "offset %d mV\r\n\n", calib->trip_rise_mv, calib->trip_fall_mv,
+               calib->offset_mv);
+    }
+
+    /* A fault from now on hibernates with the comparator wakeup armed */
+    fault_set_wakeup_source(lpcomp_hibernate_wakeup_source());
+
+    /* Wake interrupt for the DeepSleep strategy, masked until it is used */
+    Cy_SysInt_Init(&lpcomp_irq_cfg, lpcomp_isr);
+    NVIC_EnableIRQ(lpcomp_irq_cfg.intrSrc);
+
+#if defined(XIP_BENCHMARK)
+    /* Measure the XIP read path while the CM55 does not use it yet */
+    xip_benchmark_run();
+#endif /* defined(XIP_BENCHMARK) */
+
+#if defined(STRATEGY_BENCHMARK)
+    /* Compare the wait strategies on the synthetic input traces */
+    strategy_bench_run();
+#endif /* defined(STRATEGY_BENCHMARK) */
+
+#if defined(SECURE_BATCH)
+    /* Boot state of the CM33 secure project, read with one secure call */
+    secure_client_report();
+
+#if defined(SECURE_BATCH_BENCHMARK)
+    /* Compare batched and unbatched secure calls */
+    secure_client_benchmark();
+#endif /* defined(SECURE_BATCH_BENCHMARK) */
+#endif /* defined(SECURE_BATCH) */
 
     /* CM55_APP_BOOT_ADDR must be updated if CM55 memory layout is changed.*/
     Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+    cm55_enabled = true;
+
+    /* Start the MCWDT that plays the LED patterns */
+    led_pattern_init();
+
+    /* Flash the core that recorded the fault: one red flash for the CM33
+     * secure, two for the CM33 non-secure, and three for the CM55 */
+    if (fault_recovered)
+    {
+        led_pattern_play_error((uint8_t)(fault.core + 1U), FAULT_LED_PLAYS);
+        led_pattern_wait();
+    }
+
+    telemetry = telemetry_begin(TELEMETRY_CORE_CM33);
+    telemetry->boot_time_us = telemetry_timer_us();
+    telemetry_end(TELEMETRY_CORE_CM33);
+
+    /* The boot completed: restart the count of consecutive faults */
+    fault_set_phase(FAULT_PHASE_RUN);
+    fault_clear();
 
     for (;;)
     {
-        /* If the comparison result is high, toggles User LED1 every 500ms */
-        if (LPCOMP_OUTPUT_HIGH == Cy_LPComp_GetCompare(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0))
+        cm55_power_off_if_requested();
+
+        /* Execute a command received on the debug UART */
+        changed = cmd_uart_process();
+        if (0U != (changed & CMD_CHANGED_TIMING))
+        {
+            led_pattern_set_timing(params->period_ms, params->hold_ms);
+        }
+        if (0U != (changed & CMD_CHANGED_POWER))
+        {
+            lpcomp_set_power();
+        }
+        if (0U != (changed & CMD_CHANGED_WAKE))
+        {
+            fault_set_wakeup_source(lpcomp_hibernate_wakeup_source());
+        }
+
+        /* If the comparison result is at the active level (high by default), 
+         * toggles User LED1 at the configured period (500ms by default) */
+        if (lpcomp_active_level() == Cy_LPComp_GetCompare(lpcomp_0_comp_0_HW, CY_LPCOMP_CHANNEL_0))
         {
-            /* Toggle User LED1 every 500ms */
-            Cy_GPIO_Inv(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN);
-            Cy_SysLib_Delay(TOGGLE_LED_PERIOD_MS);
-            printf("In CPU Active mode, blinking USER LED1 at 500 milliseconds.\r\n\n");
+            /* Toggle User LED1. The pattern runs from the MCWDT
+             * interrupt, which also wakes the CPU at every LED edge. */
+            led_pattern_play(&led_pattern_active_blink);
+            printf("In CPU Active mode, blinking USER LED1 at %u milliseconds.\r\n\n",
+                                                (unsigned int)params->period_ms);
+
+            /* Wait for UART traffic to stop and sleep until the next edge */
+            while (cy_retarget_io_is_tx_active()) {};
+            telemetry_record_sleep();
+            cmd_uart_sleep();
+            telemetry_timer_start();
+            telemetry_record_wake(TELEMETRY_WAKE_TIMER);
         }
         else
         {
-            /* Turn on USER LED1(Red) for 2 seconds to indicate the MCU entering 
-             * Hibernate mode. */
-            Cy_GPIO_Write(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, 1);
-            Cy_SysLib_Delay(LED_ON_DUR_BEFORE_HIB_IN_MS);
-            Cy_GPIO_Write(CYBSP_USER_LED_PORT, CYBSP_USER_LED_PIN, 0);
-            printf("Turn on the USER LED1 for 2 seconds, de-initialize IO, "
-                                          "and enter System Hibernate mode. \r\n\n");
+            /* Turn on USER LED1(Red) for the hold time (2 seconds by default) 
+             * to indicate the MCU entering Hibernate mode. */
+            led_pattern_play(&led_pattern_hibernate_hold);
+            led_pattern_wait();
+
+            /* While backing off from a wake storm, widen the comparator 
+             * switching points and wait longer before re-arming the wakeup. 
+             * The calibrated hysteresis returns when the back-off ends. */
+            lpcomp_set_hysteresis();
+
+            dwell_ms = wake_governor_get_dwell_ms();
+            if (0U != dwell_ms)
+            {
+                led_pattern_play_dwell((uint16_t)dwell_ms);
+                led_pattern_wait();
+            }
+
+            if (WAKE_STRATEGY_DEEPSLEEP == wake_governor_get_strategy())
+            {
+                printf("Wake storm, back-off level %u: enter DeepSleep "
+                       "instead of Hibernate mode. \r\n\n",
+                       (unsigned int)governor->backoff);
+                while (cy_retarget_io_is_tx_active()) {};
+
+                /* Wake on the LPComp interrupt without a reset */
+                telemetry_record_sleep();
+                deepsleep_until_lpcomp_active();
+                telemetry_timer_start();
+                wake_governor_record_wake(true);
+                telemetry_record_wake(TELEMETRY_WAKE_DEEPSLEEP);
+                printf("Wakeup from the DeepSleep mode\r\n");
+                continue;
+            }
+
+            printf("Turn on the USER LED1 for %u milliseconds, de-initialize IO, "
+                   "and enter System Hibernate mode. \r\n\n",
+                   (unsigned int)params->hold_ms);
 
             /* Wait for UART traffic to stop */
             while (cy_retarget_io_is_tx_active()) {};
 
             /* Set the low-power comparator as a wake-up source from Hibernate 
              * and jump into Hibernate */
-            Cy_SysPm_SetHibernateWakeupSource((uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH);
+            Cy_SysPm_SetHibernateWakeupSource(lpcomp_hibernate_wakeup_source());
 
-            if(CY_SYSPM_SUCCESS != Cy_SysPm_SystemEnterHibernate())
+            pm_status = Cy_SysPm_SystemEnterHibernate();
+            if(CY_SYSPM_SUCCESS != pm_status)
             {
                 printf("The system did not enter Hibernate mode.\r\n\r\n");
-                handle_app_error();
+                fault_handle(FAULT_SITE_NS_HIBERNATE, (uint32_t)pm_status);
             }
         }
 
@@ -36,6 +36,7 @@
 * Header Files
 *******************************************************************************/
 #include "retarget_io_init.h"
+#include "fault.h"
 
 /*******************************************************************************
 * Global Variables
@@ -108,10 +109,10 @@ void init_retarget_io(void)
                                         &CYBSP_DEBUG_UART_config, 
                                         &DEBUG_UART_context);
     
-    /* UART initialization failed. Stop program execution. */
+    /* UART initialization failed. Record the fault and recover. */
     if (CY_RSLT_SUCCESS != result)
     {
-        handle_app_error();
+        fault_handle(FAULT_SITE_NS_UART_INIT, result);
     }
 
     /* Enable the SCB UART */
@@ -121,19 +122,19 @@ void init_retarget_io(void)
                                 &CYBSP_DEBUG_UART_hal_config, 
                                 &DEBUG_UART_context, NULL);
     
-    /* UART setup failed. Stop program execution. */
+    /* UART setup failed. Record the fault and recover. */
     if (CY_RSLT_SUCCESS != result)
     {
-        handle_app_error();
+        fault_handle(FAULT_SITE_NS_UART_SETUP, result);
     }
 
     /* Initialize retarget-io to use the debug UART port. */
     result = cy_retarget_io_init(&DEBUG_UART_hal_obj);
 
-    /* retarget-io initialization failed. Stop program execution. */
+    /* retarget-io initialization failed. Record the fault and recover. */
     if (CY_RSLT_SUCCESS != result)
     {
-        handle_app_error();
+        fault_handle(FAULT_SITE_NS_RETARGET_INIT, result);
     }
 
 #if (CY_CFG_PWR_SYS_IDLE_MODE == CY_CFG_PWR_MODE_DEEPSLEEP)
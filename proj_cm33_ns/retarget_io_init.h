@@ -61,30 +61,6 @@
 *******************************************************************************/
 void init_retarget_io(void);
 
-/*******************************************************************************
-* Function Name: handle_app_error
-********************************************************************************
-* Summary:
-* User defined error handling function
-*
-* Parameters:
-*  void
-*
-* Return:
-*  void
-*
-*******************************************************************************/
-__STATIC_INLINE void handle_app_error(void)
-{
-    /* Disable all interrupts. */
-    __disable_irq();
-
-    CY_ASSERT(0);
-
-    /* Infinite loop */
-    while(true);
-}
-
 #endif /* _RETARGET_IO_INIT_H_ */
 
 /* [] END OF FILE */
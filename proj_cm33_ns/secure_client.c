@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * File Name:   secure_client.c
+ *
+ * Description: This file contains the non-secure side of the batched secure
+ *              service interface: the boot report read from the CM33 secure
+ *              project, and the benchmark that compares batched requests
+ *              with one secure call per request.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "secure_client.h"
+#include "xip_benchmark.h"
+#include "retarget_io_init.h"
+
+#if defined(SECURE_BATCH)
+
+/*******************************************************************************
+* Function Name: secure_client_report
+********************************************************************************
+* Summary:
+* Reads the boot state of the CM33 secure project with one batch and prints
+* it.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void secure_client_report(void)
+{
+    secure_batch_t batch;
+    uint32_t status;
+
+    secure_batch_init(&batch);
+    (void)secure_batch_add(&batch, SECURE_SVC_RESET_REASON, 0U);
+    (void)secure_batch_add(&batch, SECURE_SVC_SMIF_STATUS, 0U);
+    (void)secure_batch_add(&batch, SECURE_SVC_XIP_PROFILE, 0U);
+
+    status = secure_batch_call(&batch);
+    if ((uint32_t)SECURE_STATUS_OK != status)
+    {
+        printf("Secure batch rejected, status %lu\r\n\n", (unsigned long)status);
+        return;
+    }
+
+    printf("Secure boot: reset reason 0x%08lX, SMIF status 0x%08lX, "
+           "XIP profile %lu, %lu cycles in the secure dispatcher\r\n\n",
+           (unsigned long)batch.requests[0].result,
+           (unsigned long)batch.requests[1].result,
+           (unsigned long)batch.requests[2].result,
+           (unsigned long)batch.cycles);
+}
+
+/*******************************************************************************
+* Function Name: secure_client_unbatched
+********************************************************************************
+* Summary:
+* Executes count no-op requests with one secure call each.
+*
+* Parameters:
+*  count: Number of requests
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t secure_client_unbatched(uint32_t count)
+{
+    uint32_t result;
+    uint32_t start = DWT->CYCCNT;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        (void)secure_service_call((uint32_t)SECURE_SVC_NOP, 0U, &result);
+    }
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: secure_client_batched
+********************************************************************************
+* Summary:
+* Executes count no-op requests with one secure call. The time to build the
+* batch is included.
+*
+* Parameters:
+*  count: Number of requests
+*  dispatch: Set to the cycles spent in the secure dispatcher
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t secure_client_batched(uint32_t count, uint32_t *dispatch)
+{
+    secure_batch_t batch;
+    uint32_t start = DWT->CYCCNT;
+
+    secure_batch_init(&batch);
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        (void)secure_batch_add(&batch, SECURE_SVC_NOP, 0U);
+    }
+    (void)secure_batch_call(&batch);
+
+    *dispatch = batch.cycles;
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: secure_client_benchmark
+********************************************************************************
+* Summary:
+* Measures the cost per request of 1, 2, 4 and 8 no-op requests, sent with
+* one secure call each and as one batch, and prints the report. The DWT
+* cycle counter must be enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void secure_client_benchmark(void)
+{
+    xip_benchmark_stat_t single;
+    xip_benchmark_stat_t batched;
+    xip_benchmark_stat_t dispatch;
+    uint32_t dispatch_cycles;
+    uint32_t single_avg;
+    uint32_t batched_avg;
+
+    printf("SECURE_BENCH core clock %lu Hz, %u runs\r\n",
+           (unsigned long)SystemCoreClock, (unsigned int)SECURE_CLIENT_BENCH_RUNS);
+
+    for (uint32_t count = 1U; count <= SECURE_BATCH_MAX_REQUESTS; count *= 2U)
+    {
+        single = (xip_benchmark_stat_t){ 0U };
+        batched = (xip_benchmark_stat_t){ 0U };
+        dispatch = (xip_benchmark_stat_t){ 0U };
+
+        for (uint32_t run = 0U; run < SECURE_CLIENT_BENCH_RUNS; run++)
+        {
+            xip_benchmark_stat_add(&single, secure_client_unbatched(count));
+            xip_benchmark_stat_add(&batched, secure_client_batched(count,
+                                                            &dispatch_cycles));
+            xip_benchmark_stat_add(&dispatch, dispatch_cycles);
+        }
+
+        single_avg = (uint32_t)(single.sum / single.runs);
+        batched_avg = (uint32_t)(batched.sum / batched.runs);
+
+        printf("SECURE_BENCH %lu requests: unbatched %lu, batched %lu cycles per "
+               "request, secure dispatch %lu cycles\r\n",
+               (unsigned long)count, (unsigned long)(single_avg / count),
+               (unsigned long)(batched_avg / count),
+               (unsigned long)(dispatch.sum / dispatch.runs));
+    }
+    printf("\r\n");
+}
+
+#endif /* defined(SECURE_BATCH) */
+
+/* [] END OF FILE */
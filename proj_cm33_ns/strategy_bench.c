@@ -0,0 +1,495 @@
+/*******************************************************************************
+ * File Name:   strategy_bench.c
+ *
+ * Description: This file contains the wait strategy benchmark. It replays a
+ *              comparator input trace through a model of each way of
+ *              waiting for the input to go HIGH and reports the energy, the
+ *              reaction latency and the missed pulses per strategy. The
+ *              model steps in 1 ms increments. The governed strategy runs
+ *              the rules of wake_governor.c on the time of the model, so
+ *              the same code runs on the target and on a host.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "strategy_bench.h"
+#include "wake_governor.h"
+#include <stdio.h>
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Application state in the model */
+typedef enum
+{
+    SIM_BLINK,                          /* Input seen HIGH, LED toggling */
+    SIM_WAIT,                           /* DeepSleep until the input goes HIGH */
+    SIM_HOLD,                           /* LED hold before Hibernate */
+    SIM_DWELL,                          /* Governor back-off dwell, LEDs off */
+    SIM_HIBERNATE,
+    SIM_BOOT                            /* Reset after the Hibernate wakeup */
+} sim_state_t;
+
+typedef struct
+{
+    strategy_id_t strategy;
+    const strategy_params_t *params;
+    strategy_result_t *result;
+    sim_state_t state;
+    uint32_t state_start_ms;
+    bool pending;                       /* Rising edge not reacted to yet */
+    uint32_t edge_ms;
+    wake_governor_state_t governor;     /* STRATEGY_HIBERNATE_GOVERNED only */
+} sim_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const strategy_names[STRATEGY_NUM] =
+{
+    "polled",
+    "ds_timer",
+    "interrupt",
+    "hibernate",
+    "hib_governed"
+};
+
+/*******************************************************************************
+* Function Name: strategy_bench_name
+********************************************************************************
+* Summary:
+* Returns the name of a strategy as printed in the report.
+*
+* Parameters:
+*  strategy: Strategy
+*
+* Return:
+*  const char*: Strategy name
+*
+*******************************************************************************/
+const char *strategy_bench_name(strategy_id_t strategy)
+{
+    return strategy_names[strategy];
+}
+
+/*******************************************************************************
+* Function Name: sim_enter
+********************************************************************************
+* Summary:
+* Moves the model to a new state.
+*
+* Parameters:
+*  sim: Model
+*  state: New state
+*  now_ms: Current time
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sim_enter(sim_t *sim, sim_state_t state, uint32_t now_ms)
+{
+    sim->state = state;
+    sim->state_start_ms = now_ms;
+}
+
+/*******************************************************************************
+* Function Name: sim_detect
+********************************************************************************
+* Summary:
+* Records the reaction of the application to a pending rising edge.
+*
+* Parameters:
+*  sim: Model
+*  now_ms: Current time
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sim_detect(sim_t *sim, uint32_t now_ms)
+{
+    uint32_t latency_ms;
+
+    if (!sim->pending)
+    {
+        return;
+    }
+
+    latency_ms = now_ms - sim->edge_ms;
+    sim->result->detected++;
+    sim->result->latency_sum_ms += latency_ms;
+    if (latency_ms > sim->result->latency_max_ms)
+    {
+        sim->result->latency_max_ms = latency_ms;
+    }
+    sim->pending = false;
+}
+
+/*******************************************************************************
+* Function Name: sim_count_wake
+********************************************************************************
+* Summary:
+* Records a wakeup in the governor state with the rules of wake_governor.c,
+* using the time of the model as the RTC.
+*
+* Parameters:
+*  sim: Model
+*  now_ms: Current time
+*  absorbed: true for a DeepSleep wakeup, false for a Hibernate wakeup
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sim_count_wake(sim_t *sim, uint32_t now_ms, bool absorbed)
+{
+    if (STRATEGY_HIBERNATE_GOVERNED == sim->strategy)
+    {
+        wake_governor_update(&sim->governor, now_ms / 1000U, absorbed);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_wait_state
+********************************************************************************
+* Summary:
+* Returns the state the strategy waits in when the input goes LOW.
+*
+* Parameters:
+*  sim: Model
+*
+* Return:
+*  sim_state_t: SIM_WAIT or SIM_HOLD
+*
+*******************************************************************************/
+static sim_state_t sim_wait_state(const sim_t *sim)
+{
+    if ((STRATEGY_DEEPSLEEP_TIMER == sim->strategy) ||
+        (STRATEGY_INTERRUPT == sim->strategy))
+    {
+        return SIM_WAIT;
+    }
+
+    return SIM_HOLD;
+}
+
+/*******************************************************************************
+* Function Name: sim_hold_done
+********************************************************************************
+* Summary:
+* Returns the state that follows the LED hold, as in the main loop: the
+* governed strategy waits for the back-off dwell, and then waits in DeepSleep
+* instead of Hibernate while backing off.
+*
+* Parameters:
+*  sim: Model
+*  dwell_done: true if the dwell has already been waited for
+*
+* Return:
+*  sim_state_t: SIM_DWELL, SIM_WAIT or SIM_HIBERNATE
+*
+*******************************************************************************/
+static sim_state_t sim_hold_done(const sim_t *sim, bool dwell_done)
+{
+    if (STRATEGY_HIBERNATE_GOVERNED != sim->strategy)
+    {
+        return SIM_HIBERNATE;
+    }
+
+    if (!dwell_done && (0U != wake_governor_dwell_ms(&sim->governor)))
+    {
+        return SIM_DWELL;
+    }
+
+    return (WAKE_STRATEGY_DEEPSLEEP == wake_governor_strategy(&sim->governor)) ?
+           SIM_WAIT : SIM_HIBERNATE;
+}
+
+/*******************************************************************************
+* Function Name: sim_step
+********************************************************************************
+* Summary:
+* Advances the model by 1 ms and adds the energy of that millisecond. The
+* polled strategy waits in Cy_SysLib_Delay() with the CPU active while it
+* blinks the LED and during the LED hold; the other strategies wait in
+* DeepSleep and pay one wakeup per LED toggle.
+*
+* Parameters:
+*  sim: Model
+*  now_ms: Current time
+*  level: Input level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sim_step(sim_t *sim, uint32_t now_ms, uint8_t level)
+{
+    const strategy_params_t *p = sim->params;
+    uint32_t elapsed_ms = now_ms - sim->state_start_ms;
+    uint64_t *energy_nj = &sim->result->energy_nj;
+    bool busy_wait = (STRATEGY_POLLED == sim->strategy);
+    uint32_t wait_uw = busy_wait ? p->active_uw : p->deepsleep_uw;
+
+    /* uW * 1 ms = nJ */
+    switch (sim->state)
+    {
+        case SIM_BLINK:
+            *energy_nj += wait_uw + (p->led_uw / 2U);
+            if ((0U != elapsed_ms) && (0U == (elapsed_ms % p->toggle_ms)))
+            {
+                if (!busy_wait)
+                {
+                    *energy_nj += p->wake_nj;
+                }
+                if (0U == level)
+                {
+                    sim_enter(sim, sim_wait_state(sim), now_ms);
+                }
+            }
+            break;
+
+        case SIM_WAIT:
+            *energy_nj += p->deepsleep_uw;
+            if (STRATEGY_DEEPSLEEP_TIMER == sim->strategy)
+            {
+                if ((0U != elapsed_ms) && (0U == (elapsed_ms % p->poll_ms)))
+                {
+                    *energy_nj += p->wake_nj;
+                    if (0U != level)
+                    {
+                        sim_detect(sim, now_ms);
+                        sim_enter(sim, SIM_BLINK, now_ms);
+                    }
+                }
+            }
+            else if (0U != level)
+            {
+                *energy_nj += p->wake_nj;
+                sim_count_wake(sim, now_ms, true);
+                sim_detect(sim, now_ms);
+                sim_enter(sim, SIM_BLINK, now_ms);
+            }
+            break;
+
+        case SIM_HOLD:
+            *energy_nj += wait_uw + p->led_uw;
+            if (elapsed_ms >= p->hold_ms)
+            {
+                sim_enter(sim, sim_hold_done(sim, false), now_ms);
+            }
+            break;
+
+        case SIM_DWELL:
+            *energy_nj += p->deepsleep_uw;
+            if (elapsed_ms >= wake_governor_dwell_ms(&sim->governor))
+            {
+                sim_enter(sim, sim_hold_done(sim, true), now_ms);
+            }
+            break;
+
+        case SIM_HIBERNATE:
+            /* The wakeup is level sensitive */
+            *energy_nj += p->hibernate_uw;
+            if (0U != level)
+            {
+                sim->result->resets++;
+                sim_count_wake(sim, now_ms, false);
+                sim_enter(sim, SIM_BOOT, now_ms);
+            }
+            break;
+
+        case SIM_BOOT:
+        default:
+            *energy_nj += p->active_uw;
+            if (elapsed_ms >= (p->boot_ms + p->calib_ms))
+            {
+                if (0U != level)
+                {
+                    sim_detect(sim, now_ms);
+                    sim_enter(sim, SIM_BLINK, now_ms);
+                }
+                else
+                {
+                    sim_enter(sim, sim_wait_state(sim), now_ms);
+                }
+            }
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: strategy_bench_simulate
+********************************************************************************
+* Summary:
+* Replays a trace through the model of a strategy. A rising edge counts as
+* detected when the application reacts to it, and as missed when the input
+* goes LOW again before the reaction or the trace ends.
+*
+* Parameters:
+*  strategy: Strategy to model
+*  trace: Input trace
+*  params: Power and timing of the device
+*  result: Result of the replay
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void strategy_bench_simulate(strategy_id_t strategy,
+                             const strategy_trace_t *trace,
+                             const strategy_params_t *params,
+                             strategy_result_t *result)
+{
+    sim_t sim = { 0 };
+    uint32_t next_edge = 0U;
+    uint8_t level = 0U;
+
+    *result = (strategy_result_t){ 0U };
+
+    sim.strategy = strategy;
+    sim.params = params;
+    sim.result = result;
+    wake_governor_reset(&sim.governor, 0U);
+    sim_enter(&sim, sim_wait_state(&sim), 0U);
+
+    for (uint32_t now_ms = 0U; now_ms < trace->duration_ms; now_ms++)
+    {
+        while ((next_edge < trace->num_edges) &&
+               (trace->edges[next_edge].time_ms <= now_ms))
+        {
+            uint8_t new_level = trace->edges[next_edge].level;
+
+            if ((0U == level) && (0U != new_level))
+            {
+                result->events++;
+                sim.pending = true;
+                sim.edge_ms = now_ms;
+
+                /* Already reacting to a HIGH input */
+                if (SIM_BLINK == sim.state)
+                {
+                    sim_detect(&sim, now_ms);
+                }
+            }
+            else if ((0U != level) && (0U == new_level) && sim.pending)
+            {
+                result->missed++;
+                sim.pending = false;
+            }
+
+            level = new_level;
+            next_edge++;
+        }
+
+        sim_step(&sim, now_ms, level);
+    }
+
+    if (sim.pending)
+    {
+        result->missed++;
+    }
+
+    result->absorbed = sim.governor.absorbed;
+    result->storms = sim.governor.storms;
+}
+
+/*******************************************************************************
+* Function Name: strategy_bench_report
+********************************************************************************
+* Summary:
+* Replays one trace with every parameter set through every strategy and
+* prints one line per combination.
+*
+* Parameters:
+*  trace: Input trace
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void strategy_bench_report(const strategy_trace_t *trace)
+{
+    strategy_result_t result;
+    const strategy_params_t *params;
+    uint32_t latency_avg_ms;
+
+    for (uint32_t p = 0U; p < STRATEGY_BENCH_NUM_PARAMS; p++)
+    {
+        params = &strategy_params[p];
+
+        for (uint32_t s = 0U; s < (uint32_t)STRATEGY_NUM; s++)
+        {
+            strategy_bench_simulate((strategy_id_t)s, trace, params, &result);
+
+            latency_avg_ms = (0U == result.detected) ? 0U :
+                (uint32_t)(result.latency_sum_ms / result.detected);
+
+            printf("STRATEGY %s %s %-12s: %lu uW avg, %lu uJ, "
+                   "events %lu missed %lu, latency avg %lu max %lu ms, "
+                   "resets %lu storms %lu\r\n",
+                   trace->name, params->name, strategy_bench_name((strategy_id_t)s),
+                   (unsigned long)(result.energy_nj / trace->duration_ms),
+                   (unsigned long)(result.energy_nj / 1000U),
+                   (unsigned long)result.events, (unsigned long)result.missed,
+                   (unsigned long)latency_avg_ms,
+                   (unsigned long)result.latency_max_ms,
+                   (unsigned long)result.resets,
+                   (unsigned long)result.storms);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: strategy_bench_run
+********************************************************************************
+* Summary:
+* Prints the report of every built-in trace.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void strategy_bench_run(void)
+{
+    for (uint32_t t = 0U; t < STRATEGY_BENCH_NUM_TRACES; t++)
+    {
+        strategy_bench_report(&strategy_traces[t]);
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * File Name:   strategy_bench.h
+ *
+ * Description: This file is the public interface of strategy_bench.c and
+ *              strategy_traces.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _STRATEGY_BENCH_H_
+#define _STRATEGY_BENCH_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of built-in traces and parameter sets */
+#define STRATEGY_BENCH_NUM_TRACES       (2U)
+#define STRATEGY_BENCH_NUM_PARAMS       (5U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Ways of waiting for the input to go HIGH */
+typedef enum
+{
+    STRATEGY_POLLED             = 0,    /* Original loop: Cy_SysLib_Delay() while HIGH,
+                                         * busy-wait LED hold, then Hibernate */
+    STRATEGY_DEEPSLEEP_TIMER    = 1,    /* DeepSleep with periodic timer checks */
+    STRATEGY_INTERRUPT          = 2,    /* DeepSleep with the LPComp interrupt */
+    STRATEGY_HIBERNATE          = 3,    /* LED hold, then Hibernate with LPComp wakeup */
+    STRATEGY_HIBERNATE_GOVERNED = 4,    /* Hibernate with the rules of wake_governor.c */
+    STRATEGY_NUM                = 5
+} strategy_id_t;
+
+/* Input edge of a trace */
+typedef struct
+{
+    uint32_t time_ms;                   /* Time from the start of the trace */
+    uint8_t level;                      /* Input level from this edge on */
+} strategy_edge_t;
+
+/* Comparator input trace. The input is LOW before the first edge. */
+typedef struct
+{
+    const char *name;
+    const strategy_edge_t *edges;
+    uint32_t num_edges;
+    uint32_t duration_ms;
+} strategy_trace_t;
+
+/* Power and timing of the device. Power in uW, energy in nJ. */
+typedef struct
+{
+    const char *name;
+    uint32_t active_uw;                 /* CPU running */
+    uint32_t deepsleep_uw;              /* DeepSleep with LPComp enabled */
+    uint32_t hibernate_uw;              /* Hibernate with LPComp enabled */
+    uint32_t led_uw;                    /* One LED on */
+    uint32_t wake_nj;                   /* One DeepSleep wakeup and check */
+    uint32_t toggle_ms;                 /* LED toggle period, input HIGH */
+    uint32_t poll_ms;                   /* Check period of STRATEGY_DEEPSLEEP_TIMER */
+    uint32_t hold_ms;                   /* LED hold before Hibernate */
+    uint32_t boot_ms;                   /* Reset to main loop after Hibernate */
+    uint32_t calib_ms;                  /* LPComp calibration sweep in each boot */
+} strategy_params_t;
+
+/* Result of one strategy on one trace */
+typedef struct
+{
+    uint64_t energy_nj;
+    uint32_t events;                    /* Rising edges in the trace */
+    uint32_t detected;                  /* Rising edges the application reacted to */
+    uint32_t missed;                    /* Pulses that ended before the reaction */
+    uint32_t resets;                    /* Wakeups from Hibernate */
+    uint32_t absorbed;                  /* Governed: wakeups served from DeepSleep */
+    uint32_t storms;                    /* Governed: wake storms detected */
+    uint32_t latency_max_ms;
+    uint64_t latency_sum_ms;
+} strategy_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const strategy_trace_t strategy_traces[STRATEGY_BENCH_NUM_TRACES];
+extern const strategy_params_t strategy_params[STRATEGY_BENCH_NUM_PARAMS];
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+const char *strategy_bench_name(strategy_id_t strategy);
+void strategy_bench_simulate(strategy_id_t strategy,
+                             const strategy_trace_t *trace,
+                             const strategy_params_t *params,
+                             strategy_result_t *result);
+void strategy_bench_report(const strategy_trace_t *trace);
+void strategy_bench_run(void);
+
+#endif /* _STRATEGY_BENCH_H_ */
+
+/* [] END OF FILE */
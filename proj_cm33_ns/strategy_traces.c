@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * File Name:   strategy_traces.c
+ *
+ * Description: This file contains the comparator input traces and the
+ *              device parameter sets replayed by the wait strategy
+ *              benchmark. The built-in traces are synthetic: the edges
+ *              were written by hand to model sparse activity and an input
+ *              hovering around the threshold. Captures of P10_4 exported
+ *              from a logic analyzer as lists of input edges can be added
+ *              in the same format.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "strategy_bench.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TRACE_NUM_EDGES(edges)      ((uint32_t)(sizeof(edges) / sizeof((edges)[0])))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Synthetic: ten minutes with a few long HIGH periods */
+static const strategy_edge_t trace_synth_sparse_edges[] =
+{
+    {  30230U, 1U }, {  35230U, 0U },
+    { 140710U, 1U }, { 143210U, 0U },
+    { 260090U, 1U }, { 268090U, 0U },
+    { 380455U, 1U }, { 381655U, 0U },
+    { 500320U, 1U }, { 503320U, 0U }
+};
+
+/* Synthetic: two minutes of an input hovering around the threshold: bursts of short
+ * pulses, one long HIGH period and a train of pulses fast enough to cause a
+ * wake storm */
+static const strategy_edge_t trace_synth_chatter_edges[] =
+{
+    {  10000U, 1U }, {  10040U, 0U },
+    {  10300U, 1U }, {  10650U, 0U },
+    {  11000U, 1U }, {  11020U, 0U },
+    {  11500U, 1U }, {  11900U, 0U },
+    {  12400U, 1U }, {  12450U, 0U },
+    {  13100U, 1U }, {  13180U, 0U },
+    {  14000U, 1U }, {  14300U, 0U },
+    {  30170U, 1U }, {  36170U, 0U },
+    {  40000U, 1U }, {  40100U, 0U },
+    {  42500U, 1U }, {  42600U, 0U },
+    {  45000U, 1U }, {  45100U, 0U },
+    {  47500U, 1U }, {  47600U, 0U },
+    {  50000U, 1U }, {  50100U, 0U },
+    {  52500U, 1U }, {  52600U, 0U },
+    {  55000U, 1U }, {  55100U, 0U },
+    {  60000U, 1U }, {  60030U, 0U },
+    {  60500U, 1U }, {  60900U, 0U },
+    {  61200U, 1U }, {  61250U, 0U },
+    {  62000U, 1U }, {  62700U, 0U },
+    {  63300U, 1U }, {  63320U, 0U },
+    {  90210U, 1U }, {  90310U, 0U },
+    {  95380U, 1U }, {  95580U, 0U }
+};
+
+const strategy_trace_t strategy_traces[STRATEGY_BENCH_NUM_TRACES] =
+{
+    { "synth_sparse",  trace_synth_sparse_edges,
+      TRACE_NUM_EDGES(trace_synth_sparse_edges),  600000U },
+    { "synth_chatter", trace_synth_chatter_edges,
+      TRACE_NUM_EDGES(trace_synth_chatter_edges), 120000U }
+};
+
+/* Estimates for a first comparison; replace with values measured on the
+ * board. "baseline" is the wake path without the optimizations of this
+ * example: the default XIP profile, the CM55 left running, and a trip point
+ * calibration sweep (LPCOMP_CALIB_RAMP_DURATION_MS) in every boot. Each of
+ * the next sets applies one optimization to the baseline, and "optimized"
+ * applies all of them:
+ * - xip_perf: XIP_PROFILE_PERFORMANCE merges the XIP reads of the boot and of
+ *   each wakeup, which shortens both
+ * - cm55_off: the idle policy powers the CM55 off, which removes its share of
+ *   the active and DeepSleep power
+ * - calib_table: the calibration stored in m33_calib is applied instead of
+ *   running the sweep */
+const strategy_params_t strategy_params[STRATEGY_BENCH_NUM_PARAMS] =
+{
+    {
+        .name           = "baseline",
+        .active_uw      = 20000U,
+        .deepsleep_uw   = 50U,
+        .hibernate_uw   = 3U,
+        .led_uw         = 3300U,
+        .wake_nj        = 2000U,
+        .toggle_ms      = 500U,
+        .poll_ms        = 500U,
+        .hold_ms        = 2000U,
+        .boot_ms        = 250U,
+        .calib_ms       = 1024U
+    },
+    {
+        .name           = "xip_perf",
+        .active_uw      = 20000U,
+        .deepsleep_uw   = 50U,
+        .hibernate_uw   = 3U,
+        .led_uw         = 3300U,
+        .wake_nj        = 1700U,
+        .toggle_ms      = 500U,
+        .poll_ms        = 500U,
+        .hold_ms        = 2000U,
+        .boot_ms        = 210U,
+        .calib_ms       = 1024U
+    },
+    {
+        .name           = "cm55_off",
+        .active_uw      = 15000U,
+        .deepsleep_uw   = 35U,
+        .hibernate_uw   = 3U,
+        .led_uw         = 3300U,
+        .wake_nj        = 1500U,
+        .toggle_ms      = 500U,
+        .poll_ms        = 500U,
+        .hold_ms        = 2000U,
+        .boot_ms        = 250U,
+        .calib_ms       = 1024U
+    },
+    {
+        .name           = "calib_table",
+        .active_uw      = 20000U,
+        .deepsleep_uw   = 50U,
+        .hibernate_uw   = 3U,
+        .led_uw         = 3300U,
+        .wake_nj        = 2000U,
+        .toggle_ms      = 500U,
+        .poll_ms        = 500U,
+        .hold_ms        = 2000U,
+        .boot_ms        = 250U,
+        .calib_ms       = 0U
+    },
+    {
+        .name           = "optimized",
+        .active_uw      = 15000U,
+        .deepsleep_uw   = 35U,
+        .hibernate_uw   = 3U,
+        .led_uw         = 3300U,
+        .wake_nj        = 1300U,
+        .toggle_ms      = 500U,
+        .poll_ms        = 500U,
+        .hold_ms        = 2000U,
+        .boot_ms        = 210U,
+        .calib_ms       = 0U
+    }
+};
+
+/* [] END OF FILE */
@@ -0,0 +1,367 @@
+/*******************************************************************************
+ * File Name:   wake_governor.c
+ *
+ * Description: This file contains the wake rate governor. It tracks the
+ *              recent wakeups in the backup registers and backs off to
+ *              cheaper low-power strategies when the input hovers around
+ *              the comparator threshold and causes a wake storm.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "wake_governor.h"
+#include "retained_data.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define WAKE_GOVERNOR_MAGIC             (0x5747U)
+
+#define SECONDS_PER_MINUTE              (60UL)
+#define SECONDS_PER_HOUR                (3600UL)
+#define SECONDS_PER_DAY                 (86400UL)
+#define DAYS_PER_YEAR                   (365UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static wake_governor_state_t governor;
+
+/* Days before the first of each month in a non-leap year */
+static const uint16_t days_before_month[12] =
+{
+    0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
+/*******************************************************************************
+* Function Name: governor_now_s
+********************************************************************************
+* Summary:
+* Returns the RTC time in seconds since 1 January 2000. The RTC keeps running
+* in Hibernate mode, so the value is comparable across wakeups.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Seconds since 1 January 2000
+*
+*******************************************************************************/
+static uint32_t governor_now_s(void)
+{
+    cy_stc_rtc_config_t now;
+    uint32_t days;
+
+    Cy_RTC_GetDateAndTime(&now);
+
+    days = (now.year * DAYS_PER_YEAR) + ((now.year + 3UL) / 4UL) +
+           days_before_month[now.month - 1UL] + (now.date - 1UL);
+
+    /* Leap day of the current year */
+    if ((0UL == (now.year % 4UL)) && (now.month > 2UL))
+    {
+        days++;
+    }
+
+    return (days * SECONDS_PER_DAY) + (now.hour * SECONDS_PER_HOUR) +
+           (now.min * SECONDS_PER_MINUTE) + now.sec;
+}
+
+/*******************************************************************************
+* Function Name: governor_store
+********************************************************************************
+* Summary:
+* Writes the governor state to the backup registers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void governor_store(void)
+{
+    Cy_SysPm_BackupWordStore(RETAINED_GOVERNOR_WORD, (uint32_t *)&governor,
+                             RETAINED_GOVERNOR_NUM_WORDS);
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_reset
+********************************************************************************
+* Summary:
+* Resets a governor state: no back-off, and a new window starting now.
+*
+* Parameters:
+*  state: Governor state
+*  now_s: Current time in seconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_governor_reset(wake_governor_state_t *state, uint32_t now_s)
+{
+    state->window_start_s = now_s;
+    state->window_wakes = 0U;
+    state->backoff = 0U;
+    state->storms = 0U;
+    state->absorbed = 0U;
+    state->magic = WAKE_GOVERNOR_MAGIC;
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_update
+********************************************************************************
+* Summary:
+* Records a wakeup in a governor state. When a window ends, the back-off
+* level is lowered by one for every window that stayed within the budget.
+* The wakeup that first exceeds the budget in a window counts as a storm and
+* raises the back-off level. The function has no device dependencies, so
+* the wait strategy benchmark runs the same rules on its simulated time.
+*
+* Parameters:
+*  state: Governor state
+*  now_s: Current time in seconds
+*  absorbed: true if the wakeup was served from DeepSleep without a boot
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_governor_update(wake_governor_state_t *state, uint32_t now_s,
+                          bool absorbed)
+{
+    /* The clock moving backwards also starts a new window */
+    if ((now_s < state->window_start_s) ||
+        ((now_s - state->window_start_s) >= WAKE_GOVERNOR_WINDOW_S))
+    {
+        uint32_t quiet = (now_s < state->window_start_s) ? 1U :
+                         ((now_s - state->window_start_s) / WAKE_GOVERNOR_WINDOW_S);
+
+        /* A storm window does not count as a quiet one */
+        if (state->window_wakes > WAKE_GOVERNOR_BUDGET)
+        {
+            quiet--;
+        }
+
+        state->backoff = (quiet >= state->backoff) ? 0U :
+                         (uint8_t)(state->backoff - quiet);
+        state->window_start_s = now_s;
+        state->window_wakes = 0U;
+    }
+
+    if (state->window_wakes < UINT8_MAX)
+    {
+        state->window_wakes++;
+    }
+
+    if ((WAKE_GOVERNOR_BUDGET + 1U) == state->window_wakes)
+    {
+        state->storms++;
+        if (state->backoff < WAKE_GOVERNOR_MAX_BACKOFF)
+        {
+            state->backoff++;
+        }
+    }
+
+    if (absorbed)
+    {
+        state->absorbed++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_strategy
+********************************************************************************
+* Summary:
+* Returns the low-power strategy for a governor state. During a wake storm,
+* DeepSleep avoids paying the secure boot and SMIF bring-up cost on every
+* wakeup.
+*
+* Parameters:
+*  state: Governor state
+*
+* Return:
+*  wake_strategy_t: Strategy to use
+*
+*******************************************************************************/
+wake_strategy_t wake_governor_strategy(const wake_governor_state_t *state)
+{
+    return (0U == state->backoff) ? WAKE_STRATEGY_HIBERNATE :
+                                    WAKE_STRATEGY_DEEPSLEEP;
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_dwell_ms
+********************************************************************************
+* Summary:
+* Returns the extra time to wait before re-arming the wakeup source for a
+* governor state.
+*
+* Parameters:
+*  state: Governor state
+*
+* Return:
+*  uint32_t: Dwell in milliseconds, zero when not backing off
+*
+*******************************************************************************/
+uint32_t wake_governor_dwell_ms(const wake_governor_state_t *state)
+{
+    return WAKE_GOVERNOR_DWELL_BASE_MS * ((1UL << state->backoff) - 1UL);
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_init
+********************************************************************************
+* Summary:
+* Restores the governor state from the backup registers. The state is reset
+* if the backup registers do not hold a valid state, for example after a
+* power-on reset.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_governor_init(void)
+{
+    Cy_SysPm_BackupWordReStore(RETAINED_GOVERNOR_WORD, (uint32_t *)&governor,
+                               RETAINED_GOVERNOR_NUM_WORDS);
+
+    if ((WAKE_GOVERNOR_MAGIC != governor.magic) ||
+        (governor.backoff > WAKE_GOVERNOR_MAX_BACKOFF))
+    {
+        wake_governor_reset(&governor, governor_now_s());
+        governor_store();
+    }
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_record_wake
+********************************************************************************
+* Summary:
+* Records a wakeup caused by the comparator at the RTC time and writes the
+* state to the backup registers.
+*
+* Parameters:
+*  absorbed: true if the wakeup was served from DeepSleep without a boot
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_governor_record_wake(bool absorbed)
+{
+    wake_governor_update(&governor, governor_now_s(), absorbed);
+    governor_store();
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_get_strategy
+********************************************************************************
+* Summary:
+* Returns the low-power strategy to use while the input is below the
+* reference.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  wake_strategy_t: Strategy to use
+*
+*******************************************************************************/
+wake_strategy_t wake_governor_get_strategy(void)
+{
+    return wake_governor_strategy(&governor);
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_get_dwell_ms
+********************************************************************************
+* Summary:
+* Returns the extra time to wait before re-arming the wakeup source.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Dwell in milliseconds, zero when not backing off
+*
+*******************************************************************************/
+uint32_t wake_governor_get_dwell_ms(void)
+{
+    return wake_governor_dwell_ms(&governor);
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_get_hysteresis
+********************************************************************************
+* Summary:
+* Returns the comparator hysteresis setting. Hysteresis is enabled to move
+* the switching points apart while backing off, and the calibrated setting
+* is returned once the back-off level has decayed to zero. The back-off
+* level is retained in Hibernate, so the caller applies the result before
+* every low-power entry rather than only when a storm starts.
+*
+* Parameters:
+*  calibrated: Setting chosen by the calibration, used when not backing off
+*
+* Return:
+*  cy_en_lpcomp_hyst_t: Hysteresis setting to apply
+*
+*******************************************************************************/
+cy_en_lpcomp_hyst_t wake_governor_get_hysteresis(cy_en_lpcomp_hyst_t calibrated)
+{
+    return (0U != governor.backoff) ? CY_LPCOMP_HYST_ENABLE : calibrated;
+}
+
+/*******************************************************************************
+* Function Name: wake_governor_get_state
+********************************************************************************
+* Summary:
+* Returns the governor state, including the storm counters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  const wake_governor_state_t*: Governor state
+*
+*******************************************************************************/
+const wake_governor_state_t *wake_governor_get_state(void)
+{
+    return &governor;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * File Name:   wake_governor.h
+ *
+ * Description: This file is the public interface of wake_governor.c and
+ *              contains the wake rate budget.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _WAKE_GOVERNOR_H_
+#define _WAKE_GOVERNOR_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Wake rate budget: more than WAKE_GOVERNOR_BUDGET wakeups within
+ * WAKE_GOVERNOR_WINDOW_S seconds is treated as a wake storm. */
+#define WAKE_GOVERNOR_WINDOW_S          (60U)
+#define WAKE_GOVERNOR_BUDGET            (4U)
+
+/* Each storm raises the back-off level by one, each quiet window lowers it */
+#define WAKE_GOVERNOR_MAX_BACKOFF       (3U)
+
+/* Extra dwell before re-arming the wakeup source is
+ * WAKE_GOVERNOR_DWELL_BASE_MS * (2^backoff - 1) */
+#define WAKE_GOVERNOR_DWELL_BASE_MS     (2000U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Low-power strategy used while the input is below the reference */
+typedef enum
+{
+    WAKE_STRATEGY_HIBERNATE = 0,    /* Hibernate, full boot on wakeup */
+    WAKE_STRATEGY_DEEPSLEEP = 1     /* DeepSleep with the LPComp interrupt */
+} wake_strategy_t;
+
+/* Governor state, kept in the backup registers */
+typedef struct
+{
+    uint32_t window_start_s;    /* RTC time at which the current window began */
+    uint8_t  window_wakes;      /* Wakeups in the current window */
+    uint8_t  backoff;           /* Current back-off level */
+    uint16_t storms;            /* Number of wake storms detected */
+    uint16_t absorbed;          /* Wakeups served from DeepSleep instead of a boot */
+    uint16_t magic;
+} wake_governor_state_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void wake_governor_reset(wake_governor_state_t *state, uint32_t now_s);
+void wake_governor_update(wake_governor_state_t *state, uint32_t now_s,
+                          bool absorbed);
+wake_strategy_t wake_governor_strategy(const wake_governor_state_t *state);
+uint32_t wake_governor_dwell_ms(const wake_governor_state_t *state);
+
+void wake_governor_init(void);
+void wake_governor_record_wake(bool absorbed);
+wake_strategy_t wake_governor_get_strategy(void);
+uint32_t wake_governor_get_dwell_ms(void);
+cy_en_lpcomp_hyst_t wake_governor_get_hysteresis(cy_en_lpcomp_hyst_t calibrated);
+const wake_governor_state_t *wake_governor_get_state(void);
+
+#endif /* _WAKE_GOVERNOR_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * File Name:   xip_benchmark.c
+ *
+ * Description: This file contains the XIP benchmark mode. It times
+ *              sequential reads, random reads and code execution from the
+ *              external flash and prints a report on the debug UART, so
+ *              that the XIP profiles of the CM33 secure project can be
+ *              compared.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "xip_benchmark.h"
+#include "retarget_io_init.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Numerical Recipes LCG constants */
+#define XIP_BENCHMARK_LCG_MUL           (1664525UL)
+#define XIP_BENCHMARK_LCG_INC           (1013904223UL)
+#define XIP_BENCHMARK_LCG_SEED          (0x12345678UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Keeps the reads from being optimized away */
+static volatile uint32_t xip_benchmark_sink;
+
+/*******************************************************************************
+* Function Name: xip_benchmark_stat_add
+********************************************************************************
+* Summary:
+* Adds the cycle count of one run to the statistics of a test.
+*
+* Parameters:
+*  stat: Statistics of the test
+*  cycles: Cycle count of the run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void xip_benchmark_stat_add(xip_benchmark_stat_t *stat, uint32_t cycles)
+{
+    if ((0U == stat->runs) || (cycles < stat->min))
+    {
+        stat->min = cycles;
+    }
+    if ((0U == stat->runs) || (cycles > stat->max))
+    {
+        stat->max = cycles;
+    }
+    stat->sum += cycles;
+    stat->runs++;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_seq_read
+********************************************************************************
+* Summary:
+* Reads XIP_BENCHMARK_SEQ_BYTES sequentially in words.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t xip_benchmark_seq_read(void)
+{
+    const volatile uint32_t *src = (const volatile uint32_t *)XIP_BENCHMARK_REGION_ADDR;
+    uint32_t acc = 0U;
+    uint32_t start = DWT->CYCCNT;
+
+    for (uint32_t i = 0U; i < (XIP_BENCHMARK_SEQ_BYTES / sizeof(uint32_t)); i++)
+    {
+        acc += src[i];
+    }
+
+    xip_benchmark_sink = acc;
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_random_read
+********************************************************************************
+* Summary:
+* Reads XIP_BENCHMARK_RANDOM_READS words at pseudo-random offsets. The same
+* sequence of offsets is used in every run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t xip_benchmark_random_read(void)
+{
+    const volatile uint32_t *src = (const volatile uint32_t *)XIP_BENCHMARK_REGION_ADDR;
+    uint32_t seed = XIP_BENCHMARK_LCG_SEED;
+    uint32_t acc = 0U;
+    uint32_t start = DWT->CYCCNT;
+
+    for (uint32_t i = 0U; i < XIP_BENCHMARK_RANDOM_READS; i++)
+    {
+        seed = (seed * XIP_BENCHMARK_LCG_MUL) + XIP_BENCHMARK_LCG_INC;
+        acc += src[(seed >> 8U) % (XIP_BENCHMARK_RANDOM_SPAN / sizeof(uint32_t))];
+    }
+
+    xip_benchmark_sink = acc;
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_code_exec
+********************************************************************************
+* Summary:
+* Runs a branchy integer kernel. This function is placed in the external
+* flash with the rest of the application code, so its run time includes the
+* instruction fetches over the XIP path.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t xip_benchmark_code_exec(void)
+{
+    uint32_t acc = XIP_BENCHMARK_LCG_SEED;
+    uint32_t start = DWT->CYCCNT;
+
+    for (uint32_t i = 0U; i < XIP_BENCHMARK_CODE_LOOPS; i++)
+    {
+        switch (acc & 3U)
+        {
+            case 0U:
+                acc = (acc * XIP_BENCHMARK_LCG_MUL) + i;
+                break;
+            case 1U:
+                acc ^= (acc << 7U) | (acc >> 25U);
+                break;
+            case 2U:
+                acc += XIP_BENCHMARK_LCG_INC ^ i;
+                break;
+            default:
+                acc = (acc >> 3U) - i;
+                break;
+        }
+    }
+
+    xip_benchmark_sink = acc;
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_report
+********************************************************************************
+* Summary:
+* Prints the statistics of one test. For read tests, the throughput at the
+* average cycle count is printed as well.
+*
+* Parameters:
+*  name: Test name
+*  stat: Statistics of the test
+*  bytes: Bytes read per run, 0 for the code execution test
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void xip_benchmark_report(const char *name,
+                                 const xip_benchmark_stat_t *stat,
+                                 uint32_t bytes)
+{
+    uint32_t avg = (uint32_t)(stat->sum / stat->runs);
+    uint32_t kbps = 0U;
+
+    if ((0U != bytes) && (0U != avg))
+    {
+        kbps = (uint32_t)(((uint64_t)bytes * SystemCoreClock) / ((uint64_t)avg * 1024U));
+    }
+
+    printf("XIP_BENCH %-10s min %lu avg %lu max %lu cycles, %lu KB/s\r\n", name,
+           (unsigned long)stat->min, (unsigned long)avg,
+           (unsigned long)stat->max, (unsigned long)kbps);
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_run
+********************************************************************************
+* Summary:
+* Runs every test XIP_BENCHMARK_RUNS times and prints the report. The DWT
+* cycle counter must be enabled. Must be called before the CM55 is enabled,
+* so that its instruction fetches do not compete for the XIP path.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void xip_benchmark_run(void)
+{
+    xip_benchmark_stat_t seq = { 0U };
+    xip_benchmark_stat_t random = { 0U };
+    xip_benchmark_stat_t code = { 0U };
+
+    for (uint32_t run = 0U; run < XIP_BENCHMARK_RUNS; run++)
+    {
+        xip_benchmark_stat_add(&seq, xip_benchmark_seq_read());
+        xip_benchmark_stat_add(&random, xip_benchmark_random_read());
+        xip_benchmark_stat_add(&code, xip_benchmark_code_exec());
+    }
+
+    printf("XIP_BENCH core clock %lu Hz, %u runs\r\n",
+           (unsigned long)SystemCoreClock, (unsigned int)XIP_BENCHMARK_RUNS);
+    xip_benchmark_report("seq_read", &seq, XIP_BENCHMARK_SEQ_BYTES);
+    xip_benchmark_report("rand_read", &random,
+                         XIP_BENCHMARK_RANDOM_READS * sizeof(uint32_t));
+    xip_benchmark_report("code_exec", &code, 0U);
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
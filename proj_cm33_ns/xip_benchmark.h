@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * File Name:   xip_benchmark.h
+ *
+ * Description: This file is the public interface of xip_benchmark.c and
+ *              contains the benchmark parameters.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _XIP_BENCHMARK_H_
+#define _XIP_BENCHMARK_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* External flash region read by the benchmark: the CM55 image, which is
+ * mapped for XIP and not yet executed when the benchmark runs */
+#define XIP_BENCHMARK_REGION_ADDR       (CYMEM_CM33_0_m55_nvm_START)
+
+/* Bytes read sequentially per run */
+#define XIP_BENCHMARK_SEQ_BYTES         (64UL * 1024UL)
+
+/* Word reads at random offsets per run, spread over XIP_BENCHMARK_RANDOM_SPAN */
+#define XIP_BENCHMARK_RANDOM_READS      (4096UL)
+#define XIP_BENCHMARK_RANDOM_SPAN       (1024UL * 1024UL)
+
+/* Iterations of the code execution kernel per run */
+#define XIP_BENCHMARK_CODE_LOOPS        (10000UL)
+
+/* Runs per test; the report shows min, average and max */
+#define XIP_BENCHMARK_RUNS              (8U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Aggregated cycle counts of one test */
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t runs;
+} xip_benchmark_stat_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void xip_benchmark_stat_add(xip_benchmark_stat_t *stat, uint32_t cycles);
+void xip_benchmark_run(void);
+
+#endif /* _XIP_BENCHMARK_H_ */
+
+/* [] END OF FILE */
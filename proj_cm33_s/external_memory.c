@@ -41,6 +41,7 @@
  ******************************************************************************/
 
 #include "external_memory.h"
+#include "xip_profile.h"
 #include "cy_smif_memslot.h"
 #include "cybsp.h"
 
@@ -62,6 +63,9 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
 {
     cy_en_smif_status_t smif_status = CY_SMIF_GENERAL_ERROR;
 
+    /* Memory configuration with the selected XIP profile applied */
+    const cy_stc_smif_block_config_t *block_config = xip_profile_apply(&smifBlockConfig);
+
     do
     {
         /* De-initialize the SMIF core */
@@ -69,7 +73,7 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
 
         /* Reset the external memory connected to the SMIF core */
         Cy_SMIF_Reset_Memory(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                             smifBlockConfig.memConfig[0]->slaveSelect);
+                             block_config->memConfig[0]->slaveSelect);
 
         /* Initialize the SMIF core with the provided configuration */
         smif_status = Cy_SMIF_Init(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
@@ -84,15 +88,15 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
 
         /* Set the data select signal for the memory device */
         Cy_SMIF_SetDataSelect(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                              smifBlockConfig.memConfig[0]->slaveSelect,
-                              smifBlockConfig.memConfig[0]->dataSelect);
+                              block_config->memConfig[0]->slaveSelect,
+                              block_config->memConfig[0]->dataSelect);
 
         /* Enable the SMIF core */
         Cy_SMIF_Enable(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base, &SMIFContext);
 
         /* Initialize the external memory device */
         smif_status = Cy_SMIF_MemInit(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                                      &smifBlockConfig, &SMIFContext);
+                                      block_config, &SMIFContext);
 
         if (CY_SMIF_SUCCESS != smif_status)
         {
@@ -106,7 +110,7 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
 
             /* Check if QUAD Mode is already enabled */
             smif_status = Cy_SMIF_MemIsQuadEnabled(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                                                  smifBlockConfig.memConfig[0], &qe_status, &SMIFContext);
+                                                  block_config->memConfig[0], &qe_status, &SMIFContext);
 
             if (smif_status != CY_SMIF_SUCCESS)
             {
@@ -118,7 +122,7 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
             if (!qe_status)
             {
                 smif_status = Cy_SMIF_MemQuadEnable(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                                                  smifBlockConfig.memConfig[0], &SMIFContext);
+                                                  block_config->memConfig[0], &SMIFContext);
 
                 if (smif_status != CY_SMIF_SUCCESS)
                 {
@@ -130,11 +134,11 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
         else
         {
             /* Get the desired data rate for the memory device */
-            cy_en_smif_data_rate_t data_rate = smifBlockConfig.memConfig[0]->deviceCfg->readCmd->dataRate;
+            cy_en_smif_data_rate_t data_rate = block_config->memConfig[0]->deviceCfg->readCmd->dataRate;
 
             /* Enable OCTAL mode for the memory device */
             smif_status = Cy_SMIF_MemOctalEnable(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
-                                                smifBlockConfig.memConfig[0], data_rate, &SMIFContext);
+                                                block_config->memConfig[0], data_rate, &SMIFContext);
 
             if (CY_SMIF_SUCCESS != smif_status)
             {
@@ -149,7 +153,7 @@ cy_en_smif_status_t external_memory_init(en_ext_mem_t mode)
 
                 smif_status = Cy_SMIF_SetRxCaptureMode(CYBSP_SMIF_CORE_0_XSPI_FLASH_hal_config.base,
                                                       CY_SMIF_SEL_XSPI_HYPERBUS_WITH_DQS,
-                                                      smifBlockConfig.memConfig[0]->slaveSelect);
+                                                      block_config->memConfig[0]->slaveSelect);
 
                 if (CY_SMIF_SUCCESS != smif_status)
                 {
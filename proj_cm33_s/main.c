@@ -39,11 +39,14 @@
 #include "cy_pdl.h"
 #include "cybsp.h"
 #include "external_memory.h"
+#include "fault.h"
+#include "secure_services.h"
 
 /*****************************************************************************
 * Macros
 ******************************************************************************/
 #define CM33_NS_APP_BOOT_ADDR      (CYMEM_CM33_0_m33_nvm_START + CYBSP_MCUBOOT_HEADER_SIZE) 
+#define AIRCR_VECTKEY              (0x05FAUL)
 /*****************************************************************************
 * Function Name: main
 ******************************************************************************
@@ -81,19 +84,14 @@ int main(void)
     /* Set up internal routing, pins, and clock-to-peripheral connections */
     result = cybsp_init();
 
-    /* Board initialization failed. Stop program execution */
+    /* Board initialization failed. Record the fault and recover */
     if (CY_RSLT_SUCCESS != result)
     {
-        /* Disable all interrupts. */
-        __disable_irq();
-
-        CY_ASSERT(0);
-        
-        /* Infinite loop */
-        while(true);
-
+        fault_handle(FAULT_SITE_S_BSP_INIT, result);
     }
 
+    fault_set_phase(FAULT_PHASE_INIT);
+
     /* Enable global interrupts */
     __enable_irq();
 
@@ -125,13 +123,7 @@ int main(void)
     status = external_memory_init(QSPI);
     if(CY_SMIF_SUCCESS != status)
     {
-        /* Disable all interrupts. */
-        __disable_irq();
-
-        CY_ASSERT(0);
-        
-        /* Infinite loop */
-        while(true);
+        fault_handle(FAULT_SITE_S_SMIF_INIT, (uint32_t)status);
     }
 
     /* Initialize MPC and PPC before executing non-secure application */
@@ -140,30 +132,37 @@ int main(void)
     result = Cy_MPC_Init();
     if (CY_RSLT_SUCCESS != result)
     {
-        CY_ASSERT(0);
-
-        /* Infinite loop */
-        while(true);
+        fault_handle(FAULT_SITE_S_MPC_INIT, result);
     }
 
     /* Peripheral protection initialization (PPC0) */
     result = Cy_PPC0_Init();
     if (CY_RSLT_SUCCESS != result)
     {
-        CY_ASSERT(0);
-
-        /* Infinite loop */
-        while(true);
+        fault_handle(FAULT_SITE_S_PPC0_INIT, result);
     }
 
     /* Peripheral protection initialization (PPC1) */
     result = Cy_PPC1_Init();
     if (CY_RSLT_SUCCESS != result)
     {
-        CY_ASSERT(0);
+        fault_handle(FAULT_SITE_S_PPC1_INIT, result);
+    }
 
-        /* Infinite loop */
-        while(true);
+#if defined(SECURE_BATCH)
+    /* Boot state reported to the non-secure application */
+    secure_services_init(Cy_SysLib_GetResetReason(), status);
+#endif
+
+    /* The non-secure fault handler resets the system with NVIC_SystemReset(),
+     * which the core ignores while AIRCR.SYSRESETREQS is set. The bit reads
+     * as zero from the non-secure state, so clear and check it here. */
+    SCB->AIRCR = (SCB->AIRCR & ~(SCB_AIRCR_VECTKEY_Msk | SCB_AIRCR_SYSRESETREQS_Msk |
+                                 SCB_AIRCR_SYSRESETREQ_Msk | SCB_AIRCR_VECTCLRACTIVE_Msk)) |
+                 (AIRCR_VECTKEY << SCB_AIRCR_VECTKEY_Pos);
+    if (0U != (SCB->AIRCR & SCB_AIRCR_SYSRESETREQS_Msk))
+    {
+        fault_handle(FAULT_SITE_S_RESET_CONFIG, SCB->AIRCR);
     }
 
     ns_stack = (uint32_t)(*((uint32_t*)CM33_NS_APP_BOOT_ADDR));
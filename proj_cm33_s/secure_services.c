@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * File Name        : secure_services.c
+ *
+ * Description      : Secure services called from the non-secure application
+ *
+ * The non-secure application reaches the services through two non-secure
+ * callable functions: secure_batch_call() executes a batch of requests with
+ * one transition into the secure state, and secure_service_call() executes
+ * a single request. Both are only built with SECURE_BATCH=1, which also
+ * makes the linker write the import library used by the non-secure project.
+ *
+ * Related Document : See README.md
+ *
+ *******************************************************************************
+ * (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is owned by
+ * Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+ * by and subject to worldwide patent protection, worldwide copyright laws, and
+ * international treaty provisions. Therefore, you may use this Software only as
+ * provided in the license agreement accompanying the software package from which
+ * you obtained this Software. If no license agreement applies, then any use,
+ * reproduction, modification, translation, or compilation of this Software is
+ * prohibited without the express written permission of Infineon.
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+ * BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+ * IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+ * MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+ * without notice. You are responsible for properly designing, programming, and
+ * testing the functionality and safety of your intended application of the
+ * Software, as well as complying with any legal requirements related to its
+ * use. Infineon does not guarantee that the Software will be free from intrusion,
+ * data theft or loss, or other breaches ("Security Breaches"), and Infineon
+ * shall have no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any application
+ * where a failure of the Product or any consequences of the use thereof can
+ * reasonably be expected to result in personal injury.
+ *******************************************************************************/
+
+#if defined(SECURE_BATCH)
+
+#include <string.h>
+#include <arm_cmse.h>
+#include "secure_services.h"
+#include "retained_data.h"
+#include "xip_profile.h"
+
+/**
+ * State captured during the secure boot
+ */
+static uint32_t secure_reset_reason;
+static uint32_t secure_smif_status;
+
+/**
+ * Does nothing. Used to measure the cost of a request.
+ */
+static secure_status_t secure_svc_nop(uint32_t arg, uint32_t *result)
+{
+    (void)arg;
+    *result = 0U;
+
+    return SECURE_STATUS_OK;
+}
+
+/**
+ * Returns the reset reason read by the secure boot.
+ */
+static secure_status_t secure_svc_reset_reason(uint32_t arg, uint32_t *result)
+{
+    (void)arg;
+    *result = secure_reset_reason;
+
+    return SECURE_STATUS_OK;
+}
+
+/**
+ * Returns the result of external_memory_init().
+ */
+static secure_status_t secure_svc_smif_status(uint32_t arg, uint32_t *result)
+{
+    (void)arg;
+    *result = secure_smif_status;
+
+    return SECURE_STATUS_OK;
+}
+
+/**
+ * Returns the XIP profile the external memory was initialized with.
+ */
+static secure_status_t secure_svc_xip_profile(uint32_t arg, uint32_t *result)
+{
+    (void)arg;
+    *result = XIP_PROFILE;
+
+    return SECURE_STATUS_OK;
+}
+
+/**
+ * Returns a backup register word used by the application.
+ *
+ * Parameters
+ * arg: Word index, below RETAINED_NUM_WORDS.
+ */
+static secure_status_t secure_svc_retained_read(uint32_t arg, uint32_t *result)
+{
+    if (arg >= RETAINED_NUM_WORDS)
+    {
+        return SECURE_STATUS_BAD_ARG;
+    }
+
+    Cy_SysPm_BackupWordReStore(arg, result, 1U);
+
+    return SECURE_STATUS_OK;
+}
+
+/**
+ * Service table, indexed by secure_svc_t
+ */
+static const secure_service_fn_t secure_services[SECURE_NUM_SVCS] =
+{
+    [SECURE_SVC_NOP]            = secure_svc_nop,
+    [SECURE_SVC_RESET_REASON]   = secure_svc_reset_reason,
+    [SECURE_SVC_SMIF_STATUS]    = secure_svc_smif_status,
+    [SECURE_SVC_XIP_PROFILE]    = secure_svc_xip_profile,
+    [SECURE_SVC_RETAINED_READ]  = secure_svc_retained_read
+};
+
+/**
+ * Cycle counter for the accounting of the requests.
+ */
+static uint32_t secure_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * Captures the boot state reported by the services and enables the cycle
+ * counter. Called before the non-secure application is started.
+ *
+ * Parameters
+ * reset_reason: The reset reason read at boot.
+ * smif_status: The result of external_memory_init().
+ */
+void secure_services_init(uint32_t reset_reason, cy_en_smif_status_t smif_status)
+{
+    secure_reset_reason = reset_reason;
+    secure_smif_status = (uint32_t)smif_status;
+
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * Executes a batch of requests. The batch must be in non-secure memory. It
+ * is copied into secure memory before it is validated, so the non-secure
+ * side cannot change the requests during the dispatch, and only the
+ * results are written back.
+ *
+ * Parameters
+ * batch: The batch built with secure_batch_init() and secure_batch_add().
+ *
+ * Return: SECURE_STATUS_OK if the requests were executed. The status of
+ *         each request is in its descriptor.
+ */
+SECURE_BATCH_NSC uint32_t secure_batch_call(secure_batch_t *batch)
+{
+    secure_batch_t local;
+    secure_batch_t *ns_batch;
+    secure_status_t status;
+
+    ns_batch = cmse_check_address_range(batch, sizeof(*batch),
+                                        CMSE_NONSECURE | CMSE_MPU_READWRITE);
+    if (NULL == ns_batch)
+    {
+        return (uint32_t)SECURE_STATUS_BAD_BATCH;
+    }
+
+    memcpy(&local, ns_batch, sizeof(local));
+
+    status = secure_batch_dispatch(&local, secure_services, secure_cycles);
+    if (SECURE_STATUS_OK == status)
+    {
+        memcpy(ns_batch->requests, local.requests,
+               local.count * sizeof(local.requests[0]));
+        ns_batch->cycles = local.cycles;
+    }
+
+    return (uint32_t)status;
+}
+
+/**
+ * Executes a single request, for callers that need one service only.
+ *
+ * Parameters
+ * service: The requested service, secure_svc_t.
+ * arg: The argument of the service.
+ * result: The result, in non-secure memory.
+ *
+ * Return: The status of the request, secure_status_t.
+ */
+SECURE_BATCH_NSC uint32_t secure_service_call(uint32_t service, uint32_t arg,
+                                              uint32_t *result)
+{
+    uint32_t *ns_result;
+    uint32_t value = 0U;
+    secure_status_t status;
+
+    ns_result = cmse_check_address_range(result, sizeof(*result),
+                                         CMSE_NONSECURE | CMSE_MPU_READWRITE);
+    if (NULL == ns_result)
+    {
+        return (uint32_t)SECURE_STATUS_BAD_ARG;
+    }
+
+    if (service >= (uint32_t)SECURE_NUM_SVCS)
+    {
+        return (uint32_t)SECURE_STATUS_BAD_SERVICE;
+    }
+
+    status = secure_services[service](arg, &value);
+    *ns_result = value;
+
+    return (uint32_t)status;
+}
+
+#endif /* defined(SECURE_BATCH) */
+
+/* [] END OF FILE */
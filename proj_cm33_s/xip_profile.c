@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * File Name        : xip_profile.c
+ *
+ * Description      : Selects the XIP read path profile of the external memory
+ *
+ * The generated smifBlockConfig is placed in flash and cannot be changed. When
+ * a profile other than XIP_PROFILE_DEFAULT is selected, the memory and read
+ * command configuration is copied to RAM, the profile is applied to the copy
+ * and the copy is used to initialize the memory.
+ *
+ * Related Document : See README.md
+ *
+ *******************************************************************************
+ * (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is owned by
+ * Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+ * by and subject to worldwide patent protection, worldwide copyright laws, and
+ * international treaty provisions. Therefore, you may use this Software only as
+ * provided in the license agreement accompanying the software package from which
+ * you obtained this Software. If no license agreement applies, then any use,
+ * reproduction, modification, translation, or compilation of this Software is
+ * prohibited without the express written permission of Infineon.
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+ * BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+ * IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+ * MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+ * without notice. You are responsible for properly designing, programming, and
+ * testing the functionality and safety of your intended application of the
+ * Software, as well as complying with any legal requirements related to its
+ * use. Infineon does not guarantee that the Software will be free from intrusion,
+ * data theft or loss, or other breaches ("Security Breaches"), and Infineon
+ * shall have no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any application
+ * where a failure of the Product or any consequences of the use thereof can
+ * reasonably be expected to result in personal injury.
+ *******************************************************************************/
+
+#include "xip_profile.h"
+
+/**
+ * Profile table, indexed by the XIP_PROFILE_* IDs
+ */
+static const xip_profile_t xip_profiles[] =
+{
+    /* XIP_PROFILE_DEFAULT: generated configuration, not used */
+    {
+        .merge_enable       = false,
+        .merge_timeout      = CY_SMIF_MERGE_TIMEOUT_1_CYCLE,
+        .read_dummy_cycles  = XIP_PROFILE_KEEP_DUMMY_CYCLES
+    },
+    /* XIP_PROFILE_PERFORMANCE: merge sequential cache line fills into one
+     * read transaction to save the command, address and dummy phases */
+    {
+        .merge_enable       = true,
+        .merge_timeout      = CY_SMIF_MERGE_TIMEOUT_256_CYCLES,
+        .read_dummy_cycles  = XIP_PROFILE_KEEP_DUMMY_CYCLES
+    },
+    /* XIP_PROFILE_LOW_POWER: release the chip select after every read so
+     * that the memory returns to standby as early as possible */
+    {
+        .merge_enable       = false,
+        .merge_timeout      = CY_SMIF_MERGE_TIMEOUT_1_CYCLE,
+        .read_dummy_cycles  = XIP_PROFILE_KEEP_DUMMY_CYCLES
+    }
+};
+
+/**
+ * RAM copies of the generated configuration that the profile is applied to
+ */
+static cy_stc_smif_mem_cmd_t        xip_read_cmd;
+static cy_stc_smif_mem_device_cfg_t xip_device_cfg;
+static cy_stc_smif_mem_config_t     xip_mem_cfg;
+static cy_stc_smif_mem_config_t    *xip_mem_cfg_list[1];
+static cy_stc_smif_block_config_t   xip_block_cfg;
+
+/**
+ * Returns a profile of the table.
+ *
+ * Parameters
+ * id: The profile ID, XIP_PROFILE_*.
+ *
+ * Return: The profile, or NULL if the ID is unknown.
+ */
+const xip_profile_t *xip_profile_get(uint32_t id)
+{
+    if (id >= (sizeof(xip_profiles) / sizeof(xip_profiles[0])))
+    {
+        return NULL;
+    }
+
+    return &xip_profiles[id];
+}
+
+/**
+ * Checks a profile against the memory configuration it is applied to.
+ *
+ * Parameters
+ * profile: The profile to check.
+ * mem: The generated memory configuration.
+ *
+ * Return: XIP_PROFILE_OK if the profile can be applied.
+ */
+en_xip_profile_status_t xip_profile_validate(const xip_profile_t *profile,
+                                        const cy_stc_smif_mem_config_t *mem)
+{
+    if (profile->merge_enable &&
+        (profile->merge_timeout > CY_SMIF_MERGE_TIMEOUT_65536_CYCLE))
+    {
+        return XIP_PROFILE_ERR_MERGE_TIMEOUT;
+    }
+
+    /* Fewer dummy cycles than the device needs at this clock corrupt reads */
+    if ((XIP_PROFILE_KEEP_DUMMY_CYCLES != profile->read_dummy_cycles) &&
+        ((profile->read_dummy_cycles > XIP_PROFILE_MAX_DUMMY_CYCLES) ||
+         (profile->read_dummy_cycles < mem->deviceCfg->readCmd->dummyCycles)))
+    {
+        return XIP_PROFILE_ERR_DUMMY_CYCLES;
+    }
+
+    return XIP_PROFILE_OK;
+}
+
+/**
+ * Applies the profile selected by XIP_PROFILE to the external memory
+ * configuration.
+ *
+ * Parameters
+ * block: The generated SMIF block configuration.
+ *
+ * Return: The configuration to initialize the memory with. This is the
+ *         generated configuration if the default profile is selected, more
+ *         than one memory is configured, or the selected profile is not
+ *         valid for the memory.
+ */
+const cy_stc_smif_block_config_t *xip_profile_apply(
+                                        const cy_stc_smif_block_config_t *block)
+{
+    const xip_profile_t *profile = xip_profile_get(XIP_PROFILE);
+    const cy_stc_smif_mem_config_t *mem = block->memConfig[0];
+
+    if ((XIP_PROFILE_DEFAULT == XIP_PROFILE) || (1U != block->memCount) ||
+        (XIP_PROFILE_OK != xip_profile_validate(profile, mem)))
+    {
+        return block;
+    }
+
+    xip_read_cmd = *mem->deviceCfg->readCmd;
+    if (XIP_PROFILE_KEEP_DUMMY_CYCLES != profile->read_dummy_cycles)
+    {
+        xip_read_cmd.dummyCycles = profile->read_dummy_cycles;
+    }
+
+    xip_device_cfg = *mem->deviceCfg;
+    xip_device_cfg.readCmd = &xip_read_cmd;
+
+    xip_mem_cfg = *mem;
+    xip_mem_cfg.deviceCfg = &xip_device_cfg;
+    xip_mem_cfg.mergeTimeout = profile->merge_timeout;
+    if (profile->merge_enable)
+    {
+        xip_mem_cfg.flags |= CY_SMIF_FLAG_MERGE_ENABLE;
+    }
+    else
+    {
+        xip_mem_cfg.flags &= ~CY_SMIF_FLAG_MERGE_ENABLE;
+    }
+
+    xip_mem_cfg_list[0] = &xip_mem_cfg;
+
+    xip_block_cfg = *block;
+    xip_block_cfg.memCount = 1U;
+    xip_block_cfg.memConfig = xip_mem_cfg_list;
+
+    return &xip_block_cfg;
+}
+
+/* [] END OF FILE */
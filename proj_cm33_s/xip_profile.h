@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * File Name        : xip_profile.h
+ *
+ * Description      : XIP read path profile interface header file
+ *
+ * Related Document : See README.md
+ *
+ *******************************************************************************
+ * (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is owned by
+ * Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+ * by and subject to worldwide patent protection, worldwide copyright laws, and
+ * international treaty provisions. Therefore, you may use this Software only as
+ * provided in the license agreement accompanying the software package from which
+ * you obtained this Software. If no license agreement applies, then any use,
+ * reproduction, modification, translation, or compilation of this Software is
+ * prohibited without the express written permission of Infineon.
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+ * BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+ * IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+ * MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+ * without notice. You are responsible for properly designing, programming, and
+ * testing the functionality and safety of your intended application of the
+ * Software, as well as complying with any legal requirements related to its
+ * use. Infineon does not guarantee that the Software will be free from intrusion,
+ * data theft or loss, or other breaches ("Security Breaches"), and Infineon
+ * shall have no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any application
+ * where a failure of the Product or any consequences of the use thereof can
+ * reasonably be expected to result in personal injury.
+ *******************************************************************************/
+
+#ifndef XIP_PROFILE_H
+#define XIP_PROFILE_H
+
+#include "cybsp.h"
+
+/* Keep the read dummy cycles of the generated memory configuration. The
+ * generated value is the minimum for the configured SMIF clock, so the
+ * built-in profiles keep it. A custom profile can add dummy cycles, for
+ * example when the memory is run with a slower read command. */
+#define XIP_PROFILE_KEEP_DUMMY_CYCLES   (0xFFU)
+
+/* Largest dummy cycle count supported by the SMIF command sequence */
+#define XIP_PROFILE_MAX_DUMMY_CYCLES    (31U)
+
+/* Profile IDs, selected with DEFINES+=XIP_PROFILE=<id> */
+#define XIP_PROFILE_DEFAULT             (0U)
+#define XIP_PROFILE_PERFORMANCE         (1U)
+#define XIP_PROFILE_LOW_POWER           (2U)
+
+#ifndef XIP_PROFILE
+#define XIP_PROFILE                     (XIP_PROFILE_DEFAULT)
+#endif
+
+#if (XIP_PROFILE > XIP_PROFILE_LOW_POWER)
+#error "Unknown XIP_PROFILE"
+#endif
+
+typedef struct
+{
+    bool                        merge_enable;       /* Merge sequential XIP reads */
+    cy_en_smif_merge_timeout_t  merge_timeout;      /* Idle time before a merged read ends */
+    uint8_t                     read_dummy_cycles;  /* Or XIP_PROFILE_KEEP_DUMMY_CYCLES */
+} xip_profile_t;
+
+typedef enum
+{
+    XIP_PROFILE_OK                  = 0,
+    XIP_PROFILE_ERR_MERGE_TIMEOUT   = 1,    /* Merge timeout out of range */
+    XIP_PROFILE_ERR_DUMMY_CYCLES    = 2     /* Dummy cycles below device minimum or too large */
+} en_xip_profile_status_t;
+
+const xip_profile_t *xip_profile_get(uint32_t id);
+en_xip_profile_status_t xip_profile_validate(const xip_profile_t *profile,
+                                        const cy_stc_smif_mem_config_t *mem);
+const cy_stc_smif_block_config_t *xip_profile_apply(
+                                        const cy_stc_smif_block_config_t *block);
+
+#endif
+
+/* [] END OF FILE */
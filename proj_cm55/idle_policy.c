@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * File Name:   idle_policy.c
+ *
+ * Description: This file contains the idle policy of the CM55. It accounts
+ *              the memory the CM55 keeps retained in DeepSleep and chooses
+ *              between Sleep, DeepSleep with retention and power-off from
+ *              the expected idle interval, by comparing the energy of each
+ *              state including the cost of reloading the TCM after a
+ *              power-off. The model has no device dependencies.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "idle_policy.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define IDLE_POLICY_BYTES_PER_KB        (1024UL)
+#define IDLE_POLICY_NW_PER_UW           (1000UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Regions retained by the CM55 in DeepSleep */
+static const idle_policy_region_t idle_policy_regions[] =
+{
+    { "ITCM", IDLE_POLICY_ITCM_SIZE, IDLE_POLICY_ITCM_RESTORE_BYTES },
+    { "DTCM", IDLE_POLICY_DTCM_SIZE, IDLE_POLICY_DTCM_RESTORE_BYTES }
+};
+
+/*******************************************************************************
+* Function Name: idle_policy_model_init
+********************************************************************************
+* Summary:
+* Builds the idle model from the default parameters and the retained
+* regions. The DeepSleep power grows with the retained bytes, and the
+* power-off transition includes the boot and the reload of the restored
+* bytes at the active power.
+*
+* Parameters:
+*  model: Model to initialize
+*  regions: Regions retained in DeepSleep
+*  num_regions: Number of entries in regions
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void idle_policy_model_init(idle_policy_model_t *model,
+                            const idle_policy_region_t *regions,
+                            uint32_t num_regions)
+{
+    uint32_t restore_us;
+
+    model->retained_bytes = 0U;
+    model->restore_bytes = 0U;
+    for (uint32_t i = 0U; i < num_regions; i++)
+    {
+        model->retained_bytes += regions[i].size_bytes;
+        model->restore_bytes += regions[i].restore_bytes;
+    }
+
+    restore_us = IDLE_POLICY_BOOT_US +
+                 (model->restore_bytes / IDLE_POLICY_RESTORE_BYTES_PER_US);
+
+    model->state[IDLE_POLICY_SLEEP].power_uw = IDLE_POLICY_SLEEP_UW;
+    model->state[IDLE_POLICY_SLEEP].transition_nj = IDLE_POLICY_SLEEP_TRANSITION_NJ;
+    model->state[IDLE_POLICY_SLEEP].exit_us = IDLE_POLICY_SLEEP_EXIT_US;
+
+    model->state[IDLE_POLICY_DEEPSLEEP].power_uw = IDLE_POLICY_DEEPSLEEP_UW +
+        (((model->retained_bytes / IDLE_POLICY_BYTES_PER_KB) *
+          IDLE_POLICY_RETENTION_NW_PER_KB) / IDLE_POLICY_NW_PER_UW);
+    model->state[IDLE_POLICY_DEEPSLEEP].transition_nj = IDLE_POLICY_DEEPSLEEP_TRANSITION_NJ;
+    model->state[IDLE_POLICY_DEEPSLEEP].exit_us = IDLE_POLICY_DEEPSLEEP_EXIT_US;
+
+    /* uW * us / 1000 = nJ */
+    model->state[IDLE_POLICY_OFF].power_uw = IDLE_POLICY_OFF_UW;
+    model->state[IDLE_POLICY_OFF].transition_nj = IDLE_POLICY_OFF_TRANSITION_NJ +
+        (uint32_t)(((uint64_t)IDLE_POLICY_ACTIVE_UW * restore_us) / IDLE_POLICY_NW_PER_UW);
+    model->state[IDLE_POLICY_OFF].exit_us = restore_us;
+}
+
+/*******************************************************************************
+* Function Name: idle_policy_model_init_default
+********************************************************************************
+* Summary:
+* Builds the idle model for the CM55 TCM regions.
+*
+* Parameters:
+*  model: Model to initialize
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void idle_policy_model_init_default(idle_policy_model_t *model)
+{
+    idle_policy_model_init(model, idle_policy_regions,
+        (uint32_t)(sizeof(idle_policy_regions) / sizeof(idle_policy_regions[0])));
+}
+
+/*******************************************************************************
+* Function Name: idle_policy_energy_nj
+********************************************************************************
+* Summary:
+* Returns the energy of an idle period spent in a state.
+*
+* Parameters:
+*  model: Idle model
+*  state: Idle state
+*  idle_ms: Length of the idle period in milliseconds
+*
+* Return:
+*  uint64_t: Energy in nJ (uW * ms)
+*
+*******************************************************************************/
+uint64_t idle_policy_energy_nj(const idle_policy_model_t *model,
+                               idle_policy_state_t state, uint32_t idle_ms)
+{
+    const idle_policy_cost_t *cost = &model->state[state];
+
+    return (uint64_t)cost->transition_nj + ((uint64_t)cost->power_uw * idle_ms);
+}
+
+/*******************************************************************************
+* Function Name: idle_policy_break_even_ms
+********************************************************************************
+* Summary:
+* Returns the shortest idle interval for which the deeper of two states uses
+* less energy than the shallower one. The deep state must not have a lower
+* transition energy and a higher power than the shallow state at the same
+* time, which holds for the states of idle_policy_model_init().
+*
+* Parameters:
+*  model: Idle model
+*  shallow: State with the lower transition cost
+*  deep: State with the lower idle power
+*
+* Return:
+*  uint32_t: Break-even interval in milliseconds, 0 if the deep state is
+*            always cheaper, IDLE_POLICY_IDLE_UNBOUNDED if it never is
+*
+*******************************************************************************/
+uint32_t idle_policy_break_even_ms(const idle_policy_model_t *model,
+                                   idle_policy_state_t shallow,
+                                   idle_policy_state_t deep)
+{
+    const idle_policy_cost_t *s = &model->state[shallow];
+    const idle_policy_cost_t *d = &model->state[deep];
+    uint32_t saved_uw;
+    uint32_t extra_nj;
+
+    if (d->power_uw >= s->power_uw)
+    {
+        return ((d->power_uw == s->power_uw) && (d->transition_nj < s->transition_nj)) ?
+               0U : IDLE_POLICY_IDLE_UNBOUNDED;
+    }
+
+    if (d->transition_nj < s->transition_nj)
+    {
+        return 0U;
+    }
+
+    saved_uw = s->power_uw - d->power_uw;
+    extra_nj = d->transition_nj - s->transition_nj;
+
+    /* Smallest t with extra_nj < saved_uw * t. At extra_nj / saved_uw the
+     * energies can be equal, and the shallow state is kept on a tie. */
+    return (extra_nj / saved_uw) + 1U;
+}
+
+/*******************************************************************************
+* Function Name: idle_policy_choose
+********************************************************************************
+* Summary:
+* Chooses the idle state with the lowest energy for the expected idle
+* interval among the states that wake up within the latency limit. Sleep is
+* always allowed. Walking from the shallowest to the deepest state, a state
+* replaces the current choice if the expected interval reaches the break-even
+* interval of the two. On equal energy the shallower state is kept.
+*
+* Parameters:
+*  model: Idle model
+*  expected_idle_ms: Expected idle interval in milliseconds, or
+*                    IDLE_POLICY_IDLE_UNBOUNDED
+*  max_latency_us: Longest acceptable wakeup latency in microseconds
+*
+* Return:
+*  idle_policy_state_t: Chosen idle state
+*
+*******************************************************************************/
+idle_policy_state_t idle_policy_choose(const idle_policy_model_t *model,
+                                       uint32_t expected_idle_ms,
+                                       uint32_t max_latency_us)
+{
+    idle_policy_state_t best = IDLE_POLICY_SLEEP;
+    uint32_t break_even_ms;
+
+    for (uint32_t i = (uint32_t)IDLE_POLICY_DEEPSLEEP;
+         i < (uint32_t)IDLE_POLICY_NUM_STATES; i++)
+    {
+        if (model->state[i].exit_us > max_latency_us)
+        {
+            continue;
+        }
+
+        break_even_ms = idle_policy_break_even_ms(model, best,
+                                                  (idle_policy_state_t)i);
+        if ((IDLE_POLICY_IDLE_UNBOUNDED != break_even_ms) &&
+            (expected_idle_ms >= break_even_ms))
+        {
+            best = (idle_policy_state_t)i;
+        }
+    }
+
+    return best;
+}
+
+/* [] END OF FILE */
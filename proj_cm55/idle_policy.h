@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * File Name:   idle_policy.h
+ *
+ * Description: This file is the public interface of idle_policy.c and
+ *              contains the default parameters of the CM55 idle model.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _IDLE_POLICY_H_
+#define _IDLE_POLICY_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Expected idle interval when no further work is planned for the CM55 */
+#define IDLE_POLICY_IDLE_UNBOUNDED          (0xFFFFFFFFUL)
+
+/* Longest wakeup latency the application accepts, in microseconds */
+#ifndef IDLE_POLICY_MAX_WAKE_LATENCY_US
+#define IDLE_POLICY_MAX_WAKE_LATENCY_US     (100000UL)
+#endif
+
+/* CM55 tightly coupled memories. The restore sizes are the bytes copied from
+ * the external flash when the CM55 boots after a power-off; they default to
+ * the full TCM and can be lowered to the image sizes in the map file. */
+#define IDLE_POLICY_ITCM_SIZE               (256UL * 1024UL)
+#define IDLE_POLICY_DTCM_SIZE               (256UL * 1024UL)
+
+#ifndef IDLE_POLICY_ITCM_RESTORE_BYTES
+#define IDLE_POLICY_ITCM_RESTORE_BYTES      (IDLE_POLICY_ITCM_SIZE)
+#endif
+#ifndef IDLE_POLICY_DTCM_RESTORE_BYTES
+#define IDLE_POLICY_DTCM_RESTORE_BYTES      (IDLE_POLICY_DTCM_SIZE)
+#endif
+
+/* Default model parameters. These are estimates for a first configuration
+ * and must be replaced with values measured on the target board.
+ * Power in uW, energy in nJ, time in us. */
+#define IDLE_POLICY_ACTIVE_UW               (30000UL)
+#define IDLE_POLICY_SLEEP_UW                (5000UL)
+#define IDLE_POLICY_DEEPSLEEP_UW            (20UL)
+#define IDLE_POLICY_RETENTION_NW_PER_KB     (30UL)
+#define IDLE_POLICY_OFF_UW                  (1UL)
+#define IDLE_POLICY_SLEEP_TRANSITION_NJ     (1UL)
+#define IDLE_POLICY_DEEPSLEEP_TRANSITION_NJ (2000UL)
+#define IDLE_POLICY_OFF_TRANSITION_NJ       (5000UL)
+#define IDLE_POLICY_SLEEP_EXIT_US           (1UL)
+#define IDLE_POLICY_DEEPSLEEP_EXIT_US       (50UL)
+#define IDLE_POLICY_BOOT_US                 (2000UL)
+#define IDLE_POLICY_RESTORE_BYTES_PER_US    (20UL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Idle states of the CM55, from shallowest to deepest */
+typedef enum
+{
+    IDLE_POLICY_SLEEP     = 0,      /* Clock gated, wakes on any interrupt */
+    IDLE_POLICY_DEEPSLEEP = 1,      /* TCM and core state retained */
+    IDLE_POLICY_OFF       = 2,      /* Powered off by the CM33, TCM lost */
+    IDLE_POLICY_NUM_STATES = 3
+} idle_policy_state_t;
+
+/* Memory region whose contents must survive an idle period */
+typedef struct
+{
+    const char *name;
+    uint32_t size_bytes;            /* Bytes kept powered in DeepSleep */
+    uint32_t restore_bytes;         /* Bytes reloaded after a power-off */
+} idle_policy_region_t;
+
+/* Cost of one idle state. The energy of an idle period of t ms is
+ * transition_nj + power_uw * t, and the CPU is usable again exit_us after
+ * the wakeup event. */
+typedef struct
+{
+    uint32_t power_uw;
+    uint32_t transition_nj;
+    uint32_t exit_us;
+} idle_policy_cost_t;
+
+/* Idle model of the CM55 */
+typedef struct
+{
+    uint32_t retained_bytes;
+    uint32_t restore_bytes;
+    idle_policy_cost_t state[IDLE_POLICY_NUM_STATES];
+} idle_policy_model_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void idle_policy_model_init(idle_policy_model_t *model,
+                            const idle_policy_region_t *regions,
+                            uint32_t num_regions);
+void idle_policy_model_init_default(idle_policy_model_t *model);
+uint64_t idle_policy_energy_nj(const idle_policy_model_t *model,
+                               idle_policy_state_t state, uint32_t idle_ms);
+uint32_t idle_policy_break_even_ms(const idle_policy_model_t *model,
+                                   idle_policy_state_t shallow,
+                                   idle_policy_state_t deep);
+idle_policy_state_t idle_policy_choose(const idle_policy_model_t *model,
+                                       uint32_t expected_idle_ms,
+                                       uint32_t max_latency_us);
+
+#endif /* _IDLE_POLICY_H_ */
+
+/* [] END OF FILE */
@@ -32,6 +32,38 @@
 *******************************************************************************/
 
 #include "cybsp.h"
+#include "telemetry.h"
+#include "idle_policy.h"
+#include "fault.h"
+
+/*******************************************************************************
+* Function Name: idle_hint_ms
+********************************************************************************
+* Summary:
+* Reads the expected idle interval the CM33 published in the telemetry
+* block.
+*
+* Parameters:
+*  hint_ms: Expected idle interval in milliseconds
+*
+* Return:
+*  bool: false if no consistent copy of the CM33 section could be read
+*
+*******************************************************************************/
+static bool idle_hint_ms(uint32_t *hint_ms)
+{
+    telemetry_section_t cm33;
+
+    if (!telemetry_read((const telemetry_block_t *)TELEMETRY_BLOCK_ADDR,
+                        TELEMETRY_CORE_CM33, &cm33))
+    {
+        return false;
+    }
+
+    *hint_ms = cm33.idle_hint_ms;
+
+    return true;
+}
 
 /*******************************************************************************
 * Function Name: main
@@ -39,8 +71,10 @@
 * Summary:
 * This is the main function for CM55 application. 
 * 
-* CM33 application enables the CM55 CPU and then the CM55 CPU enters 
-* deep sleep.
+* CM33 application enables the CM55 CPU and then the CM55 CPU goes idle in
+* the state chosen by the idle policy for the expected idle interval
+* published by the CM33. Sleep entries and wakeups are published in the CM55
+* section of the shared telemetry block.
 * 
 * Parameters:
 *  void
@@ -52,29 +86,80 @@
 int main(void)
 {
     cy_rslt_t result;
+    telemetry_section_t *telemetry;
+    idle_policy_model_t idle_model;
+    idle_policy_state_t idle_state;
+    uint32_t hint_ms;
+
+    /* Start timing the boot for the telemetry block */
+    telemetry_timer_start();
 
     /* Initialize the device and board peripherals. */
     result = cybsp_init();
 
-    /* Board init failed. Stop program execution. */
+    /* Board init failed. Record the fault and halt in DeepSleep. */
     if (CY_RSLT_SUCCESS != result)
     {
-        /* Disable all interrupts. */
-        __disable_irq();
-
-        CY_ASSERT(0);
-
-        /* Infinite loop */
-        while(true);
+        fault_handle(FAULT_SITE_CM55_BSP_INIT, result);
     }
 
+    fault_set_phase(FAULT_PHASE_RUN);
+
     /* Enable global interrupts. */
     __enable_irq();
 
-    /* Put the CPU to Deep Sleep. */
+    idle_policy_model_init_default(&idle_model);
+
+    telemetry_init(TELEMETRY_CORE_CM55);
+    telemetry = telemetry_begin(TELEMETRY_CORE_CM55);
+    telemetry->boot_time_us = telemetry_timer_us();
+    telemetry_end(TELEMETRY_CORE_CM55);
+
     for (;;)
     {
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        /* Without a hint, fall back to DeepSleep: it retains the TCM and,
+         * unlike Off, does not rely on the CM33 reading the telemetry block */
+        if (idle_hint_ms(&hint_ms))
+        {
+            idle_state = idle_policy_choose(&idle_model, hint_ms,
+                                            IDLE_POLICY_MAX_WAKE_LATENCY_US);
+        }
+        else
+        {
+            idle_state = IDLE_POLICY_DEEPSLEEP;
+        }
+
+        telemetry = telemetry_begin(TELEMETRY_CORE_CM55);
+        telemetry_hist_add(telemetry, telemetry_timer_us());
+        telemetry->sleep_entries++;
+        telemetry->idle_state = (uint32_t)idle_state;
+        telemetry->off_request = (IDLE_POLICY_OFF == idle_state) ? 1U : 0U;
+        telemetry_end(TELEMETRY_CORE_CM55);
+
+        if (IDLE_POLICY_SLEEP == idle_state)
+        {
+            Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        }
+        else
+        {
+            /* On a power-off request, wait in DeepSleep until the CM33
+             * removes the power */
+            Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        }
+
+        telemetry_timer_start();
+        telemetry = telemetry_begin(TELEMETRY_CORE_CM55);
+        if (IDLE_POLICY_SLEEP == idle_state)
+        {
+            telemetry->last_wake = (uint32_t)TELEMETRY_WAKE_SLEEP;
+        }
+        else
+        {
+            telemetry->last_wake = (uint32_t)TELEMETRY_WAKE_DEEPSLEEP;
+            telemetry->deepsleep_wakes++;
+        }
+        telemetry->off_request = 0U;
+        telemetry_end(TELEMETRY_CORE_CM55);
     }
 }
 
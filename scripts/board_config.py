@@ -0,0 +1,511 @@
+#!/usr/bin/env python3
+################################################################################
+# \file board_config.py
+# \version 1.0
+#
+# \brief
+# Generates the per-board device configuration and board constants from the
+# overlays in templates/boards.
+#
+# Each overlay names a target and, for derived boards, the base target whose
+# design.modus it modifies. The overlay sets the device part number, the
+# personality instance IDs and the parameters that differ from the base,
+# addressed by block location. For every target, the generator writes
+# templates/TARGET_<target>/config/design.modus (derived boards only) and
+# templates/TARGET_<target>/config/board_config.h. It fails if a memory
+# region of another domain lies in a slot signed by the sign configurations
+# in configs, because programming the padded signed image would erase it.
+#
+# The templates are copied into bsps/TARGET_<target>/config when the
+# application is created. --install regenerates board_config.h in that copy
+# from the design.modus of the BSP, which is the one the application is built
+# with, and is run by the pre-build step of the CM33 non-secure project.
+# --nsc prints the address of the non-secure callable region of that
+# design.modus, where the CM33 secure project links its secure gateway
+# veneers when it is built with SECURE_BATCH=1.
+#
+# Usage:
+#   python3 scripts/board_config.py [--check] [--force] [target ...]
+#   python3 scripts/board_config.py --install target
+#   python3 scripts/board_config.py --nsc target
+#
+#   --check    Regenerate in memory and compare with the files on disk.
+#              Exits with status 1 and prints a diff on any difference.
+#   --force    Regenerate even if the inputs did not change since the last
+#              run.
+#   --install  Write board_config.h of the target into its BSP if it
+#              differs. The target may have the APP_ prefix of application
+#              BSPs.
+#   --nsc      Print the secure address of the m33s_nsc region of the
+#              target, from its BSP if there is one. Fails if the region
+#              is missing, not in RRAM or not in the M33NSC domain.
+#
+################################################################################
+# \copyright
+# (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import difflib
+import glob
+import hashlib
+import json
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OVERLAY_DIR = os.path.join(ROOT_DIR, "templates", "boards")
+BSP_DIR = os.path.join(ROOT_DIR, "bsps")
+CACHE_FILE = os.path.join(OVERLAY_DIR, ".cache.json")
+SIGN_CONFIG_DIR = os.path.join(ROOT_DIR, "configs")
+
+DEVICE_RE = re.compile(r'(<Device mpn=")([^"]*)(")')
+INSTANCE_RE = re.compile(r'(<Personality [^>]*instance=")([^"]*)(")')
+BLOCK_RE = re.compile(r'<Block location="([^"]*)"')
+PARAM_RE = re.compile(r'(<Param id="([^"]*)" value=")([^"]*)(")')
+ALIAS_RE = re.compile(r'<Alias value="([^"]*)"')
+SLOT_ADDRESS_RE = re.compile(r'^\{\{CYMEM_[A-Z0-9_]+?_S_([a-z0-9_]+)_S_START\}\}$')
+
+LPCOMP_BLOCK = "lpcomp[0].comp[0]"
+REGION_BLOCK = "vres[0].memory_region_data["
+NSC_REGION = "m33s_nsc"
+NSC_DOMAIN = "M33NSC"
+# Secure alias of the RRAM
+RRAM_S_BASE = 0x32000000
+
+LICENSE = """\
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/"""
+
+
+class ConfigError(Exception):
+    pass
+
+
+def target_dir(target):
+    return os.path.join(ROOT_DIR, "templates", "TARGET_" + target, "config")
+
+
+def read_file(path):
+    with open(path, "r", encoding="utf-8", newline="") as f:
+        return f.read()
+
+
+def load_overlays():
+    overlays = {}
+    for path in sorted(glob.glob(os.path.join(OVERLAY_DIR, "*.json"))):
+        overlay = json.loads(read_file(path))
+        overlay["_path"] = path
+        overlays[overlay["target"]] = overlay
+    return overlays
+
+
+def find_personalities(lines):
+    """Returns {block location: (first line, last line)} of each personality."""
+    personalities = {}
+    start = None
+    location = None
+    for index, line in enumerate(lines):
+        if "<Personality " in line:
+            start = index
+            location = None
+        elif start is not None and location is None:
+            match = BLOCK_RE.search(line)
+            if match:
+                location = match.group(1)
+        if "</Personality>" in line or ("<Personality " in line and line.rstrip().endswith("/>")):
+            if location is not None:
+                personalities[location] = (start, index)
+            start = None
+    return personalities
+
+
+def apply_overlay(base_text, overlay):
+    lines = base_text.splitlines(keepends=True)
+    personalities = find_personalities(lines)
+
+    if "device" in overlay:
+        for index, line in enumerate(lines):
+            if DEVICE_RE.search(line):
+                lines[index] = DEVICE_RE.sub(r"\g<1>" + overlay["device"] + r"\g<3>", line, count=1)
+                break
+        else:
+            raise ConfigError("no <Device> element in the base configuration")
+
+    for location, changes in overlay.get("blocks", {}).items():
+        if location not in personalities:
+            raise ConfigError("block %s not found in the base configuration" % location)
+        start, end = personalities[location]
+
+        if "instance" in changes:
+            lines[start] = INSTANCE_RE.sub(r"\g<1>" + changes["instance"] + r"\g<3>", lines[start], count=1)
+
+        for param, value in changes.get("params", {}).items():
+            for index in range(start, end + 1):
+                match = PARAM_RE.search(lines[index])
+                if match and match.group(2) == param:
+                    lines[index] = PARAM_RE.sub(lambda m: m.group(1) + value + m.group(4), lines[index], count=1)
+                    break
+            else:
+                raise ConfigError("parameter %s not found in block %s" % (param, location))
+
+    return "".join(lines)
+
+
+def lpcomp_constants(design_text):
+    """Derives the LPComp constants from the device configuration."""
+    lines = design_text.splitlines()
+    personalities = find_personalities(lines)
+    if LPCOMP_BLOCK not in personalities:
+        raise ConfigError("block %s not found" % LPCOMP_BLOCK)
+
+    start, end = personalities[LPCOMP_BLOCK]
+    params = {}
+    for line in lines[start:end + 1]:
+        match = PARAM_RE.search(line)
+        if match:
+            params[match.group(2)] = match.group(3)
+
+    if "PowerSpeed" not in params:
+        raise ConfigError("no PowerSpeed parameter in block %s" % LPCOMP_BLOCK)
+
+    return [
+        ("LPCOMP_POWER_MODE", params["PowerSpeed"]),
+    ]
+
+
+def memory_regions(design_text):
+    """Returns the parameters of every memory region, by block location."""
+    lines = design_text.splitlines()
+    regions = {}
+    for location, (start, end) in find_personalities(lines).items():
+        if not location.startswith(REGION_BLOCK):
+            continue
+        params = {}
+        for line in lines[start:end + 1]:
+            match = PARAM_RE.search(line)
+            if match:
+                params[match.group(2)] = match.group(3)
+        regions[location] = params
+    return regions
+
+
+def protection_domain(design_text, alias):
+    """Returns the personality instance of the protection domain alias."""
+    # The domain is the personality enclosing its alias
+    instance = None
+    for line in design_text.splitlines():
+        match = INSTANCE_RE.search(line)
+        if match:
+            instance = match.group(2)
+        match = ALIAS_RE.search(line)
+        if match and match.group(1) == alias:
+            return instance
+    raise ConfigError("no protection domain %s" % alias)
+
+
+def nsc_region(design_text):
+    """Returns (secure address, size) of the non-secure callable region."""
+    domain = protection_domain(design_text, NSC_DOMAIN)
+
+    for params in memory_regions(design_text).values():
+        if params.get("regionId") != NSC_REGION:
+            continue
+
+        if params.get("memoryId") != "RRAM":
+            raise ConfigError("region %s is not in RRAM" % NSC_REGION)
+        if params.get("domain") != domain:
+            raise ConfigError("region %s is not in domain %s" % (NSC_REGION, NSC_DOMAIN))
+        return RRAM_S_BASE + int(params["offset"], 16), int(params["size"], 16)
+
+    raise ConfigError("no memory region %s" % NSC_REGION)
+
+
+def signed_slots():
+    """Returns (config file, region, slot size) of every signed image of the
+    sign configurations, placed at the start of a memory region."""
+    slots = []
+    for path in sorted(glob.glob(os.path.join(SIGN_CONFIG_DIR, "*.json"))):
+        config = json.loads(read_file(path))
+        for content in config.get("content", []):
+            for command in content.get("commands", []):
+                if command.get("command") != "sign":
+                    continue
+                for sign_input in command.get("inputs", []):
+                    match = SLOT_ADDRESS_RE.match(sign_input.get("hex-address", ""))
+                    if match and "slot-size" in sign_input:
+                        slots.append((os.path.basename(path), match.group(1),
+                                      int(sign_input["slot-size"], 16)))
+    return slots
+
+
+def check_slots(design_text, slots):
+    """Fails if a region outside the domains of a signed image lies in its
+    slot. The image may span regions of its own domain and the NSC domain."""
+    regions = list(memory_regions(design_text).values())
+    nsc_domain = protection_domain(design_text, NSC_DOMAIN)
+    for config, region_id, slot_size in slots:
+        base = [params for params in regions if params.get("regionId") == region_id]
+        if not base:
+            raise ConfigError("%s: no memory region %s" % (config, region_id))
+        base = base[0]
+        start = int(base["offset"], 16)
+        end = start + slot_size
+        for params in regions:
+            if (params["memoryId"] != base["memoryId"] or
+                    params["domain"] in (base["domain"], nsc_domain)):
+                continue
+            offset = int(params["offset"], 16)
+            if offset < end and start < offset + int(params["size"], 16):
+                raise ConfigError("%s: region %s lies in the signed slot of %s (0x%X..0x%X)"
+                                  % (config, params["regionId"], region_id, start, end))
+
+
+def board_header(overlay, design_text):
+    target = overlay["target"]
+    source = os.path.relpath(overlay["_path"], ROOT_DIR).replace(os.sep, "/")
+    out = []
+    out.append("/*******************************************************************************")
+    out.append(" * File Name:   board_config.h")
+    out.append(" *")
+    out.append(" * Description: Board constants for %s." % target)
+    out.append(" *              Generated by scripts/board_config.py from")
+    out.append(" *              %s and the device" % source)
+    out.append(" *              configuration. Do not edit.")
+    out.append(" *")
+    out.append(" * Related Document: See README.md")
+    out.append(" *")
+    out.append(LICENSE)
+    out.append("")
+    out.append("#ifndef _BOARD_CONFIG_H_")
+    out.append("#define _BOARD_CONFIG_H_")
+    out.append("")
+    out.append("/* Target */")
+    out.append("#define %-40s\"%s\"" % ("BOARD_NAME", target))
+    out.append("")
+    out.append("/* From the device configuration */")
+    for name, value in lpcomp_constants(design_text):
+        out.append("#define %-40s(%s)" % ("BOARD_" + name, value))
+    out.append("")
+    out.append("/* From the board overlay */")
+    for name, value in overlay.get("constants", {}).items():
+        out.append("#define %-40s(%s)" % ("BOARD_" + name, value))
+    out.append("")
+    out.append("#endif /* _BOARD_CONFIG_H_ */")
+    out.append("")
+    out.append("/* [] END OF FILE */")
+    out.append("")
+    return "\n".join(out)
+
+
+def generate(target, overlays, designs):
+    """Returns {path: content} of the outputs of a target. designs caches the
+    device configuration of each processed target."""
+    overlay = overlays[target]
+    outputs = {}
+    design_path = os.path.join(target_dir(target), "design.modus")
+
+    if "base" in overlay:
+        base = overlay["base"]
+        if base not in designs:
+            if base not in overlays:
+                raise ConfigError("%s: unknown base target %s" % (target, base))
+            generate(base, overlays, designs)
+        designs[target] = apply_overlay(designs[base], overlay)
+        outputs[design_path] = designs[target]
+    else:
+        designs[target] = read_file(design_path)
+
+    check_slots(designs[target], signed_slots())
+    outputs[os.path.join(target_dir(target), "board_config.h")] = board_header(overlay, designs[target])
+    return outputs
+
+
+def bsp_config_dir(target):
+    """Returns the config directory of the BSP of a target, or None."""
+    for name in (target, "APP_" + target):
+        path = os.path.join(BSP_DIR, "TARGET_" + name, "config")
+        if os.path.isdir(path):
+            return path
+    return None
+
+
+def install(overlay, config_dir):
+    """Writes board_config.h into a BSP config directory from the design.modus
+    in that directory. Returns True if the file changed."""
+    content = board_header(overlay, read_file(os.path.join(config_dir, "design.modus")))
+    path = os.path.join(config_dir, "board_config.h")
+    if os.path.exists(path) and read_file(path) == content:
+        return False
+    with open(path, "w", encoding="utf-8", newline="") as f:
+        f.write(content)
+    return True
+
+
+def install_main(target):
+    if target.startswith("APP_"):
+        target = target[len("APP_"):]
+    overlays = load_overlays()
+    if target not in overlays:
+        raise ConfigError("no overlay for target %s" % target)
+
+    config_dir = bsp_config_dir(target)
+    if config_dir is None:
+        print("%s: no BSP in %s, nothing to install" % (target, os.path.relpath(BSP_DIR, ROOT_DIR)))
+        return 0
+    if install(overlays[target], config_dir):
+        print("%s: wrote %s" % (target, os.path.relpath(os.path.join(config_dir, "board_config.h"), ROOT_DIR)))
+    return 0
+
+
+def nsc_main(target):
+    if target.startswith("APP_"):
+        target = target[len("APP_"):]
+    config_dir = bsp_config_dir(target) or target_dir(target)
+    path = os.path.join(config_dir, "design.modus")
+    if not os.path.exists(path):
+        raise ConfigError("no design.modus for target %s" % target)
+
+    address, _ = nsc_region(read_file(path))
+    print("0x%08X" % address)
+    return 0
+
+
+def input_hash(target, overlays):
+    """Hash of everything the outputs of a target depend on."""
+    digest = hashlib.sha256(read_file(os.path.abspath(__file__)).encode("utf-8"))
+    for path in sorted(glob.glob(os.path.join(SIGN_CONFIG_DIR, "*.json"))):
+        digest.update(read_file(path).encode("utf-8"))
+    while True:
+        overlay = overlays[target]
+        digest.update(read_file(overlay["_path"]).encode("utf-8"))
+        if "base" not in overlay:
+            digest.update(read_file(os.path.join(target_dir(target), "design.modus")).encode("utf-8"))
+            return digest.hexdigest()
+        target = overlay["base"]
+
+
+def content_hash(content):
+    return hashlib.sha256(content.encode("utf-8")).hexdigest()
+
+
+def outputs_unchanged(entry):
+    """True if every output recorded in a cache entry is still on disk with
+    the content it was generated with."""
+    for name, digest in entry["outputs"].items():
+        path = os.path.join(ROOT_DIR, name)
+        if not os.path.exists(path) or content_hash(read_file(path)) != digest:
+            return False
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the per-board configuration.")
+    parser.add_argument("--check", action="store_true", help="compare instead of writing")
+    parser.add_argument("--force", action="store_true", help="ignore the cache")
+    parser.add_argument("--install", action="store_true", help="update board_config.h in the BSP")
+    parser.add_argument("--nsc", action="store_true", help="print the NSC region address")
+    parser.add_argument("targets", nargs="*", help="targets to process, default all")
+    args = parser.parse_args()
+
+    if args.install:
+        if len(args.targets) != 1 or args.check or args.force:
+            parser.error("--install takes exactly one target and no other option")
+        return install_main(args.targets[0])
+    if args.nsc:
+        if len(args.targets) != 1 or args.check or args.force:
+            parser.error("--nsc takes exactly one target and no other option")
+        return nsc_main(args.targets[0])
+
+    overlays = load_overlays()
+    targets = args.targets or sorted(overlays)
+    cache = {}
+    if os.path.exists(CACHE_FILE) and not args.force:
+        cache = json.loads(read_file(CACHE_FILE))
+
+    designs = {}
+    failed = False
+    for target in targets:
+        if target not in overlays:
+            raise ConfigError("no overlay for target %s" % target)
+
+        digest = input_hash(target, overlays)
+        entry = cache.get(target)
+        if (not args.check and isinstance(entry, dict) and entry["inputs"] == digest
+                and outputs_unchanged(entry)):
+            print("%s: up to date" % target)
+            continue
+
+        outputs = generate(target, overlays, designs)
+        for path, content in outputs.items():
+            current = read_file(path) if os.path.exists(path) else ""
+            if current == content:
+                continue
+            if args.check:
+                failed = True
+                sys.stdout.writelines(difflib.unified_diff(
+                    current.splitlines(keepends=True), content.splitlines(keepends=True),
+                    os.path.relpath(path, ROOT_DIR), "generated"))
+            else:
+                with open(path, "w", encoding="utf-8", newline="") as f:
+                    f.write(content)
+                print("%s: wrote %s" % (target, os.path.relpath(path, ROOT_DIR)))
+
+        cache[target] = {
+            "inputs": digest,
+            "outputs": {os.path.relpath(path, ROOT_DIR).replace(os.sep, "/"): content_hash(content)
+                        for path, content in outputs.items()},
+        }
+
+    if args.check:
+        print("generated configuration differs" if failed else "generated configuration matches")
+        return 1 if failed else 0
+
+    with open(CACHE_FILE, "w", encoding="utf-8") as f:
+        json.dump(cache, f, indent=4, sort_keys=True)
+        f.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    except ConfigError as error:
+        sys.exit("board_config.py: error: %s" % error)
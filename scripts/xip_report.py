@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+################################################################################
+# \file xip_report.py
+# \version 1.0
+#
+# \brief
+# Compares the XIP profiles from terminal logs of the XIP benchmark.
+#
+# Build the CM33 non-secure project with DEFINES+=XIP_BENCHMARK, run the
+# firmware once for every XIP profile, and save the terminal output of each
+# run to a file. A log can hold several boots; the results of all boots in a
+# log are combined. The report lists, for each test, the minimum, average and
+# maximum cycle counts of each profile and the change of the average against
+# the first profile.
+#
+# Usage:
+#   python3 scripts/xip_report.py [--csv] [--max-spread PCT] LABEL=LOG ...
+#
+#   --csv         Print comma separated values instead of a table.
+#   --max-spread  Mark results whose (max - min) / avg exceeds PCT percent,
+#                 and exit with status 1 if there is any.
+#
+################################################################################
+# \copyright
+# (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import re
+import sys
+
+HEADER_RE = re.compile(r'XIP_BENCH core clock (\d+) Hz, (\d+) runs')
+RESULT_RE = re.compile(r'XIP_BENCH (\S+)\s+min (\d+) avg (\d+) max (\d+) cycles, (\d+) KB/s')
+
+
+class ReportError(Exception):
+    pass
+
+
+class Result:
+    """Results of one test, combined over the boots of a log."""
+
+    def __init__(self):
+        self.runs = 0
+        self.min = None
+        self.max = None
+        self.cycles = 0
+        self.kbps = 0
+
+    def add(self, runs, cmin, cavg, cmax, kbps):
+        self.runs += runs
+        self.min = cmin if self.min is None else min(self.min, cmin)
+        self.max = cmax if self.max is None else max(self.max, cmax)
+        self.cycles += cavg * runs
+        self.kbps += kbps * runs
+
+    @property
+    def avg(self):
+        return self.cycles / self.runs
+
+    @property
+    def avg_kbps(self):
+        return self.kbps / self.runs
+
+    @property
+    def spread(self):
+        """(max - min) / avg in percent"""
+        return 100.0 * (self.max - self.min) / self.avg if self.avg else 0.0
+
+
+def parse_log(lines, name="log"):
+    """Returns the core clock and a dict of test name to Result."""
+    clock = None
+    runs = None
+    results = {}
+
+    for number, line in enumerate(lines, 1):
+        match = HEADER_RE.search(line)
+        if match:
+            if clock is not None and int(match.group(1)) != clock:
+                raise ReportError("%s:%d: core clock changed from %d Hz" % (name, number, clock))
+            clock = int(match.group(1))
+            runs = int(match.group(2))
+            continue
+        match = RESULT_RE.search(line)
+        if match:
+            if runs is None:
+                raise ReportError("%s:%d: result before the XIP_BENCH header" % (name, number))
+            cmin, cavg, cmax, kbps = (int(match.group(i)) for i in range(2, 6))
+            if not cmin <= cavg <= cmax:
+                raise ReportError("%s:%d: min/avg/max out of order" % (name, number))
+            results.setdefault(match.group(1), Result()).add(runs, cmin, cavg, cmax, kbps)
+
+    if not results:
+        raise ReportError("%s: no XIP_BENCH results" % name)
+    return clock, results
+
+
+def compare(logs):
+    """Takes a list of (label, (clock, results)) and returns the report rows:
+    (test, label, Result, change of the average vs. the first label in %)."""
+    clocks = set(clock for _, (clock, _) in logs)
+    if len(clocks) != 1:
+        raise ReportError("logs were taken at different core clocks: %s" %
+                          ", ".join(str(c) for c in sorted(clocks)))
+
+    tests = []
+    for _, (_, results) in logs:
+        tests.extend(t for t in results if t not in tests)
+
+    rows = []
+    for test in tests:
+        base = logs[0][1][1].get(test)
+        for label, (_, results) in logs:
+            result = results.get(test)
+            if result is None:
+                raise ReportError("%s: no result for %s" % (label, test))
+            change = 100.0 * (result.avg - base.avg) / base.avg if base and base.avg else None
+            rows.append((test, label, result, change))
+    return rows
+
+
+def format_rows(rows, csv, max_spread):
+    out = []
+    if csv:
+        out.append("test,profile,runs,min,avg,max,kbps,change_pct,spread_pct")
+        for test, label, r, change in rows:
+            out.append("%s,%s,%d,%d,%.0f,%d,%.0f,%s,%.1f" % (
+                test, label, r.runs, r.min, r.avg, r.max, r.avg_kbps,
+                "" if change is None else "%.1f" % change, r.spread))
+        return out
+
+    out.append("%-10s %-12s %5s %10s %10s %10s %8s %8s" %
+               ("test", "profile", "runs", "min", "avg", "max", "KB/s", "change"))
+    for test, label, r, change in rows:
+        mark = " noisy" if max_spread is not None and r.spread > max_spread else ""
+        out.append("%-10s %-12s %5d %10d %10.0f %10d %8.0f %7s%s" % (
+            test, label, r.runs, r.min, r.avg, r.max, r.avg_kbps,
+            "-" if change is None else "%+.1f%%" % change, mark))
+    return out
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Compare XIP profiles from XIP_BENCH logs.")
+    parser.add_argument("--csv", action="store_true", help="print comma separated values")
+    parser.add_argument("--max-spread", type=float, metavar="PCT",
+                        help="fail if (max - min) / avg of a result exceeds PCT percent")
+    parser.add_argument("logs", nargs="+", metavar="LABEL=LOG", help="profile label and log file")
+    args = parser.parse_args(argv)
+
+    logs = []
+    for arg in args.logs:
+        label, sep, path = arg.partition("=")
+        if not sep or not label or not path:
+            raise ReportError("expected LABEL=LOG, got %s" % arg)
+        with open(path, encoding="utf-8", errors="replace") as f:
+            logs.append((label, parse_log(f, path)))
+
+    rows = compare(logs)
+    for line in format_rows(rows, args.csv, args.max_spread):
+        print(line)
+
+    if args.max_spread is not None and any(r.spread > args.max_spread for _, _, r, _ in rows):
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    except (ReportError, OSError) as error:
+        sys.exit("xip_report.py: error: %s" % error)
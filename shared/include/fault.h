@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * File Name:   fault.h
+ *
+ * Description: This file is the public interface of fault.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _FAULT_H_
+#define _FAULT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "fault_record.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Core this image runs on */
+#if defined(CORE_NAME_CM55_0)
+#define FAULT_CORE_SELF                 (FAULT_CORE_CM55)
+#elif defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define FAULT_CORE_SELF                 (FAULT_CORE_CM33_S)
+#else
+#define FAULT_CORE_SELF                 (FAULT_CORE_CM33_NS)
+#endif
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void fault_set_phase(fault_phase_t phase);
+void fault_set_wakeup_source(uint32_t wakeup_source);
+bool fault_get_last(fault_record_t *record);
+void fault_clear(void);
+__NO_RETURN void fault_handle(fault_site_t site, uint32_t status);
+
+#endif /* _FAULT_H_ */
+
+/* [] END OF FILE */
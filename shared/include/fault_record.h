@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * File Name:   fault_record.h
+ *
+ * Description: This file is the public interface of fault_record.c and
+ *              contains the fault site IDs and the recovery parameters.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _FAULT_RECORD_H_
+#define _FAULT_RECORD_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Size of an encoded fault record */
+#define FAULT_RECORD_NUM_WORDS          (4U)
+
+/* Consecutive faults recovered by a reset before the device hibernates */
+#define FAULT_MAX_RETRIES               (3U)
+
+/* Back-off before the first retry, doubled on each further fault */
+#define FAULT_RETRY_BASE_S              (1U)
+
+/* Longest back-off. The RTC alarm that ends it matches the minute and the
+ * second, so it must be shorter than one hour. */
+#define FAULT_BACKOFF_MAX_S             (1800U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Place where a fault was detected. Values are stored in retained memory
+ * and must not be renumbered. */
+typedef enum
+{
+    FAULT_SITE_NONE             = 0,
+
+    /* CM33 secure */
+    FAULT_SITE_S_BSP_INIT       = 1,
+    FAULT_SITE_S_SMIF_INIT      = 2,
+    FAULT_SITE_S_MPC_INIT       = 3,
+    FAULT_SITE_S_PPC0_INIT      = 4,
+    FAULT_SITE_S_PPC1_INIT      = 5,
+    FAULT_SITE_S_RESET_CONFIG   = 6,
+
+    /* CM33 non-secure */
+    FAULT_SITE_NS_BSP_INIT      = 16,
+    FAULT_SITE_NS_UART_INIT     = 17,
+    FAULT_SITE_NS_UART_SETUP    = 18,
+    FAULT_SITE_NS_RETARGET_INIT = 19,
+    FAULT_SITE_NS_HIBERNATE     = 20,
+
+    /* CM55 */
+    FAULT_SITE_CM55_BSP_INIT    = 32
+} fault_site_t;
+
+/* Boot phase of the faulting core */
+typedef enum
+{
+    FAULT_PHASE_BOOT            = 0,    /* Before the board is initialized */
+    FAULT_PHASE_INIT            = 1,    /* Peripheral and application setup */
+    FAULT_PHASE_RUN             = 2     /* Main loop */
+} fault_phase_t;
+
+/* Core that detected the fault */
+typedef enum
+{
+    FAULT_CORE_CM33_S           = 0,
+    FAULT_CORE_CM33_NS          = 1,
+    FAULT_CORE_CM55             = 2
+} fault_core_t;
+
+/* Recovery action for a fault */
+typedef enum
+{
+    FAULT_ACTION_RETRY          = 0,    /* Hibernate for the back-off, then reset */
+    FAULT_ACTION_HIBERNATE      = 1,    /* Hibernate until the wakeup source or
+                                         * the end of the back-off */
+    FAULT_ACTION_HALT           = 2     /* Stay in DeepSleep */
+} fault_action_t;
+
+/* Decoded fault record */
+typedef struct
+{
+    uint8_t site;                       /* fault_site_t */
+    uint8_t phase;                      /* fault_phase_t */
+    uint8_t core;                       /* fault_core_t */
+    uint8_t count;                      /* Consecutive faults without a completed boot */
+    uint32_t status;                    /* Status or result code at the site */
+    uint32_t reset_reason;              /* Reset reason of the faulting boot */
+} fault_record_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void fault_record_encode(const fault_record_t *record,
+                         uint32_t words[FAULT_RECORD_NUM_WORDS]);
+bool fault_record_decode(const uint32_t words[FAULT_RECORD_NUM_WORDS],
+                         fault_record_t *record);
+uint8_t fault_record_next_count(const uint32_t words[FAULT_RECORD_NUM_WORDS]);
+fault_action_t fault_recovery_action(const fault_record_t *record,
+                                     uint32_t *backoff_s);
+
+#endif /* _FAULT_RECORD_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * File Name:   retained_data.h
+ *
+ * Description: This file contains the allocation of the backup registers,
+ *              which keep their contents in Hibernate mode and are used to
+ *              carry application state from one wakeup to the next.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _RETAINED_DATA_H_
+#define _RETAINED_DATA_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Backup register words used by the wake governor (wake_governor.c) */
+#define RETAINED_GOVERNOR_WORD          (0U)
+#define RETAINED_GOVERNOR_NUM_WORDS     (3U)
+
+/* Backup register words holding the last fault record (fault.c), shared
+ * by all cores */
+#define RETAINED_FAULT_WORD             (RETAINED_GOVERNOR_WORD + \
+                                         RETAINED_GOVERNOR_NUM_WORDS)
+#define RETAINED_FAULT_NUM_WORDS        (4U)
+
+/* Backup register words holding the runtime parameters set over the debug
+ * UART (cmd_uart.c) */
+#define RETAINED_PARAMS_WORD            (RETAINED_FAULT_WORD + \
+                                         RETAINED_FAULT_NUM_WORDS)
+#define RETAINED_PARAMS_NUM_WORDS       (3U)
+
+/* Total number of backup register words used by the application */
+#define RETAINED_NUM_WORDS              (RETAINED_PARAMS_WORD + \
+                                         RETAINED_PARAMS_NUM_WORDS)
+
+#if (RETAINED_NUM_WORDS > CY_SRSS_BACKUP_NUM_BREG)
+#error "Retained data does not fit into the backup registers"
+#endif
+
+#endif /* _RETAINED_DATA_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * File Name:   secure_batch.h
+ *
+ * Description: This file is the public interface of secure_batch.c and of
+ *              the non-secure callable functions of the CM33 secure
+ *              project. It is shared by both CM33 projects.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _SECURE_BATCH_H_
+#define _SECURE_BATCH_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Batch identification, "SBAT" */
+#define SECURE_BATCH_MAGIC              (0x53424154UL)
+
+/* Largest number of requests in one batch */
+#define SECURE_BATCH_MAX_REQUESTS       (8U)
+
+/* Functions called from the non-secure state through a secure gateway */
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define SECURE_BATCH_NSC                __attribute__((cmse_nonsecure_entry))
+#else
+#define SECURE_BATCH_NSC
+#endif
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Secure services. Values are part of the secure interface and must not be
+ * renumbered. */
+typedef enum
+{
+    SECURE_SVC_NOP              = 0,    /* No operation, for overhead measurements */
+    SECURE_SVC_RESET_REASON     = 1,    /* Reset reason seen by the secure boot */
+    SECURE_SVC_SMIF_STATUS      = 2,    /* Result of the external memory init */
+    SECURE_SVC_XIP_PROFILE      = 3,    /* XIP profile ID built into the secure image */
+    SECURE_SVC_RETAINED_READ    = 4,    /* Backup register word <arg> */
+    SECURE_NUM_SVCS             = 5
+} secure_svc_t;
+
+/* Status of a request or of a batch */
+typedef enum
+{
+    SECURE_STATUS_OK            = 0,
+    SECURE_STATUS_PENDING       = 1,    /* Not executed */
+    SECURE_STATUS_BAD_SERVICE   = 2,    /* Unknown service */
+    SECURE_STATUS_BAD_ARG       = 3,    /* Argument rejected by the service */
+    SECURE_STATUS_BAD_BATCH     = 4,    /* Bad magic, count or address */
+    SECURE_STATUS_FULL          = 5     /* No room for another request */
+} secure_status_t;
+
+/* Request descriptor. service and arg are written by the non-secure side,
+ * the other fields by the secure side. */
+typedef struct
+{
+    uint16_t service;                   /* secure_svc_t */
+    uint16_t status;                    /* secure_status_t */
+    uint32_t arg;
+    uint32_t result;
+    uint32_t cycles;                    /* CPU cycles spent in the service */
+} secure_request_t;
+
+/* Batch of requests executed with one transition into the secure state */
+typedef struct
+{
+    uint32_t magic;                     /* SECURE_BATCH_MAGIC */
+    uint32_t count;                     /* Number of requests */
+    uint32_t cycles;                    /* CPU cycles spent in the dispatcher */
+    secure_request_t requests[SECURE_BATCH_MAX_REQUESTS];
+} secure_batch_t;
+
+/* Secure service handler */
+typedef secure_status_t (*secure_service_fn_t)(uint32_t arg, uint32_t *result);
+
+/* Free-running cycle counter used for the accounting */
+typedef uint32_t (*secure_cycles_fn_t)(void);
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void secure_batch_init(secure_batch_t *batch);
+secure_status_t secure_batch_add(secure_batch_t *batch, secure_svc_t service,
+                                 uint32_t arg);
+secure_status_t secure_batch_validate(const secure_batch_t *batch);
+secure_status_t secure_batch_dispatch(secure_batch_t *batch,
+                                      const secure_service_fn_t services[SECURE_NUM_SVCS],
+                                      secure_cycles_fn_t cycles);
+
+/* Non-secure callable functions of the CM33 secure project. Available when
+ * both CM33 projects are built with SECURE_BATCH=1 (see common.mk). */
+SECURE_BATCH_NSC uint32_t secure_batch_call(secure_batch_t *batch);
+SECURE_BATCH_NSC uint32_t secure_service_call(uint32_t service, uint32_t arg,
+                                              uint32_t *result);
+
+#endif /* _SECURE_BATCH_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * File Name:   telemetry.h
+ *
+ * Description: This file is the public interface of telemetry.c and contains
+ *              the layout of the telemetry block shared by the CM33
+ *              non-secure and CM55 applications.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Telemetry block identification. The version is incremented on every
+ * change of the block layout. */
+#define TELEMETRY_MAGIC             (0x544C4D59UL)
+#define TELEMETRY_VERSION           (3U)
+
+/* Log2 histogram of the active time per wakeup: bin n counts wakeups that
+ * stayed active for 2^n to 2^(n+1)-1 microseconds. */
+#define TELEMETRY_HIST_BINS         (16U)
+
+/* Start of the CM33/CM55 shared SOCMEM region as seen by each core. Must
+ * be aligned to TELEMETRY_CACHE_LINE. */
+#if !defined(TELEMETRY_BLOCK_ADDR)
+#if defined(CORE_NAME_CM55_0)
+#define TELEMETRY_BLOCK_ADDR        (CYMEM_CM55_0_m33_m55_shared_START)
+#else
+#define TELEMETRY_BLOCK_ADDR        (CYMEM_CM33_0_m33_m55_shared_START)
+#endif
+#endif /* !defined(TELEMETRY_BLOCK_ADDR) */
+
+/* CM55 data cache line. Each section starts on a line of its own and fills
+ * whole lines, so cleaning or invalidating one section never touches the
+ * section of the other core. */
+#define TELEMETRY_CACHE_LINE        (32U)
+
+/* idle_hint_ms value when no further work is planned for the CM55 */
+#define TELEMETRY_IDLE_UNBOUNDED    (0xFFFFFFFFUL)
+
+/* Number of attempts telemetry_read() makes before giving up */
+#define TELEMETRY_READ_RETRIES      (16U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Writer of a telemetry section */
+typedef enum
+{
+    TELEMETRY_CORE_CM33 = 0,
+    TELEMETRY_CORE_CM55 = 1,
+    TELEMETRY_NUM_CORES = 2
+} telemetry_core_t;
+
+/* Cause of the last wakeup */
+typedef enum
+{
+    TELEMETRY_WAKE_POWER_ON  = 0,   /* Power-on or other reset */
+    TELEMETRY_WAKE_HIBERNATE = 1,   /* Reset on wakeup from Hibernate */
+    TELEMETRY_WAKE_DEEPSLEEP = 2,   /* Interrupt wakeup from DeepSleep */
+    TELEMETRY_WAKE_TIMER     = 3,   /* LED pattern timer wakeup */
+    TELEMETRY_WAKE_SLEEP     = 4    /* Interrupt wakeup from Sleep */
+} telemetry_wake_t;
+
+/* Per-core telemetry section. Each section has exactly one writer and is
+ * protected by its own sequence counter: the counter is odd while an update
+ * is in progress and a snapshot is consistent if the counter was even and
+ * unchanged across the copy. */
+typedef struct
+{
+    volatile uint32_t seq;
+    uint32_t boot_time_us;          /* From main() entry to the main loop */
+    uint32_t last_wake;             /* telemetry_wake_t */
+    uint32_t deepsleep_wakes;       /* Wakeups from DeepSleep in this boot */
+    uint32_t sleep_entries;         /* Sleep and DeepSleep entries in this boot */
+    uint32_t storms;                /* Wake storms detected since power-on */
+    uint32_t absorbed;              /* Wakeups served from DeepSleep since power-on */
+    uint32_t idle_hint_ms;          /* CM33: expected idle interval of the CM55 */
+    uint32_t idle_state;            /* CM55: idle state chosen on the last entry */
+    uint32_t off_request;           /* CM55: non-zero while waiting for power-off */
+    uint32_t active_hist[TELEMETRY_HIST_BINS];
+    uint32_t reserved[6];           /* Pads the section to whole cache lines */
+} telemetry_section_t;
+
+/* Telemetry block at the start of the shared region */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;                  /* sizeof(telemetry_block_t) */
+    uint32_t reserved[6];           /* Starts the sections on a cache line */
+    telemetry_section_t core[TELEMETRY_NUM_CORES];
+} telemetry_block_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void telemetry_init(telemetry_core_t core);
+telemetry_section_t *telemetry_begin(telemetry_core_t core);
+void telemetry_end(telemetry_core_t core);
+bool telemetry_read(const telemetry_block_t *block, telemetry_core_t core,
+                    telemetry_section_t *snapshot);
+void telemetry_hist_add(telemetry_section_t *section, uint32_t active_us);
+void telemetry_timer_start(void);
+uint32_t telemetry_timer_us(void);
+
+#endif /* _TELEMETRY_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * File Name:   fault.c
+ *
+ * Description: This file contains the fault handler shared by all cores. A
+ *              fault is recorded in the backup registers and followed by a
+ *              bounded recovery action instead of a busy loop, and the
+ *              record is reported by the CM33 non-secure application on the
+ *              next boot.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "fault.h"
+#include "retained_data.h"
+
+#if (RETAINED_FAULT_NUM_WORDS != FAULT_RECORD_NUM_WORDS)
+#error "Backup register allocation does not match the fault record size"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RTC alarm that ends the back-off in Hibernate */
+#define FAULT_RTC_ALARM                 (CY_RTC_ALARM_1)
+#define FAULT_RTC_ALARM_INTR            (CY_RTC_INTR_ALARM1)
+
+#define FAULT_SECONDS_PER_MINUTE        (60U)
+#define FAULT_MINUTES_PER_HOUR          (60U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static fault_phase_t fault_phase = FAULT_PHASE_BOOT;
+
+/* Hibernate wakeup source armed by the fault handler, none until set */
+static uint32_t fault_wakeup_source = 0U;
+
+/*******************************************************************************
+* Function Name: fault_set_phase
+********************************************************************************
+* Summary:
+* Sets the boot phase stored with the next fault record.
+*
+* Parameters:
+*  phase: Current boot phase
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fault_set_phase(fault_phase_t phase)
+{
+    fault_phase = phase;
+}
+
+/*******************************************************************************
+* Function Name: fault_set_wakeup_source
+********************************************************************************
+* Summary:
+* Sets the wakeup source armed when a fault puts the device into Hibernate.
+* Called by the application once the source is configured, and again when
+* it changes. Until then, only the RTC alarm at the end of the back-off
+* wakes the device.
+*
+* Parameters:
+*  wakeup_source: Wakeup source for Cy_SysPm_SetHibernateWakeupSource(), or
+*                 0 for none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fault_set_wakeup_source(uint32_t wakeup_source)
+{
+    fault_wakeup_source = wakeup_source;
+}
+
+/*******************************************************************************
+* Function Name: fault_arm_alarm
+********************************************************************************
+* Summary:
+* Arms the RTC alarm backoff_s seconds from now as a Hibernate wakeup source.
+* The alarm matches the minute and the second only, which is enough for a
+* back-off of less than one hour.
+*
+* Parameters:
+*  backoff_s: Time to the alarm in seconds, below one hour
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fault_arm_alarm(uint32_t backoff_s)
+{
+    cy_stc_rtc_config_t now;
+    cy_stc_rtc_alarm_t alarm;
+    uint32_t alarm_s;
+
+    Cy_RTC_GetDateAndTime(&now);
+    alarm_s = (now.min * FAULT_SECONDS_PER_MINUTE) + now.sec + backoff_s;
+
+    /* The fields that are not matched must still hold valid values */
+    alarm = (cy_stc_rtc_alarm_t)
+    {
+        .sec            = alarm_s % FAULT_SECONDS_PER_MINUTE,
+        .secEn          = CY_RTC_ALARM_ENABLE,
+        .min            = (alarm_s / FAULT_SECONDS_PER_MINUTE) % FAULT_MINUTES_PER_HOUR,
+        .minEn          = CY_RTC_ALARM_ENABLE,
+        .hour           = 0U,
+        .hourEn         = CY_RTC_ALARM_DISABLE,
+        .dayOfWeek      = CY_RTC_SUNDAY,
+        .dayOfWeekEn    = CY_RTC_ALARM_DISABLE,
+        .date           = 1U,
+        .dateEn         = CY_RTC_ALARM_DISABLE,
+        .month          = CY_RTC_JANUARY,
+        .monthEn        = CY_RTC_ALARM_DISABLE,
+        .almEn          = CY_RTC_ALARM_ENABLE
+    };
+
+    Cy_RTC_ClearInterrupt(FAULT_RTC_ALARM_INTR);
+    if (CY_RTC_SUCCESS == Cy_RTC_SetAlarmDateAndTime(&alarm, FAULT_RTC_ALARM))
+    {
+        Cy_RTC_SetInterruptMask(Cy_RTC_GetInterruptMask() | FAULT_RTC_ALARM_INTR);
+        Cy_SysPm_SetHibernateWakeupSource((uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM);
+    }
+}
+
+/*******************************************************************************
+* Function Name: fault_disarm_alarm
+********************************************************************************
+* Summary:
+* Removes the RTC alarm armed by the fault handler, which would otherwise
+* wake the device from the next Hibernate entries of the application.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fault_disarm_alarm(void)
+{
+    Cy_SysPm_ClearHibernateWakeupSource((uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM);
+    Cy_RTC_SetInterruptMask(Cy_RTC_GetInterruptMask() & ~FAULT_RTC_ALARM_INTR);
+    Cy_RTC_ClearInterrupt(FAULT_RTC_ALARM_INTR);
+}
+
+/*******************************************************************************
+* Function Name: fault_get_last
+********************************************************************************
+* Summary:
+* Reads the fault record from the backup registers.
+*
+* Parameters:
+*  record: Destination of the record
+*
+* Return:
+*  bool: true if a fault was recorded since the last fault_clear()
+*
+*******************************************************************************/
+bool fault_get_last(fault_record_t *record)
+{
+    uint32_t words[FAULT_RECORD_NUM_WORDS];
+
+    Cy_SysPm_BackupWordReStore(RETAINED_FAULT_WORD, words,
+                               FAULT_RECORD_NUM_WORDS);
+
+    return fault_record_decode(words, record);
+}
+
+/*******************************************************************************
+* Function Name: fault_clear
+********************************************************************************
+* Summary:
+* Clears the fault record and the RTC alarm of the fault handler. Called once
+* the boot has completed, which also restarts the count of consecutive
+* faults.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fault_clear(void)
+{
+    uint32_t words[FAULT_RECORD_NUM_WORDS] = { 0U };
+
+    Cy_SysPm_BackupWordStore(RETAINED_FAULT_WORD, words,
+                             FAULT_RECORD_NUM_WORDS);
+    fault_disarm_alarm();
+}
+
+/*******************************************************************************
+* Function Name: fault_handle
+********************************************************************************
+* Summary:
+* Records a fault and recovers from it as decided by
+* fault_recovery_action(). Both the retry and the Hibernate action wait for
+* the back-off in Hibernate with the RTC alarm armed, so the device never
+* waits at full power and always wakes up again. The wakeup from Hibernate
+* is a reset, which retries the boot. The Hibernate action also arms the
+* wakeup source set by fault_set_wakeup_source(). The CM55 halts in
+* DeepSleep. Debug builds stop at CY_ASSERT() only if the recovery did not
+* leave the handler.
+*
+* If the Hibernate entry of a retry fails, the system is reset at once. The
+* non-secure image resets the system with NVIC_SystemReset() as well. The
+* core ignores that request while AIRCR.SYSRESETREQS is set, and the bit
+* reads as zero from the non-secure state, so the CM33 secure project clears
+* and checks it before it starts the non-secure application.
+*
+* Parameters:
+*  site: Place where the fault was detected
+*  status: Status or result code at the site
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fault_handle(fault_site_t site, uint32_t status)
+{
+    fault_record_t record;
+    uint32_t words[FAULT_RECORD_NUM_WORDS];
+    uint32_t backoff_s;
+    fault_action_t action;
+
+    /* Disable all interrupts. */
+    __disable_irq();
+
+    Cy_SysPm_BackupWordReStore(RETAINED_FAULT_WORD, words,
+                               FAULT_RECORD_NUM_WORDS);
+
+    record.site = (uint8_t)site;
+    record.phase = (uint8_t)fault_phase;
+    record.core = (uint8_t)FAULT_CORE_SELF;
+    record.count = fault_record_next_count(words);
+    record.status = status;
+    record.reset_reason = Cy_SysLib_GetResetReason();
+
+    fault_record_encode(&record, words);
+    Cy_SysPm_BackupWordStore(RETAINED_FAULT_WORD, words,
+                             FAULT_RECORD_NUM_WORDS);
+
+    action = fault_recovery_action(&record, &backoff_s);
+    switch (action)
+    {
+        case FAULT_ACTION_RETRY:
+        case FAULT_ACTION_HIBERNATE:
+            /* A retry waits for the whole back-off, even if the wakeup
+             * source of an earlier Hibernate entry is still set */
+            if (0U != fault_wakeup_source)
+            {
+                if (FAULT_ACTION_RETRY == action)
+                {
+                    Cy_SysPm_ClearHibernateWakeupSource(fault_wakeup_source);
+                }
+                else
+                {
+                    Cy_SysPm_SetHibernateWakeupSource(fault_wakeup_source);
+                }
+            }
+            fault_arm_alarm(backoff_s);
+            (void)Cy_SysPm_SystemEnterHibernate();
+
+            if (FAULT_ACTION_RETRY == action)
+            {
+                NVIC_SystemReset();
+            }
+            break;
+
+        case FAULT_ACTION_HALT:
+        default:
+            break;
+    }
+
+    /* Halt, or Hibernate entry failed */
+    CY_ASSERT(0);
+
+    for (;;)
+    {
+        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * File Name:   fault_record.c
+ *
+ * Description: This file contains the codec of the fault record kept in
+ *              retained memory and the recovery policy applied to it. It
+ *              has no device dependencies.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "fault_record.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Word 0: magic, site, phase, core and count */
+#define FAULT_RECORD_MAGIC              (0xFAUL)
+#define FAULT_RECORD_MAGIC_POS          (24U)
+#define FAULT_RECORD_SITE_POS           (16U)
+#define FAULT_RECORD_PHASE_POS          (12U)
+#define FAULT_RECORD_CORE_POS           (8U)
+#define FAULT_RECORD_NIBBLE_MSK         (0x0FUL)
+#define FAULT_RECORD_BYTE_MSK           (0xFFUL)
+
+/* Word 3 is the complement of the XOR of words 0 to 2, so that cleared or
+ * random backup register contents are not taken for a record */
+#define FAULT_RECORD_CHECK(w0, w1, w2)  (~((w0) ^ (w1) ^ (w2)))
+
+/*******************************************************************************
+* Function Name: fault_record_encode
+********************************************************************************
+* Summary:
+* Packs a fault record into words for the backup registers. The phase and
+* the core are stored in four bits each.
+*
+* Parameters:
+*  record: Record to encode
+*  words: Encoded record
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fault_record_encode(const fault_record_t *record,
+                         uint32_t words[FAULT_RECORD_NUM_WORDS])
+{
+    words[0] = (FAULT_RECORD_MAGIC << FAULT_RECORD_MAGIC_POS) |
+               ((uint32_t)record->site << FAULT_RECORD_SITE_POS) |
+               (((uint32_t)record->phase & FAULT_RECORD_NIBBLE_MSK) << FAULT_RECORD_PHASE_POS) |
+               (((uint32_t)record->core & FAULT_RECORD_NIBBLE_MSK) << FAULT_RECORD_CORE_POS) |
+               (uint32_t)record->count;
+    words[1] = record->status;
+    words[2] = record->reset_reason;
+    words[3] = FAULT_RECORD_CHECK(words[0], words[1], words[2]);
+}
+
+/*******************************************************************************
+* Function Name: fault_record_decode
+********************************************************************************
+* Summary:
+* Unpacks a fault record read from the backup registers.
+*
+* Parameters:
+*  words: Encoded record
+*  record: Decoded record
+*
+* Return:
+*  bool: false if the words do not hold a valid record
+*
+*******************************************************************************/
+bool fault_record_decode(const uint32_t words[FAULT_RECORD_NUM_WORDS],
+                         fault_record_t *record)
+{
+    if ((FAULT_RECORD_MAGIC != (words[0] >> FAULT_RECORD_MAGIC_POS)) ||
+        (FAULT_RECORD_CHECK(words[0], words[1], words[2]) != words[3]))
+    {
+        return false;
+    }
+
+    record->site = (uint8_t)((words[0] >> FAULT_RECORD_SITE_POS) & FAULT_RECORD_BYTE_MSK);
+    record->phase = (uint8_t)((words[0] >> FAULT_RECORD_PHASE_POS) & FAULT_RECORD_NIBBLE_MSK);
+    record->core = (uint8_t)((words[0] >> FAULT_RECORD_CORE_POS) & FAULT_RECORD_NIBBLE_MSK);
+    record->count = (uint8_t)(words[0] & FAULT_RECORD_BYTE_MSK);
+    record->status = words[1];
+    record->reset_reason = words[2];
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: fault_record_next_count
+********************************************************************************
+* Summary:
+* Returns the count of consecutive faults for a new fault, from the record
+* read from the backup registers. The count starts again at one if there is
+* no valid record, and saturates at UINT8_MAX.
+*
+* Parameters:
+*  words: Encoded record of the previous fault
+*
+* Return:
+*  uint8_t: Count including the new fault
+*
+*******************************************************************************/
+uint8_t fault_record_next_count(const uint32_t words[FAULT_RECORD_NUM_WORDS])
+{
+    fault_record_t last;
+
+    if (!fault_record_decode(words, &last))
+    {
+        return 1U;
+    }
+
+    return (last.count < UINT8_MAX) ? (uint8_t)(last.count + 1U) : last.count;
+}
+
+/*******************************************************************************
+* Function Name: fault_recovery_action
+********************************************************************************
+* Summary:
+* Returns the recovery action for a fault. The back-off starts at
+* FAULT_RETRY_BASE_S and doubles with each consecutive fault, up to
+* FAULT_BACKOFF_MAX_S. The first FAULT_MAX_RETRIES consecutive faults are
+* retried with a reset at the end of the back-off. Further faults put the
+* device into Hibernate until the next wakeup event or the end of the
+* back-off, so a persistent fault costs Hibernate current instead of a busy
+* loop. The CM55 cannot reset or hibernate the system and always halts in
+* DeepSleep.
+*
+* Parameters:
+*  record: Record of the fault, with count including this fault
+*  backoff_s: Back-off in seconds, 0 for FAULT_ACTION_HALT
+*
+* Return:
+*  fault_action_t: Recovery action
+*
+*******************************************************************************/
+fault_action_t fault_recovery_action(const fault_record_t *record,
+                                     uint32_t *backoff_s)
+{
+    uint32_t backoff = FAULT_RETRY_BASE_S;
+
+    *backoff_s = 0U;
+
+    if ((uint8_t)FAULT_CORE_CM55 == record->core)
+    {
+        return FAULT_ACTION_HALT;
+    }
+
+    /* A count of 0 does not come from fault_record_next_count() */
+    if (0U == record->count)
+    {
+        backoff = FAULT_BACKOFF_MAX_S;
+    }
+    for (uint32_t n = 1U; (n < record->count) && (backoff < FAULT_BACKOFF_MAX_S); n++)
+    {
+        backoff <<= 1U;
+    }
+    *backoff_s = (backoff < FAULT_BACKOFF_MAX_S) ? backoff : FAULT_BACKOFF_MAX_S;
+
+    if ((0U == record->count) || (record->count > FAULT_MAX_RETRIES))
+    {
+        return FAULT_ACTION_HIBERNATE;
+    }
+
+    return FAULT_ACTION_RETRY;
+}
+
+/* [] END OF FILE */
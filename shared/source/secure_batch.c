@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * File Name:   secure_batch.c
+ *
+ * Description: This file contains the descriptor handling of the batched
+ *              secure service interface: building a batch on the
+ *              non-secure side, and validating and dispatching it on the
+ *              secure side. It has no device dependencies.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include "secure_batch.h"
+
+/*******************************************************************************
+* Function Name: secure_batch_init
+********************************************************************************
+* Summary:
+* Empties a batch.
+*
+* Parameters:
+*  batch: Batch to initialize
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void secure_batch_init(secure_batch_t *batch)
+{
+    batch->magic = SECURE_BATCH_MAGIC;
+    batch->count = 0U;
+    batch->cycles = 0U;
+}
+
+/*******************************************************************************
+* Function Name: secure_batch_add
+********************************************************************************
+* Summary:
+* Appends a request to a batch. The result is available in
+* batch->requests[] at the same position after secure_batch_call().
+*
+* Parameters:
+*  batch: Batch to append to
+*  service: Requested service
+*  arg: Argument of the service
+*
+* Return:
+*  secure_status_t: SECURE_STATUS_OK, or SECURE_STATUS_FULL
+*
+*******************************************************************************/
+secure_status_t secure_batch_add(secure_batch_t *batch, secure_svc_t service,
+                                 uint32_t arg)
+{
+    secure_request_t *request;
+
+    if (batch->count >= SECURE_BATCH_MAX_REQUESTS)
+    {
+        return SECURE_STATUS_FULL;
+    }
+
+    request = &batch->requests[batch->count++];
+    request->service = (uint16_t)service;
+    request->status = (uint16_t)SECURE_STATUS_PENDING;
+    request->arg = arg;
+    request->result = 0U;
+    request->cycles = 0U;
+
+    return SECURE_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: secure_batch_validate
+********************************************************************************
+* Summary:
+* Checks the header of a batch. Requests for unknown services do not
+* invalidate the batch; they are rejected one by one by
+* secure_batch_dispatch().
+*
+* Parameters:
+*  batch: Batch to check
+*
+* Return:
+*  secure_status_t: SECURE_STATUS_OK, or SECURE_STATUS_BAD_BATCH
+*
+*******************************************************************************/
+secure_status_t secure_batch_validate(const secure_batch_t *batch)
+{
+    if ((NULL == batch) ||
+        (SECURE_BATCH_MAGIC != batch->magic) ||
+        (0U == batch->count) ||
+        (batch->count > SECURE_BATCH_MAX_REQUESTS))
+    {
+        return SECURE_STATUS_BAD_BATCH;
+    }
+
+    return SECURE_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: secure_batch_dispatch
+********************************************************************************
+* Summary:
+* Validates a batch and executes its requests in order. Each request gets
+* its own status, result and cycle count, and the batch gets the cycles
+* spent in the whole dispatch. The secure caller must pass a copy of the
+* non-secure batch, so that the requests cannot change while they are
+* checked and executed.
+*
+* Parameters:
+*  batch: Batch to execute
+*  services: Service handlers indexed by secure_svc_t, NULL if not provided
+*  cycles: Cycle counter for the accounting
+*
+* Return:
+*  secure_status_t: SECURE_STATUS_OK if the requests were executed, or
+*  SECURE_STATUS_BAD_BATCH
+*
+*******************************************************************************/
+secure_status_t secure_batch_dispatch(secure_batch_t *batch,
+                                      const secure_service_fn_t services[SECURE_NUM_SVCS],
+                                      secure_cycles_fn_t cycles)
+{
+    uint32_t batch_start = cycles();
+    uint32_t start;
+    secure_request_t *request;
+
+    if (SECURE_STATUS_OK != secure_batch_validate(batch))
+    {
+        return SECURE_STATUS_BAD_BATCH;
+    }
+
+    for (uint32_t i = 0U; i < batch->count; i++)
+    {
+        request = &batch->requests[i];
+        request->result = 0U;
+        request->cycles = 0U;
+
+        if ((request->service >= (uint16_t)SECURE_NUM_SVCS) ||
+            (NULL == services[request->service]))
+        {
+            request->status = (uint16_t)SECURE_STATUS_BAD_SERVICE;
+            continue;
+        }
+
+        start = cycles();
+        request->status = (uint16_t)services[request->service](request->arg,
+                                                               &request->result);
+        request->cycles = cycles() - start;
+    }
+
+    batch->cycles = cycles() - batch_start;
+
+    return SECURE_STATUS_OK;
+}
+
+/* [] END OF FILE */
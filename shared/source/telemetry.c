@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * File Name:   telemetry.c
+ *
+ * Description: This file contains the telemetry block in the CM33/CM55 shared
+ *              memory region. Each core updates its own section with seqlock
+ *              semantics, so a debugger, the secure core or a host reading
+ *              over SWD can take a consistent snapshot at any time without
+ *              interrupting the application.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "telemetry.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TELEMETRY_US_PER_SEC        (1000000UL)
+
+_Static_assert((sizeof(telemetry_section_t) % TELEMETRY_CACHE_LINE) == 0U,
+               "Telemetry section must fill whole cache lines");
+_Static_assert((offsetof(telemetry_block_t, core) % TELEMETRY_CACHE_LINE) == 0U,
+               "Telemetry sections must start on a cache line");
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static telemetry_block_t * const telemetry_block =
+                                    (telemetry_block_t *)TELEMETRY_BLOCK_ADDR;
+
+/*******************************************************************************
+* Function Name: telemetry_clean
+********************************************************************************
+* Summary:
+* Starts the write-back of the first bytes of a telemetry section from the
+* data cache, if the core has one, so that other bus masters see the update.
+* The write-back is complete only after a __DSB().
+*
+* Parameters:
+*  section: Section to write back
+*  size: Number of bytes from the start of the section
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void telemetry_clean(telemetry_section_t *section, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void *)section, (int32_t)size);
+#else
+    CY_UNUSED_PARAMETER(section);
+    CY_UNUSED_PARAMETER(size);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: telemetry_invalidate
+********************************************************************************
+* Summary:
+* Discards the data cache lines of a telemetry section, if the core has a
+* data cache, so that the next read fetches the section from memory.
+*
+* Parameters:
+*  section: Section to invalidate
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void telemetry_invalidate(const telemetry_section_t *section)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((void *)section, (int32_t)sizeof(*section));
+#else
+    CY_UNUSED_PARAMETER(section);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: telemetry_init
+********************************************************************************
+* Summary:
+* Clears the section of the calling core. The CM33 also writes the block
+* header and clears the CM55 section, so it must be called by the CM33
+* before the CM55 is enabled.
+*
+* Parameters:
+*  core: Calling core
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void telemetry_init(telemetry_core_t core)
+{
+    if (TELEMETRY_CORE_CM33 == core)
+    {
+        memset(telemetry_block, 0, sizeof(*telemetry_block));
+        telemetry_block->magic = TELEMETRY_MAGIC;
+        telemetry_block->version = TELEMETRY_VERSION;
+        telemetry_block->size = (uint16_t)sizeof(*telemetry_block);
+    }
+    else
+    {
+        memset(&telemetry_block->core[core], 0, sizeof(telemetry_section_t));
+        telemetry_clean(&telemetry_block->core[core], sizeof(telemetry_section_t));
+        __DSB();
+    }
+}
+
+/*******************************************************************************
+* Function Name: telemetry_begin
+********************************************************************************
+* Summary:
+* Starts an update of the section of the calling core. The sequence counter
+* becomes odd, which makes concurrent readers retry. The line holding the
+* counter is in memory before any field is changed. Must be paired with
+* telemetry_end() and must not be nested.
+*
+* Parameters:
+*  core: Calling core
+*
+* Return:
+*  telemetry_section_t*: Section to update
+*
+*******************************************************************************/
+telemetry_section_t *telemetry_begin(telemetry_core_t core)
+{
+    telemetry_section_t *section = &telemetry_block->core[core];
+
+    section->seq++;
+    telemetry_clean(section, TELEMETRY_CACHE_LINE);
+    __DSB();
+
+    return section;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_end
+********************************************************************************
+* Summary:
+* Completes an update of the section of the calling core. The section is
+* written back while the sequence counter is still odd; only then does the
+* counter become even, and its line is written back on its own. The cache
+* may evict lines in any order, so a reader can see an even counter in
+* memory only after the whole section has reached it.
+*
+* Parameters:
+*  core: Calling core
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void telemetry_end(telemetry_core_t core)
+{
+    telemetry_section_t *section = &telemetry_block->core[core];
+
+    telemetry_clean(section, sizeof(*section));
+    __DSB();
+    section->seq++;
+    telemetry_clean(section, TELEMETRY_CACHE_LINE);
+    __DSB();
+}
+
+/*******************************************************************************
+* Function Name: telemetry_read
+********************************************************************************
+* Summary:
+* Copies a consistent snapshot of a telemetry section. The copy is retried
+* while the writer is updating the section. The reader never blocks the
+* writer.
+*
+* Parameters:
+*  block: Telemetry block, TELEMETRY_BLOCK_ADDR on the device
+*  core: Section to read
+*  snapshot: Destination of the snapshot
+*
+* Return:
+*  bool: false if no consistent snapshot was taken within
+*        TELEMETRY_READ_RETRIES attempts
+*
+*******************************************************************************/
+bool telemetry_read(const telemetry_block_t *block, telemetry_core_t core,
+                    telemetry_section_t *snapshot)
+{
+    const telemetry_section_t *section = &block->core[core];
+    uint32_t seq;
+
+    if ((TELEMETRY_MAGIC != block->magic) ||
+        (TELEMETRY_VERSION != block->version))
+    {
+        return false;
+    }
+
+    for (uint32_t attempt = 0U; attempt < TELEMETRY_READ_RETRIES; attempt++)
+    {
+        telemetry_invalidate(section);
+        seq = section->seq;
+
+        if (0U != (seq & 1U))
+        {
+            continue;
+        }
+
+        __DMB();
+        memcpy(snapshot, (const void *)section, sizeof(*snapshot));
+        __DMB();
+
+        /* Fetch the counter from memory again, not from the line that was
+         * just copied */
+        telemetry_invalidate(section);
+        if (seq == section->seq)
+        {
+            snapshot->seq = seq;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_hist_add
+********************************************************************************
+* Summary:
+* Adds an active time to the log2 histogram of a section. Must be called
+* between telemetry_begin() and telemetry_end().
+*
+* Parameters:
+*  section: Section being updated
+*  active_us: Active time in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void telemetry_hist_add(telemetry_section_t *section, uint32_t active_us)
+{
+    uint32_t bin = (0U == active_us) ? 0U : (31U - __CLZ(active_us));
+
+    if (bin >= TELEMETRY_HIST_BINS)
+    {
+        bin = TELEMETRY_HIST_BINS - 1U;
+    }
+
+    section->active_hist[bin]++;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_timer_start
+********************************************************************************
+* Summary:
+* Enables and clears the DWT cycle counter used for the timing fields. The
+* counter only runs while the CPU is active and wraps after 2^32 cycles.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void telemetry_timer_start(void)
+{
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_timer_us
+********************************************************************************
+* Summary:
+* Returns the active time since telemetry_timer_start().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Active time in microseconds
+*
+*******************************************************************************/
+uint32_t telemetry_timer_us(void)
+{
+    return DWT->CYCCNT / (SystemCoreClock / TELEMETRY_US_PER_SEC);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * File Name:   board_config.h
+ *
+ * Description: Board constants for KIT_PSE84_EVAL_EPC2.
+ *              Generated by scripts/board_config.py from
+ *              templates/boards/KIT_PSE84_EVAL_EPC2.json and the device
+ *              configuration. Do not edit.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _BOARD_CONFIG_H_
+#define _BOARD_CONFIG_H_
+
+/* Target */
+#define BOARD_NAME                              "KIT_PSE84_EVAL_EPC2"
+
+/* From the device configuration */
+#define BOARD_LPCOMP_POWER_MODE                 (CY_LPCOMP_MODE_ULP)
+
+/* From the board overlay */
+#define BOARD_LPCOMP_SETTLE_TIME_US             (50U)
+#define BOARD_CM55_IDLE_HINT_MS                 (0xFFFFFFFFUL)
+
+#endif /* _BOARD_CONFIG_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * File Name:   strategy_trace_csv.c
+ *
+ * Description: This file contains the host loader of comparator input
+ *              traces for the wait strategy benchmark. A trace is a CSV file
+ *              with one time_ms,level row per sample of the comparator
+ *              output, for example exported from a logic analyzer capture.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "strategy_trace_csv.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define STRATEGY_CSV_LINE_SIZE          (128U)
+#define STRATEGY_CSV_INITIAL_EDGES      (64U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const strategy_csv_status_names[] =
+{
+    "ok",
+    "read error",
+    "expected time_ms,level",
+    "time goes backwards",
+    "empty trace",
+    "out of memory"
+};
+
+/*******************************************************************************
+* Function Name: strategy_csv_number
+********************************************************************************
+* Summary:
+* Parses a decimal field that ends at a comma, at the end of the line or
+* before trailing white space.
+*
+* Parameters:
+*  text: Field, updated to the character after the number
+*  value: Parsed value
+*
+* Return:
+*  bool: false if the field is not a number up to UINT32_MAX
+*
+*******************************************************************************/
+static bool strategy_csv_number(const char **text, uint32_t *value)
+{
+    char *end;
+    unsigned long long number;
+
+    while ((' ' == **text) || ('\t' == **text))
+    {
+        (*text)++;
+    }
+    if (!isdigit((unsigned char)**text))
+    {
+        return false;
+    }
+
+    errno = 0;
+    number = strtoull(*text, &end, 10);
+    if ((0 != errno) || (number > UINT32_MAX))
+    {
+        return false;
+    }
+
+    *text = end;
+    while (isspace((unsigned char)**text))
+    {
+        (*text)++;
+    }
+    *value = (uint32_t)number;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: strategy_csv_read
+********************************************************************************
+* Summary:
+* Loads a trace from a CSV file. Each row holds the time in milliseconds from
+* the start of the capture and the input level, 0 or 1, from that time on.
+* Blank lines, lines starting with '#' and a header in the first line are
+* skipped. Rows that do not change the level are merged, and the input is
+* LOW before the first row. The trace ends at the time of the last row.
+*
+* Parameters:
+*  file: CSV file
+*  name: Trace name printed in the report, not copied
+*  trace: Loaded trace, released with strategy_csv_free()
+*  line: Line of the error, or the number of lines read
+*
+* Return:
+*  strategy_csv_status_t: STRATEGY_CSV_OK if the trace was loaded
+*
+*******************************************************************************/
+strategy_csv_status_t strategy_csv_read(FILE *file, const char *name,
+                                        strategy_trace_t *trace,
+                                        uint32_t *line)
+{
+    char text[STRATEGY_CSV_LINE_SIZE];
+    const char *field;
+    strategy_edge_t *edges = NULL;
+    strategy_edge_t *grown;
+    uint32_t capacity = 0U;
+    uint32_t num_edges = 0U;
+    uint32_t rows = 0U;
+    uint32_t time_ms;
+    uint32_t level;
+    uint32_t last_ms = 0U;
+    uint8_t last_level = 0U;
+    bool overlong;
+    strategy_csv_status_t status = STRATEGY_CSV_OK;
+
+    *trace = (strategy_trace_t){ name, NULL, 0U, 0U };
+    *line = 0U;
+
+    while (NULL != fgets(text, (int)sizeof(text), file))
+    {
+        (*line)++;
+
+        /* Drop the rest of an overlong line. Only a comment can be one. */
+        overlong = (NULL == strchr(text, '\n')) && !feof(file);
+        if (overlong)
+        {
+            int c;
+
+            do
+            {
+                c = fgetc(file);
+            } while ((EOF != c) && ('\n' != c));
+        }
+
+        field = text;
+        while (isspace((unsigned char)*field))
+        {
+            field++;
+        }
+        if (('\0' == *field) || ('#' == *field) ||
+            ((1U == *line) && !isdigit((unsigned char)*field)))
+        {
+            continue;
+        }
+
+        if (overlong || !strategy_csv_number(&field, &time_ms) || (',' != *field))
+        {
+            status = STRATEGY_CSV_SYNTAX;
+            break;
+        }
+        field++;
+        if (!strategy_csv_number(&field, &level) || ('\0' != *field) || (level > 1U))
+        {
+            status = STRATEGY_CSV_SYNTAX;
+            break;
+        }
+        if ((0U != rows) && (time_ms < last_ms))
+        {
+            status = STRATEGY_CSV_ORDER;
+            break;
+        }
+
+        rows++;
+        last_ms = time_ms;
+        if ((uint8_t)level == last_level)
+        {
+            continue;
+        }
+
+        if (num_edges == capacity)
+        {
+            capacity = (0U == capacity) ? STRATEGY_CSV_INITIAL_EDGES : (2U * capacity);
+            grown = realloc(edges, capacity * sizeof(*edges));
+            if (NULL == grown)
+            {
+                status = STRATEGY_CSV_MEMORY;
+                break;
+            }
+            edges = grown;
+        }
+        edges[num_edges].time_ms = time_ms;
+        edges[num_edges].level = (uint8_t)level;
+        num_edges++;
+        last_level = (uint8_t)level;
+    }
+
+    if ((STRATEGY_CSV_OK == status) && ferror(file))
+    {
+        status = STRATEGY_CSV_IO;
+    }
+    if ((STRATEGY_CSV_OK == status) && (0U == last_ms))
+    {
+        status = STRATEGY_CSV_EMPTY;
+    }
+
+    if (STRATEGY_CSV_OK != status)
+    {
+        free(edges);
+        return status;
+    }
+
+    trace->edges = edges;
+    trace->num_edges = num_edges;
+    trace->duration_ms = last_ms;
+
+    return STRATEGY_CSV_OK;
+}
+
+/*******************************************************************************
+* Function Name: strategy_csv_free
+********************************************************************************
+* Summary:
+* Releases the edges of a trace loaded with strategy_csv_read().
+*
+* Parameters:
+*  trace: Loaded trace
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void strategy_csv_free(strategy_trace_t *trace)
+{
+    free((void *)trace->edges);
+    trace->edges = NULL;
+    trace->num_edges = 0U;
+}
+
+/*******************************************************************************
+* Function Name: strategy_csv_status_name
+********************************************************************************
+* Summary:
+* Returns a short description of a load result.
+*
+* Parameters:
+*  status: Load result
+*
+* Return:
+*  const char*: Description
+*
+*******************************************************************************/
+const char *strategy_csv_status_name(strategy_csv_status_t status)
+{
+    return strategy_csv_status_names[status];
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * File Name:   strategy_trace_csv.h
+ *
+ * Description: This file is the public interface of strategy_trace_csv.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _STRATEGY_TRACE_CSV_H_
+#define _STRATEGY_TRACE_CSV_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "strategy_bench.h"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Result of loading a trace */
+typedef enum
+{
+    STRATEGY_CSV_OK             = 0,
+    STRATEGY_CSV_IO             = 1,    /* The file could not be read */
+    STRATEGY_CSV_SYNTAX         = 2,    /* Row is not time_ms,level */
+    STRATEGY_CSV_ORDER          = 3,    /* Time lower than in the previous row */
+    STRATEGY_CSV_EMPTY          = 4,    /* No rows, or a trace of 0 ms */
+    STRATEGY_CSV_MEMORY         = 5     /* Out of memory */
+} strategy_csv_status_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+strategy_csv_status_t strategy_csv_read(FILE *file, const char *name,
+                                        strategy_trace_t *trace,
+                                        uint32_t *line);
+void strategy_csv_free(strategy_trace_t *trace);
+const char *strategy_csv_status_name(strategy_csv_status_t status);
+
+#endif /* _STRATEGY_TRACE_CSV_H_ */
+
+/* [] END OF FILE */
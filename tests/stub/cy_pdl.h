@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * File Name:   cy_pdl.h
+ *
+ * Description: This file is the host stand-in for the PDL. It declares the
+ *              subset of the PDL types and functions used by the modules
+ *              under test. The functions are implemented by the hardware
+ *              model in pdl_model.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _CY_PDL_H_
+#define _CY_PDL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Compiler
+*******************************************************************************/
+#define __NO_RETURN                     __attribute__((noreturn))
+#define __DMB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                         model_dsb()
+#define __CLZ(x)                        ((uint32_t)__builtin_clz(x))
+#define CY_UNUSED_PARAMETER(x)          ((void)(x))
+#define CY_ASSERT(x)                    ((void)(x))
+#define __disable_irq()                 ((void)Cy_SysLib_EnterCriticalSection())
+
+#define CY_ARRAY_SIZE(x)                (sizeof(x) / sizeof((x)[0]))
+
+/*******************************************************************************
+* Core debug
+*******************************************************************************/
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    uint32_t DEMCR;
+} DCB_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+#define DCB_DEMCR_TRCENA_Msk            (1UL << 24U)
+
+extern DWT_Type model_dwt;
+extern DCB_Type model_dcb;
+extern uint32_t SystemCoreClock;
+#define DWT                             (&model_dwt)
+#define DCB                             (&model_dcb)
+
+/*******************************************************************************
+* Data cache, modelled over the shared region only
+*******************************************************************************/
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t dsize);
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t dsize);
+
+/*******************************************************************************
+* Interrupts
+*******************************************************************************/
+typedef int32_t IRQn_Type;
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS   = 0u,
+    CY_SYSINT_BAD_PARAM = 1u
+} cy_en_sysint_status_t;
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+__NO_RETURN void NVIC_SystemReset(void);
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+typedef struct
+{
+    uint32_t out;
+    uint32_t intr_mask;
+    uint32_t intr_cfg;                  /* 2-bit edge per pin */
+} GPIO_PRT_Type;
+
+#define CY_GPIO_INTR_DISABLE            (0UL)
+#define CY_GPIO_INTR_RISING             (1UL)
+#define CY_GPIO_INTR_FALLING            (2UL)
+#define CY_GPIO_INTR_BOTH               (3UL)
+
+void Cy_GPIO_Write(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+uint32_t Cy_GPIO_ReadOut(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_SetInterruptEdge(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum);
+
+/*******************************************************************************
+* SCB UART
+*******************************************************************************/
+typedef struct
+{
+    uint32_t rx_intr_mask;
+} CySCB_Type;
+
+#define CY_SCB_RX_INTR_NOT_EMPTY        (1UL << 2U)
+
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base);
+void Cy_SCB_UART_ClearRxFifo(CySCB_Type *base);
+void Cy_SCB_SetRxInterruptMask(CySCB_Type *base, uint32_t interruptMask);
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t interruptMask);
+
+/*******************************************************************************
+* MCWDT
+*******************************************************************************/
+typedef struct
+{
+    uint32_t reserved;
+} MCWDT_STRUCT_Type;
+
+typedef enum
+{
+    CY_MCWDT_COUNTER0   = 0u,
+    CY_MCWDT_COUNTER1   = 1u,
+    CY_MCWDT_COUNTER2   = 2u
+} cy_en_mcwdtcounter_t;
+
+typedef enum
+{
+    CY_MCWDT_SUCCESS    = 0u,
+    CY_MCWDT_BAD_PARAM  = 1u
+} cy_en_mcwdt_status_t;
+
+#define CY_MCWDT_CTR0                   (1UL)
+#define CY_MCWDT_CTR1                   (2UL)
+#define CY_MCWDT_MODE_NONE              (0U)
+#define CY_MCWDT_MODE_INT               (1U)
+
+typedef struct
+{
+    uint16_t c0Match;
+    uint16_t c1Match;
+    uint32_t c0Mode;
+    uint32_t c1Mode;
+    uint32_t c2Mode;
+    uint32_t c2ToggleBit;
+    bool c0ClearOnMatch;
+    bool c1ClearOnMatch;
+    bool c0c1Cascade;
+    bool c1c2Cascade;
+} cy_stc_mcwdt_config_t;
+
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config);
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters, uint16_t waitUs);
+void Cy_MCWDT_Disable(MCWDT_STRUCT_Type *base, uint32_t counters, uint16_t waitUs);
+void Cy_MCWDT_ResetCounters(MCWDT_STRUCT_Type *base, uint32_t counters,
+                            uint16_t waitUs);
+void Cy_MCWDT_SetMatch(MCWDT_STRUCT_Type *base, cy_en_mcwdtcounter_t counter,
+                       uint32_t match, uint16_t waitUs);
+void Cy_MCWDT_SetInterruptMask(MCWDT_STRUCT_Type *base, uint32_t counters);
+void Cy_MCWDT_ClearInterrupt(MCWDT_STRUCT_Type *base, uint32_t counters);
+uint32_t Cy_MCWDT_GetInterruptStatusMasked(MCWDT_STRUCT_Type const *base);
+
+/*******************************************************************************
+* SysPm
+*******************************************************************************/
+typedef enum
+{
+    CY_SYSPM_WAIT_FOR_INTERRUPT = 0u,
+    CY_SYSPM_WAIT_FOR_EVENT     = 1u
+} cy_en_syspm_waitfor_t;
+
+typedef enum
+{
+    CY_SYSPM_SUCCESS    = 0u,
+    CY_SYSPM_FAIL       = 2u
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSPM_HIBERNATE_LPCOMP0_LOW  = 0x1u,
+    CY_SYSPM_HIBERNATE_LPCOMP0_HIGH = 0x2u,
+    CY_SYSPM_HIBERNATE_RTC_ALARM    = 0x4u
+} cy_en_syspm_hibernate_wakeup_source_t;
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor);
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor);
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource);
+void Cy_SysPm_ClearHibernateWakeupSource(uint32_t wakeupSource);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHibernate(void);
+
+/*******************************************************************************
+* Backup domain
+*******************************************************************************/
+#define CY_SRSS_BACKUP_NUM_BREG         (16U)
+
+typedef struct
+{
+    uint32_t sec;
+    uint32_t min;
+    uint32_t hour;
+    uint32_t amPm;
+    uint32_t hrFormat;
+    uint32_t dayOfWeek;
+    uint32_t date;
+    uint32_t month;
+    uint32_t year;
+} cy_stc_rtc_config_t;
+
+typedef enum
+{
+    CY_RTC_ALARM_DISABLE    = 0u,
+    CY_RTC_ALARM_ENABLE     = 1u
+} cy_en_rtc_alarm_enable_t;
+
+typedef enum
+{
+    CY_RTC_ALARM_1          = 0u,
+    CY_RTC_ALARM_2          = 1u
+} cy_en_rtc_alarm_t;
+
+typedef enum
+{
+    CY_RTC_SUCCESS          = 0u,
+    CY_RTC_BAD_PARAM        = 1u
+} cy_en_rtc_status_t;
+
+typedef struct
+{
+    uint32_t sec;
+    cy_en_rtc_alarm_enable_t secEn;
+    uint32_t min;
+    cy_en_rtc_alarm_enable_t minEn;
+    uint32_t hour;
+    cy_en_rtc_alarm_enable_t hourEn;
+    uint32_t dayOfWeek;
+    cy_en_rtc_alarm_enable_t dayOfWeekEn;
+    uint32_t date;
+    cy_en_rtc_alarm_enable_t dateEn;
+    uint32_t month;
+    cy_en_rtc_alarm_enable_t monthEn;
+    cy_en_rtc_alarm_enable_t almEn;
+} cy_stc_rtc_alarm_t;
+
+#define CY_RTC_SUNDAY                   (1UL)
+#define CY_RTC_JANUARY                  (1UL)
+#define CY_RTC_INTR_ALARM1              (1UL << 0U)
+#define CY_RTC_INTR_ALARM2              (1UL << 1U)
+
+void Cy_RTC_GetDateAndTime(cy_stc_rtc_config_t *dateTime);
+cy_en_rtc_status_t Cy_RTC_SetAlarmDateAndTime(cy_stc_rtc_alarm_t const *alarmDateTime,
+                                              cy_en_rtc_alarm_t alarmIndex);
+void Cy_RTC_SetInterruptMask(uint32_t interruptMask);
+uint32_t Cy_RTC_GetInterruptMask(void);
+void Cy_RTC_ClearInterrupt(uint32_t interruptMask);
+void Cy_SysPm_BackupWordStore(uint32_t wordIndex, uint32_t *wordSrcPointer,
+                              size_t wordSize);
+void Cy_SysPm_BackupWordReStore(uint32_t wordIndex, uint32_t *wordDstPointer,
+                                size_t wordSize);
+
+/*******************************************************************************
+* LPComp
+*******************************************************************************/
+typedef struct
+{
+    uint32_t reserved;
+} LPCOMP_Type;
+
+typedef struct
+{
+    uint32_t reserved;
+} cy_stc_lpcomp_context_t;
+
+typedef enum
+{
+    CY_LPCOMP_CHANNEL_0 = 0x1u,
+    CY_LPCOMP_CHANNEL_1 = 0x2u
+} cy_en_lpcomp_channel_t;
+
+typedef enum
+{
+    CY_LPCOMP_MODE_OFF      = 0u,
+    CY_LPCOMP_MODE_ULP      = 1u,
+    CY_LPCOMP_MODE_LP       = 2u,
+    CY_LPCOMP_MODE_NORMAL   = 3u
+} cy_en_lpcomp_pwr_t;
+
+typedef enum
+{
+    CY_LPCOMP_HYST_DISABLE  = 0u,
+    CY_LPCOMP_HYST_ENABLE   = 1u
+} cy_en_lpcomp_hyst_t;
+
+uint32_t Cy_LPComp_GetCompare(LPCOMP_Type const *base,
+                              cy_en_lpcomp_channel_t channel);
+void Cy_LPComp_SetPower(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                        cy_en_lpcomp_pwr_t power,
+                        cy_stc_lpcomp_context_t *context);
+void Cy_LPComp_SetHysteresis(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                             cy_en_lpcomp_hyst_t hysteresis);
+
+/*******************************************************************************
+* SysLib
+*******************************************************************************/
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+uint32_t Cy_SysLib_GetResetReason(void);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+
+/*******************************************************************************
+* RRAM
+*******************************************************************************/
+typedef struct
+{
+    uint32_t reserved;
+} RRAMC_Type;
+
+typedef enum
+{
+    CY_RRAM_SUCCESS     = 0u,
+    CY_RRAM_BAD_PARAM   = 1u
+} cy_en_rram_status_t;
+
+extern RRAMC_Type model_rramc0;
+#define RRAMC0                          (&model_rramc0)
+
+cy_en_rram_status_t Cy_RRAM_NvmWriteByteArray(RRAMC_Type *base, uintptr_t addr,
+                                              const uint8_t *data, uint32_t size);
+
+/*******************************************************************************
+* SMIF memory configuration, the fields used by the application only
+*******************************************************************************/
+#define CY_SMIF_FLAG_WR_EN              (1UL << 2U)
+#define CY_SMIF_FLAG_MERGE_ENABLE       (1UL << 5U)
+
+typedef enum
+{
+    CY_SMIF_SUCCESS                     = 0u,
+    CY_SMIF_BAD_PARAM                   = 1u
+} cy_en_smif_status_t;
+
+typedef enum
+{
+    CY_SMIF_MERGE_TIMEOUT_1_CYCLE       = 0u,
+    CY_SMIF_MERGE_TIMEOUT_16_CYCLES     = 1u,
+    CY_SMIF_MERGE_TIMEOUT_256_CYCLES    = 2u,
+    CY_SMIF_MERGE_TIMEOUT_4096_CYCLES   = 3u,
+    CY_SMIF_MERGE_TIMEOUT_65536_CYCLE   = 4u
+} cy_en_smif_merge_timeout_t;
+
+typedef struct
+{
+    uint32_t command;
+    uint32_t dummyCycles;
+} cy_stc_smif_mem_cmd_t;
+
+typedef struct
+{
+    uint32_t numOfAddrBytes;
+    uint32_t memSize;
+    cy_stc_smif_mem_cmd_t *readCmd;
+} cy_stc_smif_mem_device_cfg_t;
+
+typedef struct
+{
+    uint32_t baseAddress;
+    uint32_t memMappedSize;
+    uint32_t flags;
+    cy_stc_smif_mem_device_cfg_t *deviceCfg;
+    cy_en_smif_merge_timeout_t mergeTimeout;
+} cy_stc_smif_mem_config_t;
+
+typedef struct
+{
+    uint32_t memCount;
+    cy_stc_smif_mem_config_t **memConfig;
+    uint32_t majorVersion;
+    uint32_t minorVersion;
+} cy_stc_smif_block_config_t;
+
+/*******************************************************************************
+* Hardware model
+*******************************************************************************/
+#include "pdl_model.h"
+
+#endif /* _CY_PDL_H_ */
+
+/* [] END OF FILE */
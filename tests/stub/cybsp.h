@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * File Name:   cybsp.h
+ *
+ * Description: This file is the host stand-in for the BSP header.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _CYBSP_H_
+#define _CYBSP_H_
+
+#include "cy_pdl.h"
+
+/* Board resources, mapped to the hardware model */
+#define CYBSP_LED_RED_PORT              (&model_gpio[MODEL_PORT_LED_RED])
+#define CYBSP_LED_RED_PIN               (0U)
+#define CYBSP_LED_GREEN_PORT            (&model_gpio[MODEL_PORT_LED_GREEN])
+#define CYBSP_LED_GREEN_PIN             (0U)
+
+#define CYBSP_CM33_LPTIMER_0_HW         (&model_mcwdt0)
+#define CYBSP_CM33_LPTIMER_0_IRQ        (MODEL_IRQ_MCWDT)
+
+#define CYBSP_DEBUG_UART_HW             (&model_scb)
+#define CYBSP_DEBUG_UART_IRQ            (MODEL_IRQ_UART)
+#define CYBSP_DEBUG_UART_RX_PORT        (&model_gpio[MODEL_PORT_UART_RX])
+#define CYBSP_DEBUG_UART_RX_PIN         (0U)
+#define CYBSP_DEBUG_UART_RX_IRQ         (MODEL_IRQ_UART_RX_PIN)
+
+#endif /* _CYBSP_H_ */
+
+/* [] END OF FILE */
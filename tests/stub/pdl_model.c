@@ -0,0 +1,1167 @@
+/*******************************************************************************
+ * File Name:   pdl_model.c
+ *
+ * Description: This file contains the hardware model behind the host
+ *              stand-in PDL: a simulated clock advanced by the delay
+ *              functions, a comparator driven by the test, a simulated RRAM
+ *              region, a UART receiver fed by the test, and the random
+ *              numbers used by the signal models.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "cy_retarget_io.h"
+#include "arm_cmse.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint64_t model_time_us;
+uint64_t model_mark_us;
+model_lpcomp_fn_t model_lpcomp;
+uint32_t model_lpcomp_power;
+uint32_t model_lpcomp_hyst;
+uint8_t model_rram[MODEL_RRAM_SIZE];
+uint8_t model_shared[MODEL_SHARED_SIZE] __attribute__((aligned(32)));
+RRAMC_Type model_rramc0;
+GPIO_PRT_Type model_gpio[MODEL_NUM_PORTS];
+model_gpio_fn_t model_gpio_hook;
+MCWDT_STRUCT_Type model_mcwdt0;
+uint32_t model_deepsleeps;
+uint32_t model_sleeps;
+uint64_t model_deepsleep_us;
+uint64_t model_sleep_us;
+CySCB_Type model_scb;
+uint32_t model_uart_lost;
+uint32_t model_backup[CY_SRSS_BACKUP_NUM_BREG];
+uint32_t model_rtc_base_s;
+cy_stc_rtc_alarm_t model_rtc_alarm[2];
+uint32_t model_rtc_intr_mask;
+uint32_t model_rtc_intr;
+uint32_t model_hib_wakeup;
+cy_en_syspm_status_t model_hib_status;
+uint32_t model_hibernates;
+uint32_t model_system_resets;
+uint32_t model_reset_reason;
+jmp_buf *model_exit;
+uint8_t model_dcache[MODEL_SHARED_SIZE] __attribute__((aligned(32)));
+model_dcache_fn_t model_dcache_hook;
+bool model_dcache_evict;
+uint8_t model_ns_ram[MODEL_NS_RAM_SIZE] __attribute__((aligned(32)));
+uint32_t model_cmse_checks;
+DWT_Type model_dwt;
+DCB_Type model_dcb;
+uint32_t SystemCoreClock = 200000000UL;
+
+static uint64_t model_rng = 0x9E3779B97F4A7C15ULL;
+
+/* NVIC and PRIMASK */
+static cy_israddress model_isr[MODEL_NUM_IRQS];
+static bool model_irq_enabled[MODEL_NUM_IRQS];
+static bool model_irq_pending[MODEL_NUM_IRQS];
+static bool model_irq_masked;
+static uint32_t model_irqs_taken;       /* Handlers run, ends a CPU wait */
+
+/* CPU in DeepSleep, where the UART does not receive */
+static bool model_cpu_deepsleep;
+
+/* UART: bytes queued by the test, in time order, and the receive FIFO */
+static struct
+{
+    uint64_t time_us[MODEL_UART_MAX_RX];
+    uint8_t byte[MODEL_UART_MAX_RX];
+    uint32_t head;
+    uint32_t count;
+    uint8_t fifo[MODEL_UART_FIFO_SIZE];
+    uint32_t fifo_head;
+    uint32_t fifo_count;
+} model_uart;
+
+/* Data cache: clean operations not completed by a DSB, in issue order */
+static struct
+{
+    uint32_t line[MODEL_DCACHE_LINES];
+    uint32_t count;
+} model_dcache_pending;
+
+/* MCWDT counters 0 and 1, in LFCLK ticks. Both clear on match. */
+#define MODEL_MCWDT_COUNTERS            (2U)
+
+static struct
+{
+    struct
+    {
+        bool enabled;
+        uint32_t match;
+        uint64_t start_tick;            /* Tick at which the counter was 0 */
+    } ctr[MODEL_MCWDT_COUNTERS];
+    uint32_t intr;                      /* CY_MCWDT_CTRx bits */
+    uint32_t intr_mask;
+} model_mcwdt;
+
+/*******************************************************************************
+* Function Name: model_reset
+********************************************************************************
+* Summary:
+* Returns the model to its power-on state. The RRAM contents are erased.
+*
+*******************************************************************************/
+void model_reset(void)
+{
+    model_time_us = 0U;
+    model_mark_us = 0U;
+    model_lpcomp = NULL;
+    model_lpcomp_power = (uint32_t)CY_LPCOMP_MODE_OFF;
+    model_lpcomp_hyst = (uint32_t)CY_LPCOMP_HYST_DISABLE;
+    memset(model_rram, 0xFF, sizeof(model_rram));
+    memset(model_shared, 0xA5, sizeof(model_shared));
+    memset(model_dcache, 0xA5, sizeof(model_dcache));
+    model_dcache_hook = NULL;
+    model_dcache_evict = false;
+    memset(&model_dcache_pending, 0, sizeof(model_dcache_pending));
+    memset(model_ns_ram, 0, sizeof(model_ns_ram));
+    model_cmse_checks = 0U;
+    memset(model_gpio, 0, sizeof(model_gpio));
+    model_gpio_hook = NULL;
+    model_deepsleeps = 0U;
+    model_sleeps = 0U;
+    model_deepsleep_us = 0U;
+    model_sleep_us = 0U;
+    memset(&model_scb, 0, sizeof(model_scb));
+    model_uart_lost = 0U;
+    memset(&model_uart, 0, sizeof(model_uart));
+    model_cpu_deepsleep = false;
+    memset(model_backup, 0, sizeof(model_backup));
+    model_rtc_base_s = 0U;
+    memset(model_rtc_alarm, 0, sizeof(model_rtc_alarm));
+    model_rtc_intr_mask = 0U;
+    model_rtc_intr = 0U;
+    model_hib_wakeup = 0U;
+    model_hib_status = CY_SYSPM_SUCCESS;
+    model_hibernates = 0U;
+    model_system_resets = 0U;
+    model_reset_reason = 0U;
+    model_exit = NULL;
+
+    memset(model_isr, 0, sizeof(model_isr));
+    memset(model_irq_enabled, 0, sizeof(model_irq_enabled));
+    memset(model_irq_pending, 0, sizeof(model_irq_pending));
+    model_irq_masked = false;
+    model_irqs_taken = 0U;
+    memset(&model_mcwdt, 0, sizeof(model_mcwdt));
+}
+
+/*******************************************************************************
+* Function Name: model_seed / model_rand / model_uniform / model_gauss
+********************************************************************************
+* Summary:
+* Deterministic random numbers for the signal models: xorshift64*, uniform
+* in [0, 1), and standard normal by the Box-Muller transform.
+*
+*******************************************************************************/
+void model_seed(uint64_t seed)
+{
+    model_rng = (0U != seed) ? seed : 0x9E3779B97F4A7C15ULL;
+}
+
+uint32_t model_rand(void)
+{
+    model_rng ^= model_rng >> 12U;
+    model_rng ^= model_rng << 25U;
+    model_rng ^= model_rng >> 27U;
+
+    return (uint32_t)((model_rng * 0x2545F4914F6CDD1DULL) >> 32U);
+}
+
+double model_uniform(void)
+{
+    return (double)model_rand() / 4294967296.0;
+}
+
+double model_gauss(void)
+{
+    double u1 = model_uniform();
+    double u2 = model_uniform();
+
+    if (u1 < 1e-12)
+    {
+        u1 = 1e-12;
+    }
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/*******************************************************************************
+* Function Name: model_irq_run
+********************************************************************************
+* Summary:
+* Runs the handlers of the pending and enabled interrupts while PRIMASK is
+* clear. Handlers run with interrupts masked, as they do not nest here.
+*
+*******************************************************************************/
+static void model_irq_run(void)
+{
+    bool ran = true;
+
+    while (ran && !model_irq_masked)
+    {
+        ran = false;
+        for (int32_t irq = 0; irq < MODEL_NUM_IRQS; irq++)
+        {
+            if (model_irq_pending[irq] && model_irq_enabled[irq] &&
+                (NULL != model_isr[irq]))
+            {
+                model_irq_pending[irq] = false;
+                model_irq_masked = true;
+                model_isr[irq]();
+                model_irq_masked = false;
+                model_irqs_taken++;
+                ran = true;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: model_irq_waiting
+********************************************************************************
+* Summary:
+* Returns whether an enabled interrupt is pending, which wakes the CPU from
+* WFI even while PRIMASK is set.
+*
+*******************************************************************************/
+static bool model_irq_waiting(void)
+{
+    for (int32_t irq = 0; irq < MODEL_NUM_IRQS; irq++)
+    {
+        if (model_irq_pending[irq] && model_irq_enabled[irq])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void model_irq_set_pending(IRQn_Type irq)
+{
+    model_irq_pending[irq] = true;
+    model_irq_run();
+}
+
+/*******************************************************************************
+* Function Name: model_mcwdt_now / model_mcwdt_next_us
+********************************************************************************
+* Summary:
+* Converts between the simulated time and LFCLK ticks, and returns the time
+* of the next match of a counter, or UINT64_MAX if the counter is stopped.
+* The counters clear on match, so a match value m gives a period of m + 1
+* ticks. Without a counter, returns the earliest match of all counters.
+*
+*******************************************************************************/
+static uint64_t model_mcwdt_now(void)
+{
+    return (model_time_us * MODEL_LFCLK_HZ) / 1000000U;
+}
+
+static uint64_t model_mcwdt_counter_next_us(uint32_t counter)
+{
+    uint64_t tick;
+
+    if (!model_mcwdt.ctr[counter].enabled)
+    {
+        return UINT64_MAX;
+    }
+
+    tick = model_mcwdt.ctr[counter].start_tick + model_mcwdt.ctr[counter].match + 1U;
+
+    return ((tick * 1000000U) + MODEL_LFCLK_HZ - 1U) / MODEL_LFCLK_HZ;
+}
+
+static uint64_t model_mcwdt_next_us(void)
+{
+    uint64_t next_us = UINT64_MAX;
+    uint64_t counter_us;
+
+    for (uint32_t counter = 0U; counter < MODEL_MCWDT_COUNTERS; counter++)
+    {
+        counter_us = model_mcwdt_counter_next_us(counter);
+        if (counter_us < next_us)
+        {
+            next_us = counter_us;
+        }
+    }
+
+    return next_us;
+}
+
+/*******************************************************************************
+* Function Name: model_mcwdt_match
+********************************************************************************
+* Summary:
+* Clears the counters that match at the current time and raises their
+* interrupts.
+*
+*******************************************************************************/
+static void model_mcwdt_match(void)
+{
+    for (uint32_t counter = 0U; counter < MODEL_MCWDT_COUNTERS; counter++)
+    {
+        if (model_mcwdt_counter_next_us(counter) <= model_time_us)
+        {
+            model_mcwdt.ctr[counter].start_tick += model_mcwdt.ctr[counter].match + 1U;
+            model_mcwdt.intr |= 1UL << counter;
+        }
+    }
+
+    if (0U != (model_mcwdt.intr & model_mcwdt.intr_mask))
+    {
+        model_irq_set_pending(MODEL_IRQ_MCWDT);
+    }
+}
+
+/*******************************************************************************
+* Function Name: model_uart_next_us / model_uart_deliver
+********************************************************************************
+* Summary:
+* Returns the time of the next queued byte, or UINT64_MAX if none, and
+* delivers it. In DeepSleep, the byte is lost, and its start bit raises the
+* RX pin interrupt if it is armed on the falling edge. Otherwise the byte
+* enters the FIFO and raises the receive interrupt if it is enabled.
+*
+*******************************************************************************/
+static uint64_t model_uart_next_us(void)
+{
+    return (0U == model_uart.count) ? UINT64_MAX : model_uart.time_us[model_uart.head];
+}
+
+static void model_uart_deliver(void)
+{
+    GPIO_PRT_Type *rx_port = &model_gpio[MODEL_PORT_UART_RX];
+    uint8_t byte = model_uart.byte[model_uart.head];
+
+    model_uart.head = (model_uart.head + 1U) % MODEL_UART_MAX_RX;
+    model_uart.count--;
+
+    if (model_cpu_deepsleep)
+    {
+        model_uart_lost++;
+        if ((0U != (rx_port->intr_mask & 1U)) &&
+            (0U != (rx_port->intr_cfg & CY_GPIO_INTR_FALLING)))
+        {
+            model_irq_set_pending(MODEL_IRQ_UART_RX_PIN);
+        }
+        return;
+    }
+
+    if (model_uart.fifo_count >= MODEL_UART_FIFO_SIZE)
+    {
+        model_uart_lost++;
+        return;
+    }
+
+    model_uart.fifo[(model_uart.fifo_head + model_uart.fifo_count) % MODEL_UART_FIFO_SIZE] = byte;
+    model_uart.fifo_count++;
+    if (0U != (model_scb.rx_intr_mask & CY_SCB_RX_INTR_NOT_EMPTY))
+    {
+        model_irq_set_pending(MODEL_IRQ_UART);
+    }
+}
+
+/*******************************************************************************
+* Function Name: model_uart_rx / model_uart_queued
+********************************************************************************
+* Summary:
+* Queues the bytes of text on the UART receive line, one every
+* MODEL_UART_BYTE_US from time_us, and returns the number of bytes not
+* delivered yet. Bytes must be queued in time order.
+*
+*******************************************************************************/
+void model_uart_rx(uint64_t time_us, const char *text)
+{
+    uint32_t tail;
+
+    for (const char *c = text; '\0' != *c; c++)
+    {
+        tail = (model_uart.head + model_uart.count) % MODEL_UART_MAX_RX;
+        if ((model_uart.count >= MODEL_UART_MAX_RX) ||
+            ((0U != model_uart.count) &&
+             (time_us < model_uart.time_us[(tail + MODEL_UART_MAX_RX - 1U) % MODEL_UART_MAX_RX])))
+        {
+            fprintf(stderr, "model: UART queue full or out of order\n");
+            abort();
+        }
+
+        model_uart.time_us[tail] = time_us;
+        model_uart.byte[tail] = (uint8_t)*c;
+        model_uart.count++;
+        time_us += MODEL_UART_BYTE_US;
+    }
+}
+
+uint32_t model_uart_queued(void)
+{
+    return model_uart.count;
+}
+
+/*******************************************************************************
+* Function Name: model_run_until
+********************************************************************************
+* Summary:
+* Advances the simulated time to time_us, raising the timer and UART
+* interrupts that fall due on the way. Handlers run at their due time unless
+* PRIMASK is set.
+*
+*******************************************************************************/
+void model_run_until(uint64_t time_us)
+{
+    uint64_t mcwdt_us = model_mcwdt_next_us();
+    uint64_t rx_us = model_uart_next_us();
+
+    while ((mcwdt_us <= time_us) || (rx_us <= time_us))
+    {
+        if (mcwdt_us <= rx_us)
+        {
+            model_time_us = mcwdt_us;
+            model_mcwdt_match();
+        }
+        else
+        {
+            if (rx_us > model_time_us)
+            {
+                model_time_us = rx_us;
+            }
+            model_uart_deliver();
+        }
+
+        mcwdt_us = model_mcwdt_next_us();
+        rx_us = model_uart_next_us();
+    }
+
+    if (time_us > model_time_us)
+    {
+        model_time_us = time_us;
+    }
+}
+
+/*******************************************************************************
+* Interrupts
+*******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr)
+{
+    if ((config->intrSrc < 0) || (config->intrSrc >= MODEL_NUM_IRQS))
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+
+    model_isr[config->intrSrc] = userIsr;
+
+    return CY_SYSINT_SUCCESS;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    model_irq_enabled[irq] = true;
+    model_irq_run();
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    model_irq_enabled[irq] = false;
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq)
+{
+    return model_irq_pending[irq] ? 1U : 0U;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    model_irq_pending[irq] = false;
+}
+
+/*******************************************************************************
+* Function Name: NVIC_SystemReset
+********************************************************************************
+* Summary:
+* Leaves the code under test through model_exit. Aborts the test if it did
+* not expect a reset.
+*
+*******************************************************************************/
+void NVIC_SystemReset(void)
+{
+    model_system_resets++;
+    if (NULL == model_exit)
+    {
+        abort();
+    }
+    longjmp(*model_exit, MODEL_EXIT_RESET);
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    uint32_t state = model_irq_masked ? 1U : 0U;
+
+    model_irq_masked = true;
+
+    return state;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    model_irq_masked = (0U != savedIntrStatus);
+    model_irq_run();
+}
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+void Cy_GPIO_Write(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    uint32_t out = (base->out & ~(1UL << pinNum)) | ((value & 1U) << pinNum);
+    bool changed = (out != base->out);
+
+    base->out = out;
+    if (changed && (NULL != model_gpio_hook))
+    {
+        model_gpio_hook((uint32_t)(base - model_gpio), pinNum, value & 1U);
+    }
+}
+
+uint32_t Cy_GPIO_ReadOut(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    return (base->out >> pinNum) & 1U;
+}
+
+void Cy_GPIO_SetInterruptEdge(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    base->intr_cfg = (base->intr_cfg & ~(3UL << (2U * pinNum))) |
+                     ((value & 3U) << (2U * pinNum));
+}
+
+void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    base->intr_mask = (base->intr_mask & ~(1UL << pinNum)) | ((value & 1U) << pinNum);
+}
+
+void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    (void)pinNum;
+
+    if (&model_gpio[MODEL_PORT_UART_RX] == base)
+    {
+        model_irq_pending[MODEL_IRQ_UART_RX_PIN] = false;
+    }
+}
+
+/*******************************************************************************
+* SCB UART
+*******************************************************************************/
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base)
+{
+    (void)base;
+
+    return model_uart.fifo_count;
+}
+
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base)
+{
+    uint8_t byte;
+
+    (void)base;
+
+    if (0U == model_uart.fifo_count)
+    {
+        return 0xFFFFFFFFUL;
+    }
+
+    byte = model_uart.fifo[model_uart.fifo_head];
+    model_uart.fifo_head = (model_uart.fifo_head + 1U) % MODEL_UART_FIFO_SIZE;
+    model_uart.fifo_count--;
+
+    return byte;
+}
+
+void Cy_SCB_UART_ClearRxFifo(CySCB_Type *base)
+{
+    (void)base;
+
+    model_uart.fifo_head = 0U;
+    model_uart.fifo_count = 0U;
+}
+
+void Cy_SCB_SetRxInterruptMask(CySCB_Type *base, uint32_t interruptMask)
+{
+    base->rx_intr_mask = interruptMask;
+}
+
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t interruptMask)
+{
+    (void)base;
+
+    /* The FIFO level interrupt is raised again while data is left */
+    if ((0U != (interruptMask & CY_SCB_RX_INTR_NOT_EMPTY)) &&
+        (0U == model_uart.fifo_count))
+    {
+        model_irq_pending[MODEL_IRQ_UART] = false;
+    }
+}
+
+/*******************************************************************************
+* MCWDT
+*******************************************************************************/
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config)
+{
+    (void)base;
+
+    memset(&model_mcwdt, 0, sizeof(model_mcwdt));
+    model_mcwdt.ctr[CY_MCWDT_COUNTER0].match = config->c0Match;
+    model_mcwdt.ctr[CY_MCWDT_COUNTER1].match = config->c1Match;
+
+    return CY_MCWDT_SUCCESS;
+}
+
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters, uint16_t waitUs)
+{
+    (void)base;
+
+    model_time_us += waitUs;
+    for (uint32_t counter = 0U; counter < MODEL_MCWDT_COUNTERS; counter++)
+    {
+        if (0U != (counters & (1UL << counter)))
+        {
+            model_mcwdt.ctr[counter].enabled = true;
+        }
+    }
+}
+
+void Cy_MCWDT_Disable(MCWDT_STRUCT_Type *base, uint32_t counters, uint16_t waitUs)
+{
+    (void)base;
+
+    model_time_us += waitUs;
+    for (uint32_t counter = 0U; counter < MODEL_MCWDT_COUNTERS; counter++)
+    {
+        if (0U != (counters & (1UL << counter)))
+        {
+            model_mcwdt.ctr[counter].enabled = false;
+        }
+    }
+}
+
+void Cy_MCWDT_ResetCounters(MCWDT_STRUCT_Type *base, uint32_t counters,
+                            uint16_t waitUs)
+{
+    (void)base;
+
+    model_time_us += waitUs;
+    for (uint32_t counter = 0U; counter < MODEL_MCWDT_COUNTERS; counter++)
+    {
+        if (0U != (counters & (1UL << counter)))
+        {
+            model_mcwdt.ctr[counter].start_tick = model_mcwdt_now();
+        }
+    }
+}
+
+void Cy_MCWDT_SetMatch(MCWDT_STRUCT_Type *base, cy_en_mcwdtcounter_t counter,
+                       uint32_t match, uint16_t waitUs)
+{
+    (void)base;
+
+    model_time_us += waitUs;
+    if ((uint32_t)counter < MODEL_MCWDT_COUNTERS)
+    {
+        model_mcwdt.ctr[counter].match = match & 0xFFFFU;
+    }
+}
+
+void Cy_MCWDT_SetInterruptMask(MCWDT_STRUCT_Type *base, uint32_t counters)
+{
+    (void)base;
+    model_mcwdt.intr_mask = counters & (CY_MCWDT_CTR0 | CY_MCWDT_CTR1);
+}
+
+void Cy_MCWDT_ClearInterrupt(MCWDT_STRUCT_Type *base, uint32_t counters)
+{
+    (void)base;
+
+    model_mcwdt.intr &= ~counters;
+    if (0U == (model_mcwdt.intr & model_mcwdt.intr_mask))
+    {
+        model_irq_pending[MODEL_IRQ_MCWDT] = false;
+    }
+}
+
+uint32_t Cy_MCWDT_GetInterruptStatusMasked(MCWDT_STRUCT_Type const *base)
+{
+    (void)base;
+    return model_mcwdt.intr & model_mcwdt.intr_mask;
+}
+
+/*******************************************************************************
+* SysPm
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: model_cpu_wait
+********************************************************************************
+* Summary:
+* Waits for an interrupt in Sleep or DeepSleep. A pending interrupt wakes
+* the CPU at once. Otherwise the wait ends at the next MCWDT match, or at a
+* received byte that raises an interrupt. Bytes received in DeepSleep are
+* lost. The time spent is added to model_sleep_us or model_deepsleep_us.
+*
+*******************************************************************************/
+static void model_cpu_wait(bool deepsleep)
+{
+    uint64_t start_us = model_time_us;
+    uint32_t taken = model_irqs_taken;
+    uint64_t mcwdt_us;
+    uint64_t rx_us;
+
+    model_cpu_deepsleep = deepsleep;
+
+    while (!model_irq_waiting() && (taken == model_irqs_taken))
+    {
+        mcwdt_us = model_mcwdt_next_us();
+        rx_us = model_uart_next_us();
+
+        if ((UINT64_MAX == mcwdt_us) && (UINT64_MAX == rx_us))
+        {
+            fprintf(stderr, "model: %s with no wakeup source\n",
+                    deepsleep ? "DeepSleep" : "Sleep");
+            abort();
+        }
+
+        if (mcwdt_us <= rx_us)
+        {
+            model_run_until(mcwdt_us);
+            break;
+        }
+
+        model_run_until(rx_us);
+    }
+
+    model_cpu_deepsleep = false;
+
+    if (deepsleep)
+    {
+        model_deepsleep_us += model_time_us - start_us;
+    }
+    else
+    {
+        model_sleep_us += model_time_us - start_us;
+    }
+}
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    (void)waitFor;
+    model_sleeps++;
+    model_cpu_wait(false);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    (void)waitFor;
+    model_deepsleeps++;
+    model_cpu_wait(true);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource)
+{
+    model_hib_wakeup |= wakeupSource;
+}
+
+void Cy_SysPm_ClearHibernateWakeupSource(uint32_t wakeupSource)
+{
+    model_hib_wakeup &= ~wakeupSource;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_SystemEnterHibernate
+********************************************************************************
+* Summary:
+* Returns model_hib_status if it is an error. Otherwise, the device is in
+* Hibernate, and the code under test is left through model_exit.
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHibernate(void)
+{
+    if (CY_SYSPM_SUCCESS != model_hib_status)
+    {
+        return model_hib_status;
+    }
+
+    model_hibernates++;
+    if (NULL == model_exit)
+    {
+        abort();
+    }
+    longjmp(*model_exit, MODEL_EXIT_HIBERNATE);
+}
+
+/*******************************************************************************
+* Backup domain
+*******************************************************************************/
+void Cy_RTC_GetDateAndTime(cy_stc_rtc_config_t *dateTime)
+{
+    static const uint8_t days_in_month[12] =
+    {
+        31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U
+    };
+    uint32_t now_s = model_rtc_base_s + (uint32_t)(model_time_us / 1000000U);
+    uint32_t days = now_s / 86400U;
+    uint32_t year = 0U;
+    uint32_t month = 0U;
+
+    memset(dateTime, 0, sizeof(*dateTime));
+    dateTime->sec = now_s % 60U;
+    dateTime->min = (now_s / 60U) % 60U;
+    dateTime->hour = (now_s / 3600U) % 24U;
+
+    /* Years 2000 to 2099, every fourth one a leap year */
+    while (days >= ((0U == (year % 4U)) ? 366U : 365U))
+    {
+        days -= (0U == (year % 4U)) ? 366U : 365U;
+        year++;
+    }
+    for (;;)
+    {
+        uint32_t length = days_in_month[month] +
+                          (((1U == month) && (0U == (year % 4U))) ? 1U : 0U);
+
+        if (days < length)
+        {
+            break;
+        }
+        days -= length;
+        month++;
+    }
+
+    dateTime->date = days + 1U;
+    dateTime->month = month + 1U;
+    dateTime->year = year;
+}
+
+cy_en_rtc_status_t Cy_RTC_SetAlarmDateAndTime(cy_stc_rtc_alarm_t const *alarmDateTime,
+                                              cy_en_rtc_alarm_t alarmIndex)
+{
+    /* Every field must be valid, even if it is not matched */
+    if ((alarmDateTime->sec > 59U) || (alarmDateTime->min > 59U) ||
+        (alarmDateTime->hour > 23U) || (alarmDateTime->dayOfWeek < 1U) ||
+        (alarmDateTime->dayOfWeek > 7U) || (alarmDateTime->date < 1U) ||
+        (alarmDateTime->date > 31U) || (alarmDateTime->month < 1U) ||
+        (alarmDateTime->month > 12U) || ((uint32_t)alarmIndex > 1U))
+    {
+        return CY_RTC_BAD_PARAM;
+    }
+
+    model_rtc_alarm[alarmIndex] = *alarmDateTime;
+
+    return CY_RTC_SUCCESS;
+}
+
+void Cy_RTC_SetInterruptMask(uint32_t interruptMask)
+{
+    model_rtc_intr_mask = interruptMask;
+}
+
+uint32_t Cy_RTC_GetInterruptMask(void)
+{
+    return model_rtc_intr_mask;
+}
+
+void Cy_RTC_ClearInterrupt(uint32_t interruptMask)
+{
+    model_rtc_intr &= ~interruptMask;
+}
+
+void Cy_SysPm_BackupWordStore(uint32_t wordIndex, uint32_t *wordSrcPointer,
+                              size_t wordSize)
+{
+    memcpy(&model_backup[wordIndex], wordSrcPointer, wordSize * sizeof(uint32_t));
+}
+
+void Cy_SysPm_BackupWordReStore(uint32_t wordIndex, uint32_t *wordDstPointer,
+                                size_t wordSize)
+{
+    memcpy(wordDstPointer, &model_backup[wordIndex], wordSize * sizeof(uint32_t));
+}
+
+/*******************************************************************************
+* LPComp
+*******************************************************************************/
+uint32_t Cy_LPComp_GetCompare(LPCOMP_Type const *base,
+                              cy_en_lpcomp_channel_t channel)
+{
+    (void)base;
+    (void)channel;
+
+    return (NULL != model_lpcomp) ? model_lpcomp(model_time_us) : 0U;
+}
+
+void Cy_LPComp_SetPower(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                        cy_en_lpcomp_pwr_t power,
+                        cy_stc_lpcomp_context_t *context)
+{
+    (void)base;
+    (void)channel;
+    (void)context;
+    model_lpcomp_power = (uint32_t)power;
+}
+
+void Cy_LPComp_SetHysteresis(LPCOMP_Type *base, cy_en_lpcomp_channel_t channel,
+                             cy_en_lpcomp_hyst_t hysteresis)
+{
+    (void)base;
+    (void)channel;
+    model_lpcomp_hyst = (uint32_t)hysteresis;
+}
+
+/*******************************************************************************
+* SysLib
+*******************************************************************************/
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    model_time_us += microseconds;
+}
+
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    return model_reset_reason;
+}
+
+/*******************************************************************************
+* RRAM
+*******************************************************************************/
+cy_en_rram_status_t Cy_RRAM_NvmWriteByteArray(RRAMC_Type *base, uintptr_t addr,
+                                              const uint8_t *data, uint32_t size)
+{
+    (void)base;
+
+    if ((addr < MODEL_RRAM_ADDR) ||
+        ((addr + size) > (MODEL_RRAM_ADDR + MODEL_RRAM_SIZE)))
+    {
+        return CY_RRAM_BAD_PARAM;
+    }
+
+    memcpy((void *)addr, data, size);
+
+    return CY_RRAM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: model_dcache_write_back / model_dcache_complete
+********************************************************************************
+* Summary:
+* Copies a data cache line to memory, and completes the oldest pending clean
+* operation.
+*
+*******************************************************************************/
+static void model_dcache_write_back(uint32_t line)
+{
+    memcpy(&model_shared[line * MODEL_DCACHE_LINE],
+           &model_dcache[line * MODEL_DCACHE_LINE], MODEL_DCACHE_LINE);
+
+    if (NULL != model_dcache_hook)
+    {
+        model_dcache_hook(line);
+    }
+}
+
+static void model_dcache_complete(void)
+{
+    uint32_t line = model_dcache_pending.line[0];
+
+    model_dcache_pending.count--;
+    memmove(&model_dcache_pending.line[0], &model_dcache_pending.line[1],
+            model_dcache_pending.count * sizeof(model_dcache_pending.line[0]));
+    model_dcache_write_back(line);
+}
+
+/*******************************************************************************
+* Function Name: model_dcache_run
+********************************************************************************
+* Summary:
+* Does what the cache may have done since the last cache or barrier
+* operation: with model_dcache_evict set, evicts random dirty lines and
+* completes pending clean operations, in random order.
+*
+*******************************************************************************/
+static void model_dcache_run(void)
+{
+    uint32_t dirty[MODEL_DCACHE_LINES];
+    uint32_t num_dirty;
+    uint32_t steps;
+
+    if (!model_dcache_evict)
+    {
+        return;
+    }
+
+    steps = model_rand() % 4U;
+    for (uint32_t step = 0U; step < steps; step++)
+    {
+        if ((0U != model_dcache_pending.count) && (0U != (model_rand() & 1U)))
+        {
+            model_dcache_complete();
+            continue;
+        }
+
+        num_dirty = 0U;
+        for (uint32_t line = 0U; line < MODEL_DCACHE_LINES; line++)
+        {
+            if (0 != memcmp(&model_shared[line * MODEL_DCACHE_LINE],
+                            &model_dcache[line * MODEL_DCACHE_LINE], MODEL_DCACHE_LINE))
+            {
+                dirty[num_dirty++] = line;
+            }
+        }
+        if (0U != num_dirty)
+        {
+            model_dcache_write_back(dirty[model_rand() % num_dirty]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: SCB_CleanDCache_by_Addr / SCB_InvalidateDCache_by_Addr
+********************************************************************************
+* Summary:
+* A clean queues the write-back of the lines of the range, in ascending
+* order. The write-backs are complete only after a DSB. An invalidate
+* reloads the lines from memory. Addresses outside model_dcache are not
+* cached.
+*
+*******************************************************************************/
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t dsize)
+{
+    uintptr_t offset = (uintptr_t)addr - MODEL_DCACHE_ADDR;
+
+    if (((uintptr_t)addr < MODEL_DCACHE_ADDR) || (offset >= MODEL_SHARED_SIZE))
+    {
+        return;
+    }
+
+    model_dcache_run();
+
+    for (uint32_t line = (uint32_t)(offset / MODEL_DCACHE_LINE);
+         (line < MODEL_DCACHE_LINES) && ((line * MODEL_DCACHE_LINE) < (offset + (uint32_t)dsize));
+         line++)
+    {
+        if (MODEL_DCACHE_LINES == model_dcache_pending.count)
+        {
+            model_dcache_complete();
+        }
+        model_dcache_pending.line[model_dcache_pending.count++] = line;
+    }
+}
+
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t dsize)
+{
+    uintptr_t offset = (uintptr_t)addr - MODEL_DCACHE_ADDR;
+
+    if (((uintptr_t)addr < MODEL_DCACHE_ADDR) || (offset >= MODEL_SHARED_SIZE))
+    {
+        return;
+    }
+
+    for (uint32_t line = (uint32_t)(offset / MODEL_DCACHE_LINE);
+         (line < MODEL_DCACHE_LINES) && ((line * MODEL_DCACHE_LINE) < (offset + (uint32_t)dsize));
+         line++)
+    {
+        memcpy(&model_dcache[line * MODEL_DCACHE_LINE],
+               &model_shared[line * MODEL_DCACHE_LINE], MODEL_DCACHE_LINE);
+    }
+}
+
+/*******************************************************************************
+* Function Name: model_dsb
+********************************************************************************
+* Summary:
+* Data synchronization barrier: completes the pending clean operations.
+*
+*******************************************************************************/
+void model_dsb(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    model_dcache_run();
+    while (0U != model_dcache_pending.count)
+    {
+        model_dcache_complete();
+    }
+}
+
+/*******************************************************************************
+* CMSE
+*******************************************************************************/
+void *cmse_check_address_range(void *p, size_t size, int flags)
+{
+    uintptr_t addr = (uintptr_t)p;
+
+    model_cmse_checks++;
+
+    if ((0 == (flags & CMSE_NONSECURE)) ||
+        (addr < (uintptr_t)model_ns_ram) ||
+        (size > MODEL_NS_RAM_SIZE) ||
+        ((addr - (uintptr_t)model_ns_ram) > (MODEL_NS_RAM_SIZE - size)))
+    {
+        return NULL;
+    }
+
+    return p;
+}
+
+/*******************************************************************************
+* Retarget IO
+*******************************************************************************/
+bool cy_retarget_io_is_tx_active(void)
+{
+    /* The UART is flushed after a marker for the tester */
+    fflush(stdout);
+    model_mark_us = model_time_us;
+
+    return false;
+}
+
+/* [] END OF FILE */
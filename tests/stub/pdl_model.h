@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * File Name:   pdl_model.h
+ *
+ * Description: This file is the interface of the hardware model behind the
+ *              host stand-in PDL. Tests set the model inputs, such as the
+ *              comparator output, and read back its state, such as the
+ *              simulated time and the RRAM contents.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _PDL_MODEL_H_
+#define _PDL_MODEL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Simulated RRAM region for the modules that store data in RRAM */
+#define MODEL_RRAM_SIZE                 (4096U)
+#define MODEL_RRAM_ADDR                 ((uintptr_t)model_rram)
+
+/* Simulated CM33/CM55 shared SOCMEM region */
+#define MODEL_SHARED_SIZE               (1024U)
+#define MODEL_SHARED_ADDR               ((uintptr_t)model_shared)
+
+/* Data cache of the CM55 over the shared region. Code built with
+ * __DCACHE_PRESENT writes through MODEL_DCACHE_ADDR; the lines reach
+ * model_shared, the memory seen by the other core, when they are written
+ * back. */
+#define MODEL_DCACHE_LINE               (32U)
+#define MODEL_DCACHE_LINES              (MODEL_SHARED_SIZE / MODEL_DCACHE_LINE)
+#define MODEL_DCACHE_ADDR               ((uintptr_t)model_dcache)
+
+/* Simulated non-secure RAM, the only memory the secure side may access for
+ * the non-secure caller */
+#define MODEL_NS_RAM_SIZE               (1024U)
+
+/* Interrupt lines of the model */
+#define MODEL_IRQ_MCWDT                 (0)
+#define MODEL_IRQ_UART                  (1)
+#define MODEL_IRQ_UART_RX_PIN           (2)
+#define MODEL_NUM_IRQS                  (8)
+
+/* GPIO ports of the model */
+#define MODEL_PORT_LED_RED              (0U)
+#define MODEL_PORT_LED_GREEN            (1U)
+#define MODEL_PORT_UART_RX              (2U)
+#define MODEL_NUM_PORTS                 (3U)
+
+/* UART receive FIFO, and the bytes that can be queued with model_uart_rx() */
+#define MODEL_UART_FIFO_SIZE            (64U)
+#define MODEL_UART_MAX_RX               (512U)
+
+/* Time of one byte at 115200 bit/s, 10 bits per byte */
+#define MODEL_UART_BYTE_US              (87U)
+
+/* MCWDT clock, the LFCLK */
+#define MODEL_LFCLK_HZ                  (32768U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Comparator output as a function of the simulated time */
+typedef uint32_t (*model_lpcomp_fn_t)(uint64_t time_us);
+
+/* How the CPU left the code under test through model_exit */
+#define MODEL_EXIT_HIBERNATE            (1)
+#define MODEL_EXIT_RESET                (2)
+
+/* Called on every change of a GPIO output */
+typedef void (*model_gpio_fn_t)(uint32_t port, uint32_t pin, uint32_t value);
+
+/* Called after every write-back of a data cache line to memory */
+typedef void (*model_dcache_fn_t)(uint32_t line);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uint64_t model_time_us;          /* Advanced by the delay functions */
+extern uint64_t model_mark_us;          /* Time of the last UART flush */
+extern model_lpcomp_fn_t model_lpcomp;  /* Comparator output, 0 if NULL */
+extern uint32_t model_lpcomp_power;     /* Last cy_en_lpcomp_pwr_t set */
+extern uint32_t model_lpcomp_hyst;      /* Last cy_en_lpcomp_hyst_t set */
+extern uint8_t model_rram[MODEL_RRAM_SIZE];
+extern uint8_t model_shared[MODEL_SHARED_SIZE];
+extern uint8_t model_dcache[MODEL_SHARED_SIZE];
+extern model_dcache_fn_t model_dcache_hook;
+extern bool model_dcache_evict;         /* Write back dirty lines at random */
+extern uint8_t model_ns_ram[MODEL_NS_RAM_SIZE];
+extern uint32_t model_cmse_checks;      /* Calls of cmse_check_address_range() */
+extern GPIO_PRT_Type model_gpio[MODEL_NUM_PORTS];
+extern model_gpio_fn_t model_gpio_hook;  /* GPIO change trace, none if NULL */
+extern MCWDT_STRUCT_Type model_mcwdt0;
+extern uint32_t model_deepsleeps;       /* Calls of Cy_SysPm_CpuEnterDeepSleep() */
+extern uint32_t model_sleeps;           /* Calls of Cy_SysPm_CpuEnterSleep() */
+extern uint64_t model_deepsleep_us;     /* Time spent in DeepSleep */
+extern uint64_t model_sleep_us;         /* Time spent in Sleep */
+extern CySCB_Type model_scb;
+extern uint32_t model_uart_lost;        /* Bytes not received: DeepSleep, FIFO full */
+extern uint32_t model_backup[CY_SRSS_BACKUP_NUM_BREG];
+extern uint32_t model_rtc_base_s;       /* RTC seconds since 2000 at time 0 */
+extern cy_stc_rtc_alarm_t model_rtc_alarm[2];
+extern uint32_t model_rtc_intr_mask;
+extern uint32_t model_rtc_intr;         /* Pending RTC interrupts */
+extern uint32_t model_hib_wakeup;       /* Hibernate wakeup sources */
+extern cy_en_syspm_status_t model_hib_status;  /* Result of a Hibernate entry */
+extern uint32_t model_hibernates;       /* Hibernate entries */
+extern uint32_t model_system_resets;    /* Calls of NVIC_SystemReset() */
+extern uint32_t model_reset_reason;     /* Cy_SysLib_GetResetReason() */
+extern jmp_buf *model_exit;             /* Left by a reset or Hibernate entry */
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void model_reset(void);
+void model_seed(uint64_t seed);
+uint32_t model_rand(void);
+double model_uniform(void);
+double model_gauss(void);
+void model_irq_set_pending(IRQn_Type irq);
+void model_run_until(uint64_t time_us);
+void model_uart_rx(uint64_t time_us, const char *text);
+uint32_t model_uart_queued(void);
+void model_dsb(void);
+
+#endif /* _PDL_MODEL_H_ */
+
+/* [] END OF FILE */
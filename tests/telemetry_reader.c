@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * File Name:   telemetry_reader.c
+ *
+ * Description: This file contains the host reader of the shared telemetry
+ *              block. It follows the seqlock protocol of telemetry_read():
+ *              read the sequence counter, copy the section, and read the
+ *              counter again. The copy is consistent if both values are
+ *              equal and even.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "telemetry_reader.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TELEMETRY_READER_SEQ_OFFSET(core) \
+            ((uint32_t)(offsetof(telemetry_block_t, core) + \
+             ((uint32_t)(core) * sizeof(telemetry_section_t))))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const telemetry_reader_wake_names[] =
+{
+    "power_on",
+    "hibernate",
+    "deepsleep",
+    "timer",
+    "sleep"
+};
+
+static const char * const telemetry_reader_status_names[] =
+{
+    "ok",
+    "io",
+    "no_block",
+    "version",
+    "busy"
+};
+
+/*******************************************************************************
+* Function Name: telemetry_reader_snapshot
+********************************************************************************
+* Summary:
+* Checks the block header and takes a consistent snapshot of a section. The
+* read function is called at least three times per attempt, so each call
+* must fetch the target memory again rather than return cached data.
+*
+* Parameters:
+*  reader: Access to the block
+*  core: Section to read
+*  snapshot: Destination of the snapshot
+*
+* Return:
+*  telemetry_reader_status_t: TELEMETRY_READER_OK if the snapshot is valid
+*
+*******************************************************************************/
+telemetry_reader_status_t telemetry_reader_snapshot(
+                                const telemetry_reader_t *reader,
+                                telemetry_core_t core,
+                                telemetry_section_t *snapshot)
+{
+    uint32_t offset = TELEMETRY_READER_SEQ_OFFSET(core);
+    uint32_t header[2];
+    uint32_t seq;
+    uint32_t seq_after;
+
+    if (!reader->read(reader->context, 0U, header, sizeof(header)))
+    {
+        return TELEMETRY_READER_IO;
+    }
+    if (TELEMETRY_MAGIC != header[0])
+    {
+        return TELEMETRY_READER_NO_BLOCK;
+    }
+    if (((uint32_t)TELEMETRY_VERSION | ((uint32_t)sizeof(telemetry_block_t) << 16U))
+        != header[1])
+    {
+        return TELEMETRY_READER_VERSION;
+    }
+
+    for (uint32_t attempt = 0U; attempt < reader->retries; attempt++)
+    {
+        if (!reader->read(reader->context, offset, &seq, sizeof(seq)))
+        {
+            return TELEMETRY_READER_IO;
+        }
+        if (0U != (seq & 1U))
+        {
+            continue;
+        }
+
+        if (!reader->read(reader->context, offset, snapshot, sizeof(*snapshot)) ||
+            !reader->read(reader->context, offset, &seq_after, sizeof(seq_after)))
+        {
+            return TELEMETRY_READER_IO;
+        }
+        if (seq == seq_after)
+        {
+            snapshot->seq = seq;
+            return TELEMETRY_READER_OK;
+        }
+    }
+
+    return TELEMETRY_READER_BUSY;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_reader_memory
+********************************************************************************
+* Summary:
+* Read function for a block in host memory, for example a mapping of the
+* target memory. The fences order the reads of one snapshot.
+*
+* Parameters:
+*  context: Start of the block
+*  offset: Offset in the block
+*  data: Destination
+*  size: Number of bytes
+*
+* Return:
+*  bool: true
+*
+*******************************************************************************/
+bool telemetry_reader_memory(void *context, uint32_t offset, void *data,
+                             uint32_t size)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    memcpy(data, (const uint8_t *)context + offset, size);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: telemetry_reader_file
+********************************************************************************
+* Summary:
+* Read function for a memory dump of the m33_m55_shared region, such as
+* written by the dump_image command of OpenOCD.
+*
+* Parameters:
+*  context: FILE of the dump
+*  offset: Offset in the block
+*  data: Destination
+*  size: Number of bytes
+*
+* Return:
+*  bool: false if the dump is too short
+*
+*******************************************************************************/
+bool telemetry_reader_file(void *context, uint32_t offset, void *data,
+                           uint32_t size)
+{
+    FILE *file = (FILE *)context;
+
+    return (0 == fseek(file, (long)offset, SEEK_SET)) &&
+           (1U == fread(data, size, 1U, file));
+}
+
+/*******************************************************************************
+* Function Name: telemetry_reader_status_name
+********************************************************************************
+* Summary:
+* Returns the name of a snapshot result.
+*
+* Parameters:
+*  status: Snapshot result
+*
+* Return:
+*  const char*: Name
+*
+*******************************************************************************/
+const char *telemetry_reader_status_name(telemetry_reader_status_t status)
+{
+    return ((uint32_t)status < (sizeof(telemetry_reader_status_names) /
+                                sizeof(telemetry_reader_status_names[0]))) ?
+           telemetry_reader_status_names[status] : "unknown";
+}
+
+/*******************************************************************************
+* Function Name: telemetry_reader_print
+********************************************************************************
+* Summary:
+* Prints a snapshot as one "name value" line per field.
+*
+* Parameters:
+*  out: Output stream
+*  core: Section the snapshot was taken from
+*  snapshot: Snapshot
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void telemetry_reader_print(FILE *out, telemetry_core_t core,
+                            const telemetry_section_t *snapshot)
+{
+    const char *wake = (snapshot->last_wake < (sizeof(telemetry_reader_wake_names) /
+                                               sizeof(telemetry_reader_wake_names[0]))) ?
+                       telemetry_reader_wake_names[snapshot->last_wake] : "unknown";
+
+    fprintf(out, "core %s\n", (TELEMETRY_CORE_CM33 == core) ? "cm33" : "cm55");
+    fprintf(out, "seq %u\n", (unsigned int)snapshot->seq);
+    fprintf(out, "boot_time_us %u\n", (unsigned int)snapshot->boot_time_us);
+    fprintf(out, "last_wake %s\n", wake);
+    fprintf(out, "deepsleep_wakes %u\n", (unsigned int)snapshot->deepsleep_wakes);
+    fprintf(out, "sleep_entries %u\n", (unsigned int)snapshot->sleep_entries);
+    fprintf(out, "storms %u\n", (unsigned int)snapshot->storms);
+    fprintf(out, "absorbed %u\n", (unsigned int)snapshot->absorbed);
+    fprintf(out, "idle_hint_ms %u\n", (unsigned int)snapshot->idle_hint_ms);
+    fprintf(out, "idle_state %u\n", (unsigned int)snapshot->idle_state);
+    fprintf(out, "off_request %u\n", (unsigned int)snapshot->off_request);
+    fprintf(out, "active_hist");
+    for (uint32_t i = 0U; i < TELEMETRY_HIST_BINS; i++)
+    {
+        fprintf(out, " %u", (unsigned int)snapshot->active_hist[i]);
+    }
+    fprintf(out, "\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * File Name:   telemetry_reader.h
+ *
+ * Description: This file contains the interface of the host reader of the
+ *              shared telemetry block (see telemetry.h). The reader takes
+ *              consistent snapshots through a caller-supplied memory access
+ *              function, such as an SWD memory read or a mapping of the
+ *              block in host memory, without stopping the target.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TELEMETRY_READER_H_
+#define _TELEMETRY_READER_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "telemetry.h"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Reads size bytes at offset from the start of the telemetry block. Returns
+ * false if the target memory could not be read. */
+typedef bool (*telemetry_reader_read_t)(void *context, uint32_t offset,
+                                        void *data, uint32_t size);
+
+/* Access to one telemetry block */
+typedef struct
+{
+    telemetry_reader_read_t read;
+    void *context;
+    uint32_t retries;               /* Attempts per snapshot */
+} telemetry_reader_t;
+
+/* Result of a snapshot */
+typedef enum
+{
+    TELEMETRY_READER_OK         = 0,
+    TELEMETRY_READER_IO         = 1,    /* The read function failed */
+    TELEMETRY_READER_NO_BLOCK   = 2,    /* No telemetry block at the address */
+    TELEMETRY_READER_VERSION    = 3,    /* Unsupported block layout */
+    TELEMETRY_READER_BUSY       = 4     /* Writer active on every attempt */
+} telemetry_reader_status_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+telemetry_reader_status_t telemetry_reader_snapshot(
+                                const telemetry_reader_t *reader,
+                                telemetry_core_t core,
+                                telemetry_section_t *snapshot);
+bool telemetry_reader_memory(void *context, uint32_t offset, void *data,
+                             uint32_t size);
+bool telemetry_reader_file(void *context, uint32_t offset, void *data,
+                           uint32_t size);
+const char *telemetry_reader_status_name(telemetry_reader_status_t status);
+void telemetry_reader_print(FILE *out, telemetry_core_t core,
+                            const telemetry_section_t *snapshot);
+
+#endif /* _TELEMETRY_READER_H_ */
+
+/* [] END OF FILE */
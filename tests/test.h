@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * File Name:   test.h
+ *
+ * Description: This file contains the checks and the result reporting shared
+ *              by the host tests.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Records a failure and continues */
+#define TEST_CHECK(cond) \
+    do \
+    { \
+        test_checks++; \
+        if (!(cond)) \
+        { \
+            test_failures++; \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+/* Records a failure when a value is outside [lo, hi] and prints the value */
+#define TEST_CHECK_RANGE(val, lo, hi) \
+    do \
+    { \
+        double test_val = (double)(val); \
+        test_checks++; \
+        if ((test_val < (double)(lo)) || (test_val > (double)(hi))) \
+        { \
+            test_failures++; \
+            printf("%s:%d: check failed: %s = %g not in [%g, %g]\n", __FILE__, \
+                   __LINE__, #val, test_val, (double)(lo), (double)(hi)); \
+        } \
+    } while (0)
+
+/* Prints the summary. Used as the return value of main(). */
+#define TEST_RESULT() \
+    (printf("%u checks, %u failures\n", test_checks, test_failures), \
+     (0U == test_failures) ? 0 : 1)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static unsigned int test_checks;
+static unsigned int test_failures;
+
+#endif /* _TEST_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+################################################################################
+# \file test_board_config.py
+# \version 1.0
+#
+# \brief
+# Host test of scripts/board_config.py. Checks that the generated files in
+# templates match the overlays, that every generated constant is used by the
+# application and compiles without other headers, and that --install writes
+# board_config.h into a BSP from the design.modus of the BSP.
+#
+################################################################################
+# \copyright
+# (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import contextlib
+import glob
+import io
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(TESTS_DIR, "..", "scripts"))
+import board_config  # noqa: E402
+
+DEFINE_RE = re.compile(r"^#define (BOARD_\w+)", re.MULTILINE)
+
+
+def app_sources():
+    text = ""
+    for pattern in ("proj_*/*.c", "proj_*/*.h", "shared/source/*.c", "shared/include/*.h"):
+        for path in glob.glob(os.path.join(board_config.ROOT_DIR, pattern)):
+            text += board_config.read_file(path)
+    return text
+
+
+class GenerateTest(unittest.TestCase):
+
+    def test_templates_match(self):
+        overlays = board_config.load_overlays()
+        designs = {}
+        for target in overlays:
+            for path, content in board_config.generate(target, overlays, designs).items():
+                self.assertEqual(board_config.read_file(path), content, path)
+
+    def test_constants_used(self):
+        sources = app_sources()
+        overlays = board_config.load_overlays()
+        for target in overlays:
+            header = board_config.read_file(os.path.join(board_config.target_dir(target), "board_config.h"))
+            names = DEFINE_RE.findall(header)
+            self.assertIn("BOARD_LPCOMP_POWER_MODE", names)
+            for name in names:
+                self.assertTrue(name in sources, "%s: %s is not used" % (target, name))
+
+    def test_header_self_contained(self):
+        # The numeric constants must compile without the application headers,
+        # and the idle hint must match TELEMETRY_IDLE_UNBOUNDED
+        for target in board_config.load_overlays():
+            with tempfile.TemporaryDirectory() as tmp:
+                source = os.path.join(tmp, "check.c")
+                with open(source, "w", encoding="utf-8") as f:
+                    f.write('#include "board_config.h"\n'
+                            '_Static_assert(BOARD_LPCOMP_SETTLE_TIME_US > 0U, "settle");\n'
+                            'static const unsigned long hint = BOARD_CM55_IDLE_HINT_MS;\n'
+                            '#include "telemetry.h"\n'
+                            '_Static_assert(BOARD_CM55_IDLE_HINT_MS == TELEMETRY_IDLE_UNBOUNDED, "hint");\n'
+                            'unsigned long get_hint(void) { return hint; }\n')
+                result = subprocess.run(
+                    [os.environ.get("CC", "cc"), "-std=gnu11", "-Wall", "-Werror", "-c",
+                     "-I" + board_config.target_dir(target),
+                     "-I" + os.path.join(TESTS_DIR, "stub"),
+                     "-I" + os.path.join(board_config.ROOT_DIR, "shared", "include"),
+                     source, "-o", os.path.join(tmp, "check.o")],
+                    capture_output=True, text=True)
+                self.assertEqual(result.returncode, 0, result.stderr)
+
+    def test_regions_disjoint(self):
+        # Regions carved for the application must not overlap the regions
+        # of the BSP on any board
+        for target in board_config.load_overlays():
+            design = board_config.read_file(os.path.join(board_config.target_dir(target), "design.modus"))
+            regions = sorted((params["memoryId"], int(params["offset"], 16), int(params["size"], 16),
+                              params["regionId"])
+                             for params in board_config.memory_regions(design).values())
+            for first, second in zip(regions, regions[1:]):
+                if first[0] == second[0]:
+                    self.assertLessEqual(first[1] + first[2], second[1],
+                                         "%s: %s overlaps %s" % (target, first[3], second[3]))
+
+    def test_missing_block(self):
+        with self.assertRaises(board_config.ConfigError):
+            board_config.lpcomp_constants("<Personality template=\"x\">\n</Personality>\n")
+
+
+class CacheTest(unittest.TestCase):
+
+    TARGET = "KIT_PSE84_EVAL_EPC4"
+
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        shutil.copytree(os.path.join(board_config.ROOT_DIR, "templates"), os.path.join(self.tmp.name, "templates"),
+                        ignore=shutil.ignore_patterns(".cache.json"))
+        for name in ("ROOT_DIR", "OVERLAY_DIR", "CACHE_FILE"):
+            self.addCleanup(setattr, board_config, name, getattr(board_config, name))
+        board_config.ROOT_DIR = self.tmp.name
+        board_config.OVERLAY_DIR = os.path.join(self.tmp.name, "templates", "boards")
+        board_config.CACHE_FILE = os.path.join(board_config.OVERLAY_DIR, ".cache.json")
+        self.header = os.path.join(board_config.target_dir(self.TARGET), "board_config.h")
+        self.expected = board_config.read_file(self.header)
+
+    def run_main(self):
+        argv = sys.argv
+        self.addCleanup(setattr, sys, "argv", argv)
+        sys.argv = ["board_config.py", self.TARGET]
+        out = io.StringIO()
+        with contextlib.redirect_stdout(out):
+            status = board_config.main()
+        self.assertEqual(status, 0)
+        return out.getvalue()
+
+    def test_up_to_date(self):
+        self.run_main()
+        self.assertIn("up to date", self.run_main())
+
+    def test_edited_output(self):
+        self.run_main()
+        with open(self.header, "a", encoding="utf-8") as f:
+            f.write("#define BOARD_EDITED 1\n")
+        out = self.run_main()
+        self.assertNotIn("up to date", out)
+        self.assertIn("wrote", out)
+        self.assertEqual(board_config.read_file(self.header), self.expected)
+
+    def test_deleted_output(self):
+        self.run_main()
+        os.remove(self.header)
+        self.assertIn("wrote", self.run_main())
+        self.assertEqual(board_config.read_file(self.header), self.expected)
+
+    def test_old_cache_format(self):
+        # An entry that records only the input hash regenerates the target
+        with open(board_config.CACHE_FILE, "w", encoding="utf-8") as f:
+            json.dump({self.TARGET: "0" * 64}, f)
+        self.assertNotIn("up to date", self.run_main())
+        self.assertIn("up to date", self.run_main())
+
+
+class InstallTest(unittest.TestCase):
+
+    TARGET = "KIT_PSE84_EVAL_EPC2"
+
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        self.bsp_dir = board_config.BSP_DIR
+        self.addCleanup(setattr, board_config, "BSP_DIR", self.bsp_dir)
+        board_config.BSP_DIR = self.tmp.name
+
+        self.config_dir = os.path.join(self.tmp.name, "TARGET_APP_" + self.TARGET, "config")
+        os.makedirs(self.config_dir)
+        shutil.copy(os.path.join(board_config.target_dir(self.TARGET), "design.modus"), self.config_dir)
+        self.header = os.path.join(self.config_dir, "board_config.h")
+
+    def run_main(self, target):
+        out = io.StringIO()
+        with contextlib.redirect_stdout(out):
+            status = board_config.install_main(target)
+        return status, out.getvalue()
+
+    def test_install(self):
+        status, out = self.run_main("APP_" + self.TARGET)
+        self.assertEqual(status, 0)
+        self.assertIn("wrote", out)
+        self.assertEqual(board_config.read_file(self.header),
+                         board_config.read_file(os.path.join(board_config.target_dir(self.TARGET),
+                                                             "board_config.h")))
+
+        # Unchanged inputs leave the file alone, so the build does not recompile
+        mtime = os.stat(self.header).st_mtime_ns
+        status, out = self.run_main(self.TARGET)
+        self.assertEqual((status, out), (0, ""))
+        self.assertEqual(os.stat(self.header).st_mtime_ns, mtime)
+
+    def test_follows_bsp_design(self):
+        design = os.path.join(self.config_dir, "design.modus")
+        text = board_config.read_file(design).replace(
+            '<Param id="PowerSpeed" value="CY_LPCOMP_MODE_ULP"/>',
+            '<Param id="PowerSpeed" value="CY_LPCOMP_MODE_LP"/>')
+        with open(design, "w", encoding="utf-8", newline="") as f:
+            f.write(text)
+
+        self.assertTrue(board_config.install(board_config.load_overlays()[self.TARGET], self.config_dir))
+        self.assertIn("(CY_LPCOMP_MODE_LP)", board_config.read_file(self.header))
+
+    def test_no_bsp(self):
+        status, out = self.run_main("KIT_PSE84_EVAL_EPC4")
+        self.assertEqual(status, 0)
+        self.assertIn("nothing to install", out)
+
+    def test_unknown_target(self):
+        with self.assertRaises(board_config.ConfigError):
+            board_config.install_main("KIT_UNKNOWN")
+
+
+class NscTest(unittest.TestCase):
+
+    def design(self, target="KIT_PSE84_EVAL_EPC2"):
+        return board_config.read_file(os.path.join(board_config.target_dir(target), "design.modus"))
+
+    def test_region(self):
+        # The veneers go to the secure alias of m33s_nsc, after m33s_nvm and
+        # inside the slot signed with the secure image
+        for target in board_config.load_overlays():
+            address, size = board_config.nsc_region(self.design(target))
+            self.assertEqual(address, board_config.RRAM_S_BASE + 0x20000, target)
+            self.assertEqual(size, 0x1000, target)
+
+    def test_main(self):
+        out = io.StringIO()
+        with contextlib.redirect_stdout(out):
+            status = board_config.nsc_main("APP_KIT_PSE84_EVAL_EPC4")
+        self.assertEqual((status, out.getvalue()), (0, "0x32020000\n"))
+
+    def test_not_nsc(self):
+        # A region left in the secure domain would not be marked NSC
+        text = self.design().replace(
+            '<Param id="domain" value="GI9riTKd7DI"/>\n'
+            '                        <Param id="memoryId" value="RRAM"/>\n'
+            '                        <Param id="offset" value="0x00020000"/>',
+            '<Param id="domain" value="7cPl230VJyc"/>\n'
+            '                        <Param id="memoryId" value="RRAM"/>\n'
+            '                        <Param id="offset" value="0x00020000"/>')
+        with self.assertRaisesRegex(board_config.ConfigError, "M33NSC"):
+            board_config.nsc_region(text)
+
+    def test_missing(self):
+        text = self.design().replace('value="m33s_nsc"', 'value="m33s_other"')
+        with self.assertRaisesRegex(board_config.ConfigError, "no memory region"):
+            board_config.nsc_region(text)
+
+
+class SlotTest(unittest.TestCase):
+
+    def design(self, target="KIT_PSE84_EVAL_EPC2"):
+        return board_config.read_file(os.path.join(board_config.target_dir(target), "design.modus"))
+
+    def test_slots(self):
+        # The secure image is signed from the start of m33s_nvm, and its slot
+        # ends before the calibration table on every board
+        slots = board_config.signed_slots()
+        self.assertEqual([slot[1] for slot in slots], ["m33s_nvm"])
+        for target in board_config.load_overlays():
+            board_config.check_slots(self.design(target), slots)
+            regions = {params["regionId"]: params
+                       for params in board_config.memory_regions(self.design(target)).values()}
+            self.assertEqual(int(regions["m33s_nvm"]["offset"], 16) + slots[0][2],
+                             int(regions["m33_calib"]["offset"], 16), target)
+
+    def test_region_in_slot(self):
+        slots = [("sign.json", "m33s_nvm", 0x59000)]
+        with self.assertRaisesRegex(board_config.ConfigError, "m33_calib lies in the signed slot"):
+            board_config.check_slots(self.design(), slots)
+
+    def test_unknown_region(self):
+        with self.assertRaisesRegex(board_config.ConfigError, "no memory region m33s_other"):
+            board_config.check_slots(self.design(), [("sign.json", "m33s_other", 0x1000)])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,535 @@
+/*******************************************************************************
+ * File Name:   test_cmd_parser.c
+ *
+ * Description: This file contains the host test of cmd_parser.c. The line
+ *              assembly, the parser and the parameter codec are checked on
+ *              fixed cases, and then fuzzed with random byte streams and
+ *              with mutations of valid commands. Every line the fuzzer
+ *              completes must be bounded and printable, every result must
+ *              be a valid status, and every applied command must leave
+ *              parameters that survive the backup register codec. Built
+ *              with TEST_CMD_PARSER_BENCH, the fuzzer runs longer and the
+ *              test reports the parser throughput.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "cmd_parser.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(TEST_CMD_PARSER_BENCH)
+#define TEST_FUZZ_STREAMS               (200000U)
+#else
+#define TEST_FUZZ_STREAMS               (20000U)
+#endif
+
+#define TEST_ARRAY_SIZE(a)              (sizeof(a) / sizeof((a)[0]))
+
+#define TEST_FUZZ_STREAM_BYTES          (96U)
+#define TEST_RANDOM_SEED                (3535U)
+#define TEST_TIMED_PASSES               (200000U)
+
+/* Time of one byte at 115200 bit/s, 10 bits per byte */
+#define TEST_UART_BYTE_NS               (86806U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *text;
+    cmd_status_t status;
+    cmd_op_t op;
+    cmd_param_t param;
+    uint32_t value;
+} test_parse_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const test_parse_case_t test_parse_cases[] =
+{
+    { "get",                CMD_OK,          CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "stat",               CMD_OK,          CMD_OP_STAT,     CMD_PARAM_PERIOD, 0U },
+    { "help",               CMD_OK,          CMD_OP_HELP,     CMD_PARAM_PERIOD, 0U },
+    { "defaults",           CMD_OK,          CMD_OP_DEFAULTS, CMD_PARAM_PERIOD, 0U },
+    { "  get  ",            CMD_OK,          CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period 250",     CMD_OK,          CMD_OP_SET,      CMD_PARAM_PERIOD, 250U },
+    { "set hold 0",         CMD_OK,          CMD_OP_SET,      CMD_PARAM_HOLD,   0U },
+    { "set hold 65535",     CMD_OK,          CMD_OP_SET,      CMD_PARAM_HOLD,   65535U },
+    { "set  power   lp",    CMD_OK,          CMD_OP_SET,      CMD_PARAM_POWER,  CMD_POWER_LP },
+    { "set power normal",   CMD_OK,          CMD_OP_SET,      CMD_PARAM_POWER,  CMD_POWER_NORMAL },
+    { "set wake low",       CMD_OK,          CMD_OP_SET,      CMD_PARAM_WAKE,   CMD_WAKE_LOW },
+    { "",                   CMD_ERR_EMPTY,   CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "   ",                CMD_ERR_EMPTY,   CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "reboot",             CMD_ERR_UNKNOWN, CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set speed 5",        CMD_ERR_UNKNOWN, CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "get now",            CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period",         CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period 1 2",     CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period -1",      CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period 12ms",    CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set power max",      CMD_ERR_ARG,     CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period 65536",   CMD_ERR_RANGE,   CMD_OP_GET,      CMD_PARAM_PERIOD, 0U },
+    { "set period 99999999999999999999", CMD_ERR_RANGE, CMD_OP_GET, CMD_PARAM_PERIOD, 0U },
+    { "set period 000000000000000000000250", CMD_ERR_OVERFLOW, CMD_OP_GET, CMD_PARAM_PERIOD, 0U }
+};
+
+/* Commands mutated by the fuzzer, and the bytes it inserts */
+static const char *const test_seed_lines[] =
+{
+    "get", "stat", "help", "defaults", "set period 250", "set hold 2000",
+    "set power ulp", "set power normal", "set wake high", "set wake low"
+};
+static const char test_fuzz_alphabet[] = "setgpriodhlwaknumfcx 0123456789\t\r\n\b\x7f\x01\xff";
+
+/*******************************************************************************
+* Function Name: test_feed_line
+********************************************************************************
+* Summary:
+* Feeds text followed by CR to a line and returns the status of the last
+* byte.
+*
+*******************************************************************************/
+static cmd_line_status_t test_feed_line(cmd_line_t *line, const char *text)
+{
+    for (const char *c = text; '\0' != *c; c++)
+    {
+        TEST_CHECK(CMD_LINE_PENDING == cmd_line_feed(line, (uint8_t)*c));
+    }
+
+    return cmd_line_feed(line, (uint8_t)'\r');
+}
+
+/*******************************************************************************
+* Function Name: test_parse
+********************************************************************************
+* Summary:
+* Checks the parser on the fixed cases.
+*
+*******************************************************************************/
+static void test_parse(void)
+{
+    cmd_t cmd;
+
+    for (uint32_t i = 0U; i < TEST_ARRAY_SIZE(test_parse_cases); i++)
+    {
+        const test_parse_case_t *tc = &test_parse_cases[i];
+        cmd_status_t status = cmd_parse(tc->text, &cmd);
+
+        TEST_CHECK(tc->status == status);
+        if ((tc->status != status) || (CMD_OK != status))
+        {
+            continue;
+        }
+
+        TEST_CHECK((uint8_t)tc->op == cmd.op);
+        if ((uint8_t)CMD_OP_SET == cmd.op)
+        {
+            TEST_CHECK((uint8_t)tc->param == cmd.param);
+            TEST_CHECK(tc->value == cmd.value);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_line
+********************************************************************************
+* Summary:
+* Checks the line assembly: terminators, blank lines, editing, case folding,
+* dropped control bytes, and the recovery after an overflow.
+*
+*******************************************************************************/
+static void test_line(void)
+{
+    cmd_line_t line;
+    char text[CMD_LINE_MAX + 8U];
+
+    cmd_line_reset(&line);
+
+    /* Blank lines and CR LF pairs do not complete a line */
+    TEST_CHECK(CMD_LINE_PENDING == cmd_line_feed(&line, (uint8_t)'\r'));
+    TEST_CHECK(CMD_LINE_PENDING == cmd_line_feed(&line, (uint8_t)'\n'));
+
+    TEST_CHECK(CMD_LINE_READY == test_feed_line(&line, "SET\tPeriod 25\b50"));
+    TEST_CHECK(0 == strcmp(line.buf, "set period 250"));
+    TEST_CHECK(CMD_LINE_PENDING == cmd_line_feed(&line, (uint8_t)'\n'));
+
+    TEST_CHECK(CMD_LINE_READY == test_feed_line(&line, "g\x01\x1b" "e\x80t"));
+    TEST_CHECK(0 == strcmp(line.buf, "get"));
+
+    /* Backspace on an empty line */
+    TEST_CHECK(CMD_LINE_READY == test_feed_line(&line, "\b\x7fstat"));
+    TEST_CHECK(0 == strcmp(line.buf, "stat"));
+
+    /* A line of exactly CMD_LINE_MAX bytes is accepted, one more is not */
+    memset(text, 'x', CMD_LINE_MAX);
+    text[CMD_LINE_MAX] = '\0';
+    TEST_CHECK(CMD_LINE_READY == test_feed_line(&line, text));
+    TEST_CHECK(CMD_LINE_MAX == strlen(line.buf));
+
+    text[CMD_LINE_MAX] = 'x';
+    text[CMD_LINE_MAX + 1U] = '\0';
+    for (const char *c = text; '\0' != *c; c++)
+    {
+        (void)cmd_line_feed(&line, (uint8_t)*c);
+    }
+    TEST_CHECK(CMD_LINE_PENDING == cmd_line_feed(&line, (uint8_t)'\b'));
+    TEST_CHECK(CMD_LINE_OVERFLOW == cmd_line_feed(&line, (uint8_t)'\n'));
+
+    /* The next line is received normally */
+    TEST_CHECK(CMD_LINE_READY == test_feed_line(&line, "help"));
+    TEST_CHECK(0 == strcmp(line.buf, "help"));
+}
+
+/*******************************************************************************
+* Function Name: test_params
+********************************************************************************
+* Summary:
+* Checks the range limits of the parameters, the defaults, and the codec
+* round trip and its rejection of every single bit flip.
+*
+*******************************************************************************/
+static void test_params(void)
+{
+    cmd_params_t params;
+    cmd_params_t decoded;
+    cmd_t cmd = { (uint8_t)CMD_OP_SET, (uint8_t)CMD_PARAM_PERIOD, 0U };
+    uint32_t words[CMD_PARAMS_NUM_WORDS];
+    uint32_t flipped[CMD_PARAMS_NUM_WORDS];
+    uint32_t accepted = 0U;
+
+    cmd_params_default(&params);
+    TEST_CHECK(CMD_DEFAULT_PERIOD_MS == params.period_ms);
+    TEST_CHECK(CMD_DEFAULT_HOLD_MS == params.hold_ms);
+
+    cmd.value = CMD_MIN_DURATION_MS - 1U;
+    TEST_CHECK(CMD_ERR_RANGE == cmd_params_apply(&params, &cmd));
+    cmd.value = CMD_MAX_DURATION_MS + 1U;
+    TEST_CHECK(CMD_ERR_RANGE == cmd_params_apply(&params, &cmd));
+    TEST_CHECK(CMD_DEFAULT_PERIOD_MS == params.period_ms);
+    cmd.value = CMD_MAX_DURATION_MS;
+    TEST_CHECK(CMD_OK == cmd_params_apply(&params, &cmd));
+    TEST_CHECK(CMD_MAX_DURATION_MS == params.period_ms);
+
+    cmd.param = (uint8_t)CMD_PARAM_POWER;
+    cmd.value = CMD_NUM_POWER_MODES;
+    TEST_CHECK(CMD_ERR_RANGE == cmd_params_apply(&params, &cmd));
+    cmd.param = (uint8_t)CMD_PARAM_WAKE;
+    cmd.value = CMD_WAKE_LOW;
+    TEST_CHECK(CMD_OK == cmd_params_apply(&params, &cmd));
+    cmd.param = 7U;
+    TEST_CHECK(CMD_ERR_UNKNOWN == cmd_params_apply(&params, &cmd));
+
+    cmd_params_encode(&params, words);
+    TEST_CHECK(cmd_params_decode(words, &decoded));
+    TEST_CHECK(0 == memcmp(&params, &decoded, sizeof(params)));
+
+    for (uint32_t bit = 0U; bit < (32U * CMD_PARAMS_NUM_WORDS); bit++)
+    {
+        memcpy(flipped, words, sizeof(flipped));
+        flipped[bit / 32U] ^= 1UL << (bit % 32U);
+        accepted += cmd_params_decode(flipped, &decoded) ? 1U : 0U;
+    }
+    TEST_CHECK(0U == accepted);
+
+    memset(words, 0, sizeof(words));
+    TEST_CHECK(!cmd_params_decode(words, &decoded));
+
+    cmd.op = (uint8_t)CMD_OP_DEFAULTS;
+    TEST_CHECK(CMD_OK == cmd_params_apply(&params, &cmd));
+    TEST_CHECK(CMD_DEFAULT_PERIOD_MS == params.period_ms);
+    TEST_CHECK((uint8_t)CMD_WAKE_HIGH == params.wake);
+}
+
+/*******************************************************************************
+* Function Name: test_check_line
+********************************************************************************
+* Summary:
+* Checks a completed line and the result of parsing and applying it.
+* Returns false on the first violation, so that the fuzzer reports each
+* failing stream once.
+*
+*******************************************************************************/
+static bool test_check_line(const char *text, cmd_params_t *params)
+{
+    cmd_params_t decoded;
+    cmd_status_t status;
+    uint32_t words[CMD_PARAMS_NUM_WORDS];
+    size_t len = strlen(text);
+    cmd_t cmd;
+
+    if ((0U == len) || (len > CMD_LINE_MAX))
+    {
+        return false;
+    }
+
+    for (size_t i = 0U; i < len; i++)
+    {
+        if ((text[i] < ' ') || (text[i] > '~') || ((text[i] >= 'A') && (text[i] <= 'Z')))
+        {
+            return false;
+        }
+    }
+
+    status = cmd_parse(text, &cmd);
+    if ((uint32_t)status > (uint32_t)CMD_ERR_OVERFLOW)
+    {
+        return false;
+    }
+    if (CMD_OK != status)
+    {
+        return true;
+    }
+
+    if ((cmd.op > (uint8_t)CMD_OP_HELP) ||
+        (((uint8_t)CMD_OP_SET == cmd.op) &&
+         ((cmd.param > (uint8_t)CMD_PARAM_WAKE) || (cmd.value > 0xFFFFU))))
+    {
+        return false;
+    }
+
+    status = cmd_params_apply(params, &cmd);
+    if ((CMD_OK != status) && (CMD_ERR_RANGE != status))
+    {
+        return false;
+    }
+
+    /* Whatever was applied must be storable */
+    cmd_params_encode(params, words);
+
+    return cmd_params_decode(words, &decoded) &&
+           (0 == memcmp(params, &decoded, sizeof(decoded)));
+}
+
+/*******************************************************************************
+* Function Name: test_fuzz_stream
+********************************************************************************
+* Summary:
+* Feeds a byte stream to a line and checks every completed line. Returns
+* the number of violations.
+*
+*******************************************************************************/
+static uint32_t test_fuzz_stream(cmd_line_t *line, const uint8_t *bytes,
+                                 uint32_t num_bytes, cmd_params_t *params)
+{
+    uint32_t violations = 0U;
+    cmd_line_status_t status;
+
+    for (uint32_t i = 0U; i < num_bytes; i++)
+    {
+        status = cmd_line_feed(line, bytes[i]);
+
+        if ((line->len > CMD_LINE_MAX) || (status > CMD_LINE_OVERFLOW))
+        {
+            violations++;
+        }
+        else if ((CMD_LINE_READY == status) && !test_check_line(line->buf, params))
+        {
+            violations++;
+            printf("fuzz: rejected line \"%s\"\n", line->buf);
+        }
+        else
+        {
+            /* Pending or overflow */
+        }
+    }
+
+    return violations;
+}
+
+/*******************************************************************************
+* Function Name: test_fuzz
+********************************************************************************
+* Summary:
+* Fuzzes the line assembly and the parser with random bytes and with random
+* mutations of valid commands: replaced, inserted and deleted bytes from an
+* alphabet of command characters, terminators and control bytes.
+*
+*******************************************************************************/
+static void test_fuzz(void)
+{
+    uint8_t bytes[TEST_FUZZ_STREAM_BYTES + CMD_LINE_MAX];
+    cmd_params_t params;
+    cmd_line_t line;
+    uint32_t violations = 0U;
+    uint32_t num_bytes;
+    uint32_t pos;
+    const char *seed;
+
+    srand(TEST_RANDOM_SEED);
+    cmd_params_default(&params);
+    cmd_line_reset(&line);
+
+    for (uint32_t n = 0U; n < TEST_FUZZ_STREAMS; n++)
+    {
+        if (0U == (n % 2U))
+        {
+            /* Random bytes */
+            num_bytes = (uint32_t)rand() % TEST_FUZZ_STREAM_BYTES;
+            for (uint32_t i = 0U; i < num_bytes; i++)
+            {
+                bytes[i] = (uint8_t)rand();
+            }
+        }
+        else
+        {
+            /* Mutated command */
+            seed = test_seed_lines[(uint32_t)rand() % TEST_ARRAY_SIZE(test_seed_lines)];
+            num_bytes = (uint32_t)strlen(seed);
+            memcpy(bytes, seed, num_bytes);
+
+            for (uint32_t m = (uint32_t)rand() % 4U; m > 0U; m--)
+            {
+                pos = (num_bytes > 0U) ? ((uint32_t)rand() % num_bytes) : 0U;
+                switch ((uint32_t)rand() % 3U)
+                {
+                    case 0U:
+                        if (num_bytes > 0U)
+                        {
+                            bytes[pos] = (uint8_t)test_fuzz_alphabet[(uint32_t)rand() %
+                                                    (sizeof(test_fuzz_alphabet) - 1U)];
+                        }
+                        break;
+
+                    case 1U:
+                        if (num_bytes < (sizeof(bytes) - 1U))
+                        {
+                            memmove(&bytes[pos + 1U], &bytes[pos], num_bytes - pos);
+                            bytes[pos] = (uint8_t)test_fuzz_alphabet[(uint32_t)rand() %
+                                                    (sizeof(test_fuzz_alphabet) - 1U)];
+                            num_bytes++;
+                        }
+                        break;
+
+                    default:
+                        if (num_bytes > 0U)
+                        {
+                            memmove(&bytes[pos], &bytes[pos + 1U], num_bytes - pos - 1U);
+                            num_bytes--;
+                        }
+                        break;
+                }
+            }
+            bytes[num_bytes++] = (uint8_t)'\r';
+        }
+
+        violations += test_fuzz_stream(&line, bytes, num_bytes, &params);
+    }
+
+    TEST_CHECK(0U == violations);
+    printf("Fuzzed %u streams, %u violations\n", TEST_FUZZ_STREAMS, violations);
+}
+
+#if defined(TEST_CMD_PARSER_BENCH)
+/*******************************************************************************
+* Function Name: test_throughput
+********************************************************************************
+* Summary:
+* Reports the cost of receiving and parsing the seed commands on the host,
+* per byte and per line, and the share of a 115200 bit/s byte time that the
+* per-byte cost takes.
+*
+*******************************************************************************/
+static void test_throughput(void)
+{
+    struct timespec start;
+    struct timespec end;
+    cmd_line_t line;
+    cmd_t cmd;
+    uint64_t elapsed_ns;
+    uint64_t num_bytes = 0U;
+    uint64_t num_lines = 0U;
+    uint32_t ok = 0U;
+    double byte_ns;
+
+    cmd_line_reset(&line);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (uint32_t pass = 0U; pass < TEST_TIMED_PASSES; pass++)
+    {
+        for (uint32_t i = 0U; i < TEST_ARRAY_SIZE(test_seed_lines); i++)
+        {
+            for (const char *c = test_seed_lines[i]; '\0' != *c; c++)
+            {
+                (void)cmd_line_feed(&line, (uint8_t)*c);
+                num_bytes++;
+            }
+            num_bytes++;
+            if (CMD_LINE_READY == cmd_line_feed(&line, (uint8_t)'\r'))
+            {
+                ok += (CMD_OK == cmd_parse(line.buf, &cmd)) ? 1U : 0U;
+                num_lines++;
+            }
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed_ns = ((uint64_t)(end.tv_sec - start.tv_sec) * 1000000000U) +
+                 (uint64_t)end.tv_nsec - (uint64_t)start.tv_nsec;
+    byte_ns = (double)elapsed_ns / (double)num_bytes;
+
+    TEST_CHECK(num_lines == ok);
+    printf("Parser throughput: %.1f MB/s, %.0f lines/s, %.1f ns per byte "
+           "(%.4f %% of a 115200 bit/s byte time)\n",
+           (double)num_bytes * 1000.0 / (double)elapsed_ns,
+           (double)num_lines * 1e9 / (double)elapsed_ns, byte_ns,
+           100.0 * byte_ns / (double)TEST_UART_BYTE_NS);
+}
+#endif /* defined(TEST_CMD_PARSER_BENCH) */
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the command parser tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_parse();
+    test_line();
+    test_params();
+    test_fuzz();
+#if defined(TEST_CMD_PARSER_BENCH)
+    test_throughput();
+#endif /* defined(TEST_CMD_PARSER_BENCH) */
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * File Name:   test_cmd_uart.c
+ *
+ * Description: This file contains the host test of cmd_uart.c on the UART,
+ *              GPIO and MCWDT model. Commands are sent as timed bytes while
+ *              the main loop of the CM33 non-secure application is replayed:
+ *              the RX pin wakeup that opens a session, sleeping with
+ *              interrupts masked as in the DeepSleep wait for the
+ *              comparator, the LED pattern wait, and the end of the session
+ *              on its timeout.
+ *              The test also reports, for several LED periods, the latency
+ *              from the end of a command line to its execution and the time
+ *              the session keeps the CPU in Sleep instead of DeepSleep. The
+ *              model does not account for the CPU time of the code.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "test.h"
+#include "cmd_uart.h"
+#include "led_pattern.h"
+#include "retained_data.h"
+#include "board_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Delay from the session wakeup byte to the command line */
+#define TEST_LINE_DELAY_US              (50000U)
+
+#define TEST_SESSION_PERIOD_US          ((uint64_t)CMD_SESSION_TIMEOUT_MS * 1000U)
+
+/* LFCLK rounding of the timeout and MCWDT synchronization waits */
+#define TEST_SESSION_SLACK_US           (1000U)
+
+/*******************************************************************************
+* Function Name: test_start
+********************************************************************************
+* Summary:
+* Resets the model and initializes the command interface and the LED
+* pattern player, as the application does at boot.
+*
+*******************************************************************************/
+static void test_start(void)
+{
+    model_reset();
+    model_time_us = 1000000U;
+
+    cmd_uart_init();
+    led_pattern_init();
+}
+
+/*******************************************************************************
+* Function Name: test_open_session
+********************************************************************************
+* Summary:
+* Sends one byte while the CPU is in DeepSleep. The byte is lost, and its
+* start bit opens a command session.
+*
+*******************************************************************************/
+static void test_open_session(void)
+{
+    uint32_t deepsleeps = model_deepsleeps;
+    uint32_t lost = model_uart_lost;
+
+    model_uart_rx(model_time_us + 1000U, "\r");
+    cmd_uart_sleep();
+
+    TEST_CHECK(model_deepsleeps == (deepsleeps + 1U));
+    TEST_CHECK(model_uart_lost == (lost + 1U));
+    TEST_CHECK(0U == model_uart_queued());
+}
+
+/*******************************************************************************
+* Function Name: test_init
+********************************************************************************
+* Summary:
+* With erased backup registers, the built-in parameters are loaded, with the
+* comparator power mode of board_config.h, and stored.
+*
+*******************************************************************************/
+static void test_init(void)
+{
+    cmd_params_t stored;
+    const cmd_params_t *params;
+
+    test_start();
+    params = cmd_uart_get_params();
+
+    TEST_CHECK(CMD_DEFAULT_PERIOD_MS == params->period_ms);
+    TEST_CHECK(CMD_DEFAULT_HOLD_MS == params->hold_ms);
+    TEST_CHECK(BOARD_LPCOMP_POWER_MODE == cmd_uart_lpcomp_power());
+    TEST_CHECK(cmd_params_decode(&model_backup[RETAINED_PARAMS_WORD], &stored));
+    TEST_CHECK(0 == memcmp(params, &stored, sizeof(stored)));
+}
+
+/*******************************************************************************
+* Function Name: test_session
+********************************************************************************
+* Summary:
+* A command sent after the session wakeup is executed by the main loop and
+* stored. The command was received in the first timeout period, so the
+* session ends at the end of the second one.
+*
+*******************************************************************************/
+static void test_session(void)
+{
+    cmd_params_t stored;
+    uint32_t changed = 0U;
+
+    test_start();
+    led_pattern_play(&led_pattern_active_blink);
+
+    test_open_session();
+    model_uart_rx(model_time_us + TEST_LINE_DELAY_US, "set power lp\r");
+
+    while ((0U == changed) && (1U == model_deepsleeps))
+    {
+        cmd_uart_sleep();
+        changed = cmd_uart_process();
+    }
+
+    TEST_CHECK(CMD_CHANGED_POWER == changed);
+    TEST_CHECK(CY_LPCOMP_MODE_LP == cmd_uart_lpcomp_power());
+    TEST_CHECK(1U == model_uart_lost);
+    TEST_CHECK(cmd_params_decode(&model_backup[RETAINED_PARAMS_WORD], &stored));
+    TEST_CHECK((uint8_t)CMD_POWER_LP == stored.power);
+
+    while (1U == model_deepsleeps)
+    {
+        cmd_uart_sleep();
+    }
+    TEST_CHECK_RANGE(model_sleep_us,
+                     (2U * TEST_SESSION_PERIOD_US) - TEST_SESSION_SLACK_US,
+                     (2U * TEST_SESSION_PERIOD_US) + TEST_SESSION_SLACK_US);
+
+    led_pattern_stop();
+}
+
+/*******************************************************************************
+* Function Name: test_no_pattern
+********************************************************************************
+* Summary:
+* In the wait for the comparator with no LED pattern playing, nothing but
+* the session timeout wakes the CPU from Sleep. A session without data ends
+* at the end of its first timeout period, and the CPU returns to DeepSleep.
+*
+*******************************************************************************/
+static void test_no_pattern(void)
+{
+    uint32_t interrupt_state;
+    uint64_t t0_us;
+
+    test_start();
+    test_open_session();
+    t0_us = model_time_us;
+
+    /* A byte long after the end of the session wakes the CPU from DeepSleep */
+    model_uart_rx(t0_us + (3U * TEST_SESSION_PERIOD_US), "\r");
+    while (1U == model_deepsleeps)
+    {
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        cmd_uart_sleep();
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    TEST_CHECK_RANGE(model_sleep_us,
+                     TEST_SESSION_PERIOD_US - TEST_SESSION_SLACK_US,
+                     TEST_SESSION_PERIOD_US + TEST_SESSION_SLACK_US);
+    TEST_CHECK(!led_pattern_is_active());
+}
+
+/*******************************************************************************
+* Function Name: test_masked_sleep
+********************************************************************************
+* Summary:
+* The DeepSleep wait for the comparator calls cmd_uart_sleep() with
+* interrupts masked, so the receive interrupt runs only after each wakeup.
+* The bytes waiting in the FIFO must keep the session open until the whole
+* line is received.
+*
+*******************************************************************************/
+static void test_masked_sleep(void)
+{
+    static const char line[] = "set period 250\r";
+    uint32_t interrupt_state;
+    uint32_t deepsleeps;
+
+    test_start();
+    test_open_session();
+    deepsleeps = model_deepsleeps;
+
+    model_uart_rx(model_time_us + TEST_LINE_DELAY_US, line);
+    while (0U != model_uart_queued())
+    {
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        cmd_uart_sleep();
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    TEST_CHECK(model_deepsleeps == deepsleeps);
+    TEST_CHECK(model_sleeps >= (sizeof(line) - 1U));
+    TEST_CHECK(1U == model_uart_lost);
+    TEST_CHECK(CMD_CHANGED_TIMING == cmd_uart_process());
+    TEST_CHECK(250U == cmd_uart_get_params()->period_ms);
+}
+
+/*******************************************************************************
+* Function Name: test_led_wait
+********************************************************************************
+* Summary:
+* led_pattern_wait() sleeps through cmd_uart_sleep(), so a command sent
+* during the red LED hold of an open session is received. The command is
+* typed across the first two timeout periods, so the session lasts until
+* after the end of the hold.
+*
+*******************************************************************************/
+static void test_led_wait(void)
+{
+    uint32_t deepsleeps;
+    uint64_t t0_us;
+
+    test_start();
+    test_open_session();
+    deepsleeps = model_deepsleeps;
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_hibernate_hold);
+    model_uart_rx(t0_us + 500000U, "set hold ");
+    model_uart_rx(t0_us + TEST_SESSION_PERIOD_US + 500000U, "3000\r");
+    led_pattern_wait();
+
+    TEST_CHECK(model_time_us >= (t0_us + (CMD_DEFAULT_HOLD_MS * 1000U)));
+    TEST_CHECK(model_deepsleeps == deepsleeps);
+    TEST_CHECK(1U == model_uart_lost);
+    TEST_CHECK(CMD_CHANGED_TIMING == cmd_uart_process());
+    TEST_CHECK(3000U == cmd_uart_get_params()->hold_ms);
+}
+
+/*******************************************************************************
+* Function Name: test_cost
+********************************************************************************
+* Summary:
+* Replays a command on the blinking main loop for several LED periods and
+* reports the latency from the end of the line to its execution, and the
+* time spent in Sleep from the session wakeup to the end of the session.
+* The session ends at the end of the second timeout period, whatever the
+* LED period.
+*
+*******************************************************************************/
+static void test_cost(void)
+{
+    static const uint16_t periods_ms[] = { 100U, 500U, 2000U };
+    static const char line[] = "set hold 1000\r";
+    uint64_t line_end_us;
+    uint64_t latency_us;
+    uint32_t changed;
+
+    for (uint32_t i = 0U; i < CY_ARRAY_SIZE(periods_ms); i++)
+    {
+        test_start();
+        led_pattern_set_timing(periods_ms[i], CMD_DEFAULT_HOLD_MS);
+        led_pattern_play(&led_pattern_active_blink);
+
+        test_open_session();
+        line_end_us = model_time_us + TEST_LINE_DELAY_US +
+                      ((sizeof(line) - 2U) * MODEL_UART_BYTE_US);
+        model_uart_rx(model_time_us + TEST_LINE_DELAY_US, line);
+
+        latency_us = UINT64_MAX;
+        while (1U == model_deepsleeps)
+        {
+            cmd_uart_sleep();
+            changed = cmd_uart_process();
+            if ((0U != changed) && (UINT64_MAX == latency_us))
+            {
+                latency_us = model_time_us - line_end_us;
+            }
+        }
+
+        TEST_CHECK(latency_us <= MODEL_UART_BYTE_US);
+        TEST_CHECK_RANGE(model_sleep_us,
+                         (2U * TEST_SESSION_PERIOD_US) - TEST_SESSION_SLACK_US,
+                         (2U * TEST_SESSION_PERIOD_US) + TEST_SESSION_SLACK_US);
+        printf("LED period %4u ms: command latency %3u us, session Sleep %5u ms "
+               "in %u wakeups\n", (unsigned int)periods_ms[i],
+               (unsigned int)latency_us, (unsigned int)(model_sleep_us / 1000U),
+               (unsigned int)model_sleeps);
+
+        led_pattern_stop();
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the command interface tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_init();
+    test_session();
+    test_no_pattern();
+    test_masked_sleep();
+    test_led_wait();
+    test_cost();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * File Name:   test_fault.c
+ *
+ * Description: This file contains the host test of the fault handler in
+ *              fault.c. The handler runs against the PDL model, which
+ *              leaves it through a longjmp() on the Hibernate entry or the
+ *              system reset. The test checks that every retry and every
+ *              Hibernate entry of the handler arms the RTC alarm at the end
+ *              of the back-off, that no time is spent waiting at full power,
+ *              and that a completed boot removes the alarm again.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test.h"
+#include "fault.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RTC time of the first fault: one second before the full hour, so the
+ * first alarm is in the next hour */
+#define TEST_RTC_START_S                (86400U + 3599U)
+
+/* Faults replayed by the test */
+#define TEST_FAULTS                     (FAULT_MAX_RETRIES + 2U)
+
+#define TEST_STATUS                     (0x1234U)
+
+/*******************************************************************************
+* Function Name: test_handle
+********************************************************************************
+* Summary:
+* Calls fault_handle() and returns how the model left it.
+*
+*******************************************************************************/
+static int test_handle(fault_site_t site, uint32_t status)
+{
+    jmp_buf exit_point;
+    int exit_how = setjmp(exit_point);
+
+    if (0 == exit_how)
+    {
+        model_exit = &exit_point;
+        fault_handle(site, status);
+    }
+    model_exit = NULL;
+
+    return exit_how;
+}
+
+/*******************************************************************************
+* Function Name: test_alarm_at
+********************************************************************************
+* Summary:
+* Checks that the RTC alarm is armed as a Hibernate wakeup source and matches
+* the minute and the second of an RTC time only.
+*
+*******************************************************************************/
+static void test_alarm_at(uint32_t time_s)
+{
+    const cy_stc_rtc_alarm_t *alarm = &model_rtc_alarm[CY_RTC_ALARM_1];
+
+    TEST_CHECK(0U != (model_hib_wakeup & (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM));
+    TEST_CHECK(0U != (model_rtc_intr_mask & CY_RTC_INTR_ALARM1));
+    TEST_CHECK(CY_RTC_ALARM_ENABLE == alarm->almEn);
+    TEST_CHECK((CY_RTC_ALARM_ENABLE == alarm->secEn) &&
+               (CY_RTC_ALARM_ENABLE == alarm->minEn));
+    TEST_CHECK((CY_RTC_ALARM_DISABLE == alarm->hourEn) &&
+               (CY_RTC_ALARM_DISABLE == alarm->dayOfWeekEn) &&
+               (CY_RTC_ALARM_DISABLE == alarm->dateEn) &&
+               (CY_RTC_ALARM_DISABLE == alarm->monthEn));
+    TEST_CHECK((time_s % 60U) == alarm->sec);
+    TEST_CHECK(((time_s / 60U) % 60U) == alarm->min);
+}
+
+/*******************************************************************************
+* Function Name: test_escalation
+********************************************************************************
+* Summary:
+* Replays consecutive faults of the CM33 non-secure image. The retries wait
+* for the back-off in Hibernate with the RTC alarm only, so the comparator
+* cannot shorten it. The Hibernate action arms the comparator and the RTC
+* alarm. Each wakeup is a reset at the time of the alarm.
+*
+*******************************************************************************/
+static void test_escalation(void)
+{
+    fault_record_t record;
+    uint32_t backoff_s;
+    uint32_t now_s = TEST_RTC_START_S;
+
+    model_reset();
+    model_rtc_base_s = TEST_RTC_START_S;
+    model_reset_reason = 0x10U;
+
+    /* Left over from the last Hibernate entry of the application */
+    model_hib_wakeup = (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH;
+    fault_set_wakeup_source((uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH);
+    fault_set_phase(FAULT_PHASE_INIT);
+
+    for (uint32_t n = 1U; n <= TEST_FAULTS; n++)
+    {
+        uint64_t start_us = model_time_us;
+
+        TEST_CHECK(MODEL_EXIT_HIBERNATE == test_handle(FAULT_SITE_NS_UART_INIT, TEST_STATUS));
+        TEST_CHECK(n == model_hibernates);
+        TEST_CHECK(0U == model_system_resets);
+        TEST_CHECK(start_us == model_time_us);
+
+        TEST_CHECK(fault_get_last(&record));
+        TEST_CHECK(n == record.count);
+        TEST_CHECK((FAULT_SITE_NS_UART_INIT == record.site) &&
+                   (FAULT_PHASE_INIT == record.phase) &&
+                   (FAULT_CORE_CM33_NS == record.core) &&
+                   (TEST_STATUS == record.status) &&
+                   (0x10U == record.reset_reason));
+
+        (void)fault_recovery_action(&record, &backoff_s);
+        test_alarm_at(now_s + backoff_s);
+        if (n <= FAULT_MAX_RETRIES)
+        {
+            TEST_CHECK((uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM == model_hib_wakeup);
+        }
+        else
+        {
+            TEST_CHECK(((uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM |
+                        (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH) == model_hib_wakeup);
+        }
+
+        /* The alarm wakes the device, which boots and faults again */
+        now_s += backoff_s;
+        model_time_us += (uint64_t)backoff_s * 1000000U;
+        model_hib_wakeup = (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM;
+    }
+
+    /* The first alarm crossed the full hour */
+    TEST_CHECK(0U == (TEST_RTC_START_S + FAULT_RETRY_BASE_S) % 3600U);
+
+    /* A completed boot removes the record and the alarm */
+    model_hib_wakeup |= (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH;
+    fault_clear();
+    TEST_CHECK(!fault_get_last(&record));
+    TEST_CHECK((uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH == model_hib_wakeup);
+    TEST_CHECK(0U == (model_rtc_intr_mask & CY_RTC_INTR_ALARM1));
+}
+
+/*******************************************************************************
+* Function Name: test_no_wakeup_source
+********************************************************************************
+* Summary:
+* A fault before the application has set a wakeup source still hibernates
+* with the RTC alarm, so the device wakes up at the end of the back-off.
+*
+*******************************************************************************/
+static void test_no_wakeup_source(void)
+{
+    uint32_t backoff_s;
+    fault_record_t record;
+
+    model_reset();
+    model_rtc_base_s = TEST_RTC_START_S;
+    fault_set_wakeup_source(0U);
+
+    for (uint32_t n = 1U; n <= TEST_FAULTS; n++)
+    {
+        TEST_CHECK(MODEL_EXIT_HIBERNATE == test_handle(FAULT_SITE_NS_BSP_INIT, TEST_STATUS));
+        TEST_CHECK((uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM == model_hib_wakeup);
+        TEST_CHECK(fault_get_last(&record));
+        (void)fault_recovery_action(&record, &backoff_s);
+        test_alarm_at(TEST_RTC_START_S + backoff_s);
+    }
+    TEST_CHECK(TEST_FAULTS == model_hibernates);
+}
+
+/*******************************************************************************
+* Function Name: test_hibernate_fails
+********************************************************************************
+* Summary:
+* If the Hibernate entry of a retry fails, the handler resets the system at
+* once instead of waiting for the back-off at full power.
+*
+*******************************************************************************/
+static void test_hibernate_fails(void)
+{
+    model_reset();
+    fault_set_wakeup_source((uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_LOW);
+    model_hib_status = CY_SYSPM_FAIL;
+
+    TEST_CHECK(MODEL_EXIT_RESET == test_handle(FAULT_SITE_NS_RETARGET_INIT, TEST_STATUS));
+    TEST_CHECK(0U == model_hibernates);
+    TEST_CHECK(1U == model_system_resets);
+    TEST_CHECK(0U == model_time_us);
+}
+
+int main(void)
+{
+    test_escalation();
+    test_no_wakeup_source();
+    test_hibernate_fails();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
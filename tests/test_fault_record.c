@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * File Name:   test_fault_record.c
+ *
+ * Description: This file contains the host test of fault_record.c. The
+ *              record codec is checked for round trips, field widths and the
+ *              rejection of corrupted or cleared backup register contents.
+ *              The retry escalation is replayed as a sequence of boots that
+ *              fault, with the record kept in a model of the backup
+ *              registers as fault_handle() does.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "fault_record.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_RANDOM_WORDS               (100000U)
+#define TEST_RANDOM_SEED                (4242U)
+
+/* Faults replayed by the escalation test */
+#define TEST_ESCALATION_FAULTS          (FAULT_MAX_RETRIES + 3U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const fault_site_t test_sites[] =
+{
+    FAULT_SITE_S_BSP_INIT, FAULT_SITE_S_SMIF_INIT, FAULT_SITE_S_MPC_INIT,
+    FAULT_SITE_S_PPC0_INIT, FAULT_SITE_S_PPC1_INIT, FAULT_SITE_S_RESET_CONFIG,
+    FAULT_SITE_NS_BSP_INIT, FAULT_SITE_NS_UART_INIT, FAULT_SITE_NS_UART_SETUP,
+    FAULT_SITE_NS_RETARGET_INIT, FAULT_SITE_NS_HIBERNATE, FAULT_SITE_CM55_BSP_INIT
+};
+
+/*******************************************************************************
+* Function Name: test_record_equal
+********************************************************************************
+* Summary:
+* Returns true if two records have the same fields.
+*
+*******************************************************************************/
+static bool test_record_equal(const fault_record_t *a, const fault_record_t *b)
+{
+    return (a->site == b->site) && (a->phase == b->phase) &&
+           (a->core == b->core) && (a->count == b->count) &&
+           (a->status == b->status) && (a->reset_reason == b->reset_reason);
+}
+
+/*******************************************************************************
+* Function Name: test_codec
+********************************************************************************
+* Summary:
+* Checks round trips over all sites, phases, cores and counts, and the width
+* of the packed fields.
+*
+*******************************************************************************/
+static void test_codec(void)
+{
+    fault_record_t record;
+    fault_record_t decoded;
+    uint32_t words[FAULT_RECORD_NUM_WORDS];
+    uint32_t failures = 0U;
+
+    for (uint32_t s = 0U; s < (uint32_t)(sizeof(test_sites) / sizeof(test_sites[0])); s++)
+    {
+        for (uint32_t phase = FAULT_PHASE_BOOT; phase <= FAULT_PHASE_RUN; phase++)
+        {
+            for (uint32_t core = FAULT_CORE_CM33_S; core <= FAULT_CORE_CM55; core++)
+            {
+                for (uint32_t count = 0U; count <= UINT8_MAX; count++)
+                {
+                    record.site = (uint8_t)test_sites[s];
+                    record.phase = (uint8_t)phase;
+                    record.core = (uint8_t)core;
+                    record.count = (uint8_t)count;
+                    record.status = 0xA5000000UL ^ (count * 0x01010101UL);
+                    record.reset_reason = (uint32_t)s << core;
+
+                    fault_record_encode(&record, words);
+                    memset(&decoded, 0xFF, sizeof(decoded));
+                    if (!fault_record_decode(words, &decoded) ||
+                        !test_record_equal(&record, &decoded))
+                    {
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+    TEST_CHECK(0U == failures);
+
+    /* Phase and core are stored in four bits each */
+    record.phase = 0x1FU;
+    record.core = 0x2EU;
+    fault_record_encode(&record, words);
+    TEST_CHECK(fault_record_decode(words, &decoded));
+    TEST_CHECK(0x0FU == decoded.phase);
+    TEST_CHECK(0x0EU == decoded.core);
+    TEST_CHECK(record.site == decoded.site);
+    TEST_CHECK(record.count == decoded.count);
+}
+
+/*******************************************************************************
+* Function Name: test_corruption
+********************************************************************************
+* Summary:
+* Checks that cleared, erased, random and bit-flipped words are rejected.
+*
+*******************************************************************************/
+static void test_corruption(void)
+{
+    fault_record_t record =
+    {
+        .site = FAULT_SITE_NS_UART_INIT, .phase = FAULT_PHASE_INIT,
+        .core = FAULT_CORE_CM33_NS, .count = 2U,
+        .status = 0x12345678UL, .reset_reason = 0x10UL
+    };
+    fault_record_t decoded;
+    uint32_t words[FAULT_RECORD_NUM_WORDS];
+    uint32_t flipped[FAULT_RECORD_NUM_WORDS];
+    uint32_t accepted = 0U;
+
+    /* Cleared by fault_clear(), and erased */
+    memset(words, 0, sizeof(words));
+    TEST_CHECK(!fault_record_decode(words, &decoded));
+    memset(words, 0xFF, sizeof(words));
+    TEST_CHECK(!fault_record_decode(words, &decoded));
+
+    /* Every single bit flip */
+    fault_record_encode(&record, words);
+    for (uint32_t bit = 0U; bit < (32U * FAULT_RECORD_NUM_WORDS); bit++)
+    {
+        memcpy(flipped, words, sizeof(words));
+        flipped[bit / 32U] ^= 1UL << (bit % 32U);
+        if (fault_record_decode(flipped, &decoded))
+        {
+            accepted++;
+        }
+    }
+    TEST_CHECK(0U == accepted);
+
+    /* Random contents, for example after a brown-out */
+    srand(TEST_RANDOM_SEED);
+    for (uint32_t i = 0U; i < TEST_RANDOM_WORDS; i++)
+    {
+        for (uint32_t w = 0U; w < FAULT_RECORD_NUM_WORDS; w++)
+        {
+            flipped[w] = ((uint32_t)rand() << 16U) ^ (uint32_t)rand();
+        }
+        if (fault_record_decode(flipped, &decoded))
+        {
+            accepted++;
+        }
+    }
+    TEST_CHECK(0U == accepted);
+}
+
+/*******************************************************************************
+* Function Name: test_fault
+********************************************************************************
+* Summary:
+* Models one fault as fault_handle() records it: the count follows from the
+* record in the backup registers, and the new record replaces it.
+*
+*******************************************************************************/
+static fault_action_t test_fault(uint32_t backup[FAULT_RECORD_NUM_WORDS],
+                                 fault_core_t core, uint32_t *backoff_s)
+{
+    fault_record_t record =
+    {
+        .site = FAULT_SITE_NS_UART_INIT, .phase = FAULT_PHASE_INIT,
+        .core = (uint8_t)core, .status = 1U, .reset_reason = 0U
+    };
+
+    record.count = fault_record_next_count(backup);
+    fault_record_encode(&record, backup);
+
+    return fault_recovery_action(&record, backoff_s);
+}
+
+/*******************************************************************************
+* Function Name: test_escalation
+********************************************************************************
+* Summary:
+* Replays consecutive faults: FAULT_MAX_RETRIES retries, then Hibernate for
+* every further fault until a boot completes and clears the record. The
+* back-off doubles with every fault up to FAULT_BACKOFF_MAX_S. The CM55
+* always halts.
+*
+*******************************************************************************/
+static void test_escalation(void)
+{
+    uint32_t backup[FAULT_RECORD_NUM_WORDS] = { 0U };
+    fault_record_t record;
+    fault_action_t action;
+    uint32_t backoff_s;
+    uint32_t last_s = 0U;
+    uint32_t total_s = 0U;
+
+    for (uint32_t n = 1U; n <= TEST_ESCALATION_FAULTS; n++)
+    {
+        action = test_fault(backup, FAULT_CORE_CM33_NS, &backoff_s);
+        TEST_CHECK(fault_record_decode(backup, &record));
+        TEST_CHECK(n == record.count);
+        TEST_CHECK((FAULT_RETRY_BASE_S << (n - 1U)) == backoff_s);
+
+        if (n <= FAULT_MAX_RETRIES)
+        {
+            TEST_CHECK(FAULT_ACTION_RETRY == action);
+            total_s += backoff_s;
+        }
+        else
+        {
+            TEST_CHECK(FAULT_ACTION_HIBERNATE == action);
+        }
+    }
+    TEST_CHECK((FAULT_RETRY_BASE_S * ((1UL << FAULT_MAX_RETRIES) - 1UL)) == total_s);
+
+    /* The back-off grows up to the limit and stays there */
+    for (uint32_t n = TEST_ESCALATION_FAULTS + 1U; n <= UINT8_MAX; n++)
+    {
+        action = test_fault(backup, FAULT_CORE_CM33_NS, &backoff_s);
+        TEST_CHECK(FAULT_ACTION_HIBERNATE == action);
+        TEST_CHECK((backoff_s >= last_s) && (backoff_s <= FAULT_BACKOFF_MAX_S));
+        last_s = backoff_s;
+    }
+    TEST_CHECK(FAULT_BACKOFF_MAX_S == last_s);
+    TEST_CHECK(FAULT_BACKOFF_MAX_S < 3600U);
+
+    /* A fault on another core continues the count */
+    action = test_fault(backup, FAULT_CORE_CM33_S, &backoff_s);
+    TEST_CHECK(FAULT_ACTION_HIBERNATE == action);
+
+    /* A completed boot clears the record: retries start again */
+    memset(backup, 0, sizeof(backup));
+    action = test_fault(backup, FAULT_CORE_CM33_S, &backoff_s);
+    TEST_CHECK(FAULT_ACTION_RETRY == action);
+    TEST_CHECK(FAULT_RETRY_BASE_S == backoff_s);
+
+    /* A corrupted record also restarts the count */
+    backup[1] ^= 1U;
+    TEST_CHECK(1U == fault_record_next_count(backup));
+
+    /* The CM55 halts, whatever the count */
+    for (uint32_t n = 1U; n <= TEST_ESCALATION_FAULTS; n++)
+    {
+        action = test_fault(backup, FAULT_CORE_CM55, &backoff_s);
+        TEST_CHECK(FAULT_ACTION_HALT == action);
+        TEST_CHECK(0U == backoff_s);
+    }
+
+    /* The count saturates, and a count of 0 hibernates for the longest
+     * back-off */
+    record.count = UINT8_MAX;
+    record.core = FAULT_CORE_CM33_NS;
+    fault_record_encode(&record, backup);
+    TEST_CHECK(UINT8_MAX == fault_record_next_count(backup));
+    record.count = 0U;
+    TEST_CHECK(FAULT_ACTION_HIBERNATE == fault_recovery_action(&record, &backoff_s));
+    TEST_CHECK(FAULT_BACKOFF_MAX_S == backoff_s);
+}
+
+int main(void)
+{
+    test_codec();
+    test_corruption();
+    test_escalation();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * File Name:   test_idle_policy.c
+ *
+ * Description: This file contains the host test of idle_policy.c. The
+ *              break-even intervals of the default model are checked against
+ *              the energy of the states, and the selection is compared with
+ *              an exhaustive search for the lowest energy state on random
+ *              models, around the break-even intervals and for a range of
+ *              latency limits.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include "test.h"
+#include "idle_policy.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_RANDOM_MODELS              (2000U)
+#define TEST_RANDOM_SEED                (12345U)
+
+/*******************************************************************************
+* Function Name: test_lowest_energy
+********************************************************************************
+* Summary:
+* Reference selection: the state with the lowest energy within the latency
+* limit, the shallowest one on equal energy.
+*
+*******************************************************************************/
+static idle_policy_state_t test_lowest_energy(const idle_policy_model_t *model,
+                                              uint32_t idle_ms,
+                                              uint32_t max_latency_us)
+{
+    idle_policy_state_t best = IDLE_POLICY_SLEEP;
+
+    for (uint32_t i = 1U; i < (uint32_t)IDLE_POLICY_NUM_STATES; i++)
+    {
+        if ((model->state[i].exit_us <= max_latency_us) &&
+            (idle_policy_energy_nj(model, (idle_policy_state_t)i, idle_ms) <
+             idle_policy_energy_nj(model, best, idle_ms)))
+        {
+            best = (idle_policy_state_t)i;
+        }
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: test_check_break_even
+********************************************************************************
+* Summary:
+* Checks that the deep state is cheaper at the break-even interval and not
+* cheaper one millisecond before.
+*
+*******************************************************************************/
+static void test_check_break_even(const idle_policy_model_t *model,
+                                  idle_policy_state_t shallow,
+                                  idle_policy_state_t deep)
+{
+    uint32_t be = idle_policy_break_even_ms(model, shallow, deep);
+
+    if (IDLE_POLICY_IDLE_UNBOUNDED == be)
+    {
+        TEST_CHECK(idle_policy_energy_nj(model, deep, 1000000U) >=
+                   idle_policy_energy_nj(model, shallow, 1000000U));
+        return;
+    }
+
+    TEST_CHECK(idle_policy_energy_nj(model, deep, be) <
+               idle_policy_energy_nj(model, shallow, be));
+    if (0U != be)
+    {
+        TEST_CHECK(idle_policy_energy_nj(model, deep, be - 1U) >=
+                   idle_policy_energy_nj(model, shallow, be - 1U));
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_default_model
+********************************************************************************
+* Summary:
+* Checks the break-even intervals and choices of the default model.
+*
+*******************************************************************************/
+static void test_default_model(void)
+{
+    idle_policy_model_t model;
+    uint32_t deepsleep_ms;
+    uint32_t off_ms;
+
+    idle_policy_model_init_default(&model);
+
+    deepsleep_ms = idle_policy_break_even_ms(&model, IDLE_POLICY_SLEEP,
+                                             IDLE_POLICY_DEEPSLEEP);
+    off_ms = idle_policy_break_even_ms(&model, IDLE_POLICY_DEEPSLEEP,
+                                       IDLE_POLICY_OFF);
+    printf("Default model: DeepSleep from %u ms, Off from %u ms\n",
+           (unsigned int)deepsleep_ms, (unsigned int)off_ms);
+
+    TEST_CHECK(deepsleep_ms < off_ms);
+    TEST_CHECK(IDLE_POLICY_IDLE_UNBOUNDED != off_ms);
+    test_check_break_even(&model, IDLE_POLICY_SLEEP, IDLE_POLICY_DEEPSLEEP);
+    test_check_break_even(&model, IDLE_POLICY_DEEPSLEEP, IDLE_POLICY_OFF);
+    test_check_break_even(&model, IDLE_POLICY_SLEEP, IDLE_POLICY_OFF);
+
+    TEST_CHECK(IDLE_POLICY_SLEEP == idle_policy_choose(&model, 0U,
+                                        IDLE_POLICY_MAX_WAKE_LATENCY_US));
+    if (0U != deepsleep_ms)
+    {
+        TEST_CHECK(IDLE_POLICY_SLEEP == idle_policy_choose(&model,
+                        deepsleep_ms - 1U, IDLE_POLICY_MAX_WAKE_LATENCY_US));
+    }
+    TEST_CHECK(IDLE_POLICY_DEEPSLEEP == idle_policy_choose(&model, deepsleep_ms,
+                                        IDLE_POLICY_MAX_WAKE_LATENCY_US));
+    TEST_CHECK(IDLE_POLICY_DEEPSLEEP == idle_policy_choose(&model, off_ms - 1U,
+                                        IDLE_POLICY_MAX_WAKE_LATENCY_US));
+    TEST_CHECK(IDLE_POLICY_OFF == idle_policy_choose(&model, off_ms,
+                                        IDLE_POLICY_MAX_WAKE_LATENCY_US));
+    TEST_CHECK(IDLE_POLICY_OFF == idle_policy_choose(&model,
+                        IDLE_POLICY_IDLE_UNBOUNDED, IDLE_POLICY_MAX_WAKE_LATENCY_US));
+
+    /* Latency limit below the boot time, and below the DeepSleep exit */
+    TEST_CHECK(IDLE_POLICY_DEEPSLEEP == idle_policy_choose(&model,
+                        IDLE_POLICY_IDLE_UNBOUNDED, model.state[IDLE_POLICY_OFF].exit_us - 1U));
+    TEST_CHECK(IDLE_POLICY_SLEEP == idle_policy_choose(&model,
+                        IDLE_POLICY_IDLE_UNBOUNDED, model.state[IDLE_POLICY_DEEPSLEEP].exit_us - 1U));
+}
+
+/*******************************************************************************
+* Function Name: test_ties
+********************************************************************************
+* Summary:
+* Checks the break-even at exact divisions, where both states use the same
+* energy, and the degenerate cost combinations.
+*
+*******************************************************************************/
+static void test_ties(void)
+{
+    idle_policy_model_t model =
+    {
+        .state =
+        {
+            [IDLE_POLICY_SLEEP]     = { .power_uw = 10U, .transition_nj = 0U,   .exit_us = 0U },
+            [IDLE_POLICY_DEEPSLEEP] = { .power_uw = 0U,  .transition_nj = 100U, .exit_us = 0U },
+            [IDLE_POLICY_OFF]       = { .power_uw = 0U,  .transition_nj = 100U, .exit_us = 0U }
+        }
+    };
+
+    /* Equal energy at 10 ms keeps Sleep */
+    TEST_CHECK(11U == idle_policy_break_even_ms(&model, IDLE_POLICY_SLEEP, IDLE_POLICY_DEEPSLEEP));
+    TEST_CHECK(IDLE_POLICY_SLEEP == idle_policy_choose(&model, 10U, 0U));
+    TEST_CHECK(IDLE_POLICY_DEEPSLEEP == idle_policy_choose(&model, 11U, 0U));
+
+    /* Identical costs: the deeper state never pays off */
+    TEST_CHECK(IDLE_POLICY_IDLE_UNBOUNDED ==
+               idle_policy_break_even_ms(&model, IDLE_POLICY_DEEPSLEEP, IDLE_POLICY_OFF));
+    TEST_CHECK(IDLE_POLICY_DEEPSLEEP == idle_policy_choose(&model, IDLE_POLICY_IDLE_UNBOUNDED, 0U));
+
+    /* Same transition energy, lower power: cheaper for any non-zero interval */
+    model.state[IDLE_POLICY_OFF].transition_nj = 100U;
+    model.state[IDLE_POLICY_DEEPSLEEP].power_uw = 1U;
+    TEST_CHECK(1U == idle_policy_break_even_ms(&model, IDLE_POLICY_DEEPSLEEP, IDLE_POLICY_OFF));
+
+    /* Same power, lower transition energy: always cheaper */
+    model.state[IDLE_POLICY_OFF].power_uw = 1U;
+    model.state[IDLE_POLICY_OFF].transition_nj = 99U;
+    TEST_CHECK(0U == idle_policy_break_even_ms(&model, IDLE_POLICY_DEEPSLEEP, IDLE_POLICY_OFF));
+
+    /* Higher power: never */
+    model.state[IDLE_POLICY_OFF].power_uw = 2U;
+    TEST_CHECK(IDLE_POLICY_IDLE_UNBOUNDED ==
+               idle_policy_break_even_ms(&model, IDLE_POLICY_DEEPSLEEP, IDLE_POLICY_OFF));
+}
+
+/*******************************************************************************
+* Function Name: test_random_models
+********************************************************************************
+* Summary:
+* Compares idle_policy_choose() with the exhaustive search on random models
+* whose states get deeper in order: the power does not rise and the
+* transition energy does not fall from one state to the next.
+*
+*******************************************************************************/
+static void test_random_models(void)
+{
+    idle_policy_model_t model;
+    uint32_t mismatches = 0U;
+    uint32_t cases = 0U;
+    uint32_t intervals[8];
+    uint32_t latencies[4];
+
+    srand(TEST_RANDOM_SEED);
+
+    for (uint32_t m = 0U; m < TEST_RANDOM_MODELS; m++)
+    {
+        model.state[IDLE_POLICY_SLEEP].power_uw = 1000U + ((uint32_t)rand() % 50000U);
+        model.state[IDLE_POLICY_SLEEP].transition_nj = (uint32_t)rand() % 10U;
+        model.state[IDLE_POLICY_SLEEP].exit_us = 1U;
+        for (uint32_t i = 1U; i < (uint32_t)IDLE_POLICY_NUM_STATES; i++)
+        {
+            /* Small ranges make equal costs and exact divisions likely */
+            model.state[i].power_uw = model.state[i - 1U].power_uw -
+                ((uint32_t)rand() % (model.state[i - 1U].power_uw + 1U));
+            model.state[i].transition_nj = model.state[i - 1U].transition_nj +
+                (((uint32_t)rand() % 4U) * ((uint32_t)rand() % 1000000U));
+            model.state[i].exit_us = model.state[i - 1U].exit_us +
+                ((uint32_t)rand() % 100000U);
+        }
+
+        intervals[0] = 0U;
+        intervals[1] = 1U;
+        intervals[2] = (uint32_t)rand() % 100000U;
+        intervals[3] = IDLE_POLICY_IDLE_UNBOUNDED;
+        for (uint32_t k = 0U; k < 2U; k++)
+        {
+            uint32_t be = idle_policy_break_even_ms(&model, (idle_policy_state_t)k,
+                                                    (idle_policy_state_t)(k + 1U));
+            intervals[4U + (2U * k)] = be;
+            intervals[5U + (2U * k)] = (0U != be) ? (be - 1U) : 0U;
+            test_check_break_even(&model, (idle_policy_state_t)k, (idle_policy_state_t)(k + 1U));
+        }
+
+        latencies[0] = 0U;
+        latencies[1] = model.state[IDLE_POLICY_DEEPSLEEP].exit_us;
+        latencies[2] = model.state[IDLE_POLICY_OFF].exit_us - 1U;
+        latencies[3] = UINT32_MAX;
+
+        for (uint32_t t = 0U; t < 8U; t++)
+        {
+            for (uint32_t l = 0U; l < 4U; l++)
+            {
+                cases++;
+                if (idle_policy_choose(&model, intervals[t], latencies[l]) !=
+                    test_lowest_energy(&model, intervals[t], latencies[l]))
+                {
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    printf("Random models: %u cases, %u mismatches\n",
+           (unsigned int)cases, (unsigned int)mismatches);
+    TEST_CHECK(0U == mismatches);
+}
+
+int main(void)
+{
+    test_default_model();
+    test_ties();
+    test_random_models();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
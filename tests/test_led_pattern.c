@@ -0,0 +1,424 @@
+/*******************************************************************************
+ * File Name:   test_led_pattern.c
+ *
+ * Description: This file contains the host test of led_pattern.c. Patterns
+ *              are played on the MCWDT and GPIO model, and the LED edges
+ *              are checked against the expected step sequence and timing,
+ *              including steps longer than the 16-bit counter range, the
+ *              error code flashed after a recovered fault, and the DeepSleep
+ *              wait for the end of a pattern.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "test.h"
+#include "led_pattern.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_MAX_EDGES                  (128U)
+
+/* Edge timing tolerance: LFCLK rounding of the step durations and the MCWDT
+ * synchronization waits */
+#define TEST_TOLERANCE_US               (1000U)
+
+#define TEST_RED                        (MODEL_PORT_LED_RED)
+#define TEST_GREEN                      (MODEL_PORT_LED_GREEN)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* LED output change, at a time relative to the start of the pattern */
+typedef struct
+{
+    uint64_t time_us;
+    uint32_t port;
+    uint32_t value;
+} test_edge_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static test_edge_t test_edges[TEST_MAX_EDGES];
+static uint32_t test_num_edges;
+
+/*******************************************************************************
+* Function Name: test_gpio_hook
+********************************************************************************
+* Summary:
+* Records the LED edges driven by the pattern player.
+*
+*******************************************************************************/
+static void test_gpio_hook(uint32_t port, uint32_t pin, uint32_t value)
+{
+    (void)pin;
+
+    if (test_num_edges < TEST_MAX_EDGES)
+    {
+        test_edges[test_num_edges].time_us = model_time_us;
+        test_edges[test_num_edges].port = port;
+        test_edges[test_num_edges].value = value;
+    }
+    test_num_edges++;
+}
+
+/*******************************************************************************
+* Function Name: test_start
+********************************************************************************
+* Summary:
+* Resets the model and the edge log and initializes the pattern player.
+*
+*******************************************************************************/
+static void test_start(void)
+{
+    model_reset();
+    model_time_us = 1000000U;
+    model_gpio_hook = test_gpio_hook;
+    test_num_edges = 0U;
+
+    led_pattern_init();
+}
+
+/*******************************************************************************
+* Function Name: test_expect
+********************************************************************************
+* Summary:
+* Checks the recorded edges against the expected ones. Expected times are
+* in milliseconds after t0_us.
+*
+*******************************************************************************/
+static void test_expect(const uint32_t (*expected)[3], uint32_t num_expected,
+                        uint64_t t0_us)
+{
+    TEST_CHECK(test_num_edges == num_expected);
+
+    for (uint32_t i = 0U; (i < num_expected) && (i < test_num_edges); i++)
+    {
+        double expected_us = (double)t0_us + (1000.0 * expected[i][0]);
+
+        TEST_CHECK(test_edges[i].port == expected[i][1]);
+        TEST_CHECK(test_edges[i].value == expected[i][2]);
+        TEST_CHECK_RANGE(test_edges[i].time_us, expected_us - TEST_TOLERANCE_US,
+                         expected_us + TEST_TOLERANCE_US);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_active_blink
+********************************************************************************
+* Summary:
+* The active blink toggles the red LED every 500 ms until it is stopped,
+* and starting it again while it plays does not restart it.
+*
+*******************************************************************************/
+static void test_active_blink(void)
+{
+    static const uint32_t expected[][3] =
+    {
+        { 0U,    TEST_RED, 1U }, { 500U,  TEST_RED, 0U },
+        { 1000U, TEST_RED, 1U }, { 1500U, TEST_RED, 0U },
+        { 2000U, TEST_RED, 1U }, { 2500U, TEST_RED, 0U },
+        { 3000U, TEST_RED, 1U }
+    };
+    uint64_t t0_us;
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_active_blink);
+    model_run_until(t0_us + 1200000U);
+    led_pattern_play(&led_pattern_active_blink);
+    model_run_until(t0_us + 3200000U);
+
+    TEST_CHECK(led_pattern_is_active());
+    test_expect(expected, CY_ARRAY_SIZE(expected), t0_us);
+
+    led_pattern_stop();
+    TEST_CHECK(!led_pattern_is_active());
+    TEST_CHECK(0U == Cy_GPIO_ReadOut(CYBSP_LED_RED_PORT, CYBSP_LED_RED_PIN));
+}
+
+/*******************************************************************************
+* Function Name: test_hibernate_hold
+********************************************************************************
+* Summary:
+* The hold lights the red LED for 2 s and ends with both LEDs off, and
+* led_pattern_wait() sleeps until then. With a hold longer than the 16-bit
+* counter range the step is timed in several counter periods.
+*
+*******************************************************************************/
+static void test_hibernate_hold(void)
+{
+    static const uint32_t expected_2s[][3] =
+    {
+        { 0U, TEST_RED, 1U }, { 2000U, TEST_RED, 0U }
+    };
+    static const uint32_t expected_10s[][3] =
+    {
+        { 0U, TEST_RED, 1U }, { 10000U, TEST_RED, 0U }
+    };
+    uint64_t t0_us;
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_hibernate_hold);
+    led_pattern_wait();
+
+    TEST_CHECK(!led_pattern_is_active());
+    TEST_CHECK_RANGE(model_time_us, t0_us + 2000000U - TEST_TOLERANCE_US,
+                     t0_us + 2000000U + TEST_TOLERANCE_US);
+    TEST_CHECK(model_deepsleeps == 1U);
+    test_expect(expected_2s, CY_ARRAY_SIZE(expected_2s), t0_us);
+
+    /* 10 s is five periods of the 65536-tick counter */
+    test_start();
+    led_pattern_set_timing(500U, 10000U);
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_hibernate_hold);
+    led_pattern_wait();
+
+    TEST_CHECK(model_deepsleeps == 5U);
+    test_expect(expected_10s, CY_ARRAY_SIZE(expected_10s), t0_us);
+
+    led_pattern_set_timing(500U, 2000U);
+}
+
+/*******************************************************************************
+* Function Name: test_set_timing
+********************************************************************************
+* Summary:
+* A new blink period is used from the next step of the playing pattern.
+*
+*******************************************************************************/
+static void test_set_timing(void)
+{
+    static const uint32_t expected[][3] =
+    {
+        { 0U,   TEST_RED, 1U }, { 500U, TEST_RED, 0U },
+        { 600U, TEST_RED, 1U }, { 700U, TEST_RED, 0U },
+        { 800U, TEST_RED, 1U }
+    };
+    uint64_t t0_us;
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_active_blink);
+    model_run_until(t0_us + 250000U);
+    led_pattern_set_timing(100U, 2000U);
+    model_run_until(t0_us + 850000U);
+
+    test_expect(expected, CY_ARRAY_SIZE(expected), t0_us);
+
+    led_pattern_stop();
+    led_pattern_set_timing(500U, 2000U);
+}
+
+/*******************************************************************************
+* Function Name: test_error_code
+********************************************************************************
+* Summary:
+* An error code is flashed on the red LED and followed by a pause with the
+* green LED on, for the requested number of plays. Codes above the maximum
+* are clamped, and a code played forever is replaced by the next pattern.
+*
+*******************************************************************************/
+static void test_error_code(void)
+{
+    static const uint32_t expected[][3] =
+    {
+        { 0U,    TEST_RED, 1U },   { 200U,  TEST_RED, 0U },
+        { 400U,  TEST_RED, 1U },   { 600U,  TEST_RED, 0U },
+        { 800U,  TEST_GREEN, 1U }, { 1800U, TEST_RED, 1U },
+        { 1800U, TEST_GREEN, 0U }, { 2000U, TEST_RED, 0U },
+        { 2200U, TEST_RED, 1U },   { 2400U, TEST_RED, 0U },
+        { 2600U, TEST_GREEN, 1U }, { 3600U, TEST_GREEN, 0U }
+    };
+    uint32_t flashes = 0U;
+    uint64_t t0_us;
+
+    /* Fault on the CM33 non-secure: two flashes, played twice */
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play_error(2U, 2U);
+    led_pattern_wait();
+
+    TEST_CHECK(!led_pattern_is_active());
+    test_expect(expected, CY_ARRAY_SIZE(expected), t0_us);
+
+    /* Clamped to LED_PATTERN_MAX_ERROR_CODE flashes per play */
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play_error(LED_PATTERN_MAX_ERROR_CODE + 4U, 1U);
+    led_pattern_wait();
+
+    for (uint32_t i = 0U; i < test_num_edges; i++)
+    {
+        if ((TEST_RED == test_edges[i].port) && (1U == test_edges[i].value))
+        {
+            flashes++;
+        }
+    }
+    TEST_CHECK(flashes == LED_PATTERN_MAX_ERROR_CODE);
+    TEST_CHECK_RANGE(model_time_us,
+                     t0_us + (LED_PATTERN_MAX_ERROR_CODE * 400000U) + 1000000U -
+                     TEST_TOLERANCE_US,
+                     t0_us + (LED_PATTERN_MAX_ERROR_CODE * 400000U) + 1000000U +
+                     TEST_TOLERANCE_US);
+
+    /* Forever: still flashing after a minute, until another pattern starts */
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play_error(1U, LED_PATTERN_REPEAT_FOREVER);
+    model_run_until(t0_us + 60000000U);
+    TEST_CHECK(led_pattern_is_active());
+    /* 43 plays of 1.4 s started: red on, red off, green on, and green off
+     * with the red on of the next play */
+    TEST_CHECK(test_num_edges == ((43U * 4U) - 1U));
+
+    led_pattern_play(&led_pattern_hibernate_hold);
+    led_pattern_wait();
+    TEST_CHECK(!led_pattern_is_active());
+    TEST_CHECK(0U == Cy_GPIO_ReadOut(CYBSP_LED_GREEN_PORT, CYBSP_LED_GREEN_PIN));
+}
+
+/*******************************************************************************
+* Function Name: test_dwell
+********************************************************************************
+* Summary:
+* A dwell flashes the green LED for 50 ms and ends after the requested
+* time. Dwells shorter than the flash are lengthened to just above it.
+*
+*******************************************************************************/
+static void test_dwell(void)
+{
+    static const uint32_t expected[][3] =
+    {
+        { 0U, TEST_GREEN, 1U }, { 50U, TEST_GREEN, 0U }
+    };
+    uint64_t t0_us;
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play_dwell(1500U);
+    led_pattern_wait();
+
+    test_expect(expected, CY_ARRAY_SIZE(expected), t0_us);
+    TEST_CHECK_RANGE(model_time_us, t0_us + 1500000U - TEST_TOLERANCE_US,
+                     t0_us + 1500000U + TEST_TOLERANCE_US);
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play_dwell(10U);
+    led_pattern_wait();
+
+    TEST_CHECK_RANGE(model_time_us, t0_us + 51000U - TEST_TOLERANCE_US,
+                     t0_us + 51000U + TEST_TOLERANCE_US);
+}
+
+/*******************************************************************************
+* Function Name: test_timeout
+********************************************************************************
+* Summary:
+* The timeout on counter 1 expires after the requested time from its last
+* start, does not disturb the pattern playing on counter 0, and does not
+* expire once stopped.
+*
+*******************************************************************************/
+static void test_timeout(void)
+{
+    static const uint32_t expected[][3] =
+    {
+        { 0U,    TEST_RED, 1U }, { 500U,  TEST_RED, 0U },
+        { 1000U, TEST_RED, 1U }, { 1500U, TEST_RED, 0U },
+        { 2000U, TEST_RED, 1U }
+    };
+    uint64_t t0_us;
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_play(&led_pattern_active_blink);
+    led_pattern_timeout_start(1000U);
+    model_run_until(t0_us + 900000U);
+    TEST_CHECK(!led_pattern_timeout_expired());
+
+    led_pattern_timeout_start(1000U);
+    model_run_until(t0_us + 1890000U);
+    TEST_CHECK(!led_pattern_timeout_expired());
+    model_run_until(t0_us + 1910000U);
+    TEST_CHECK(led_pattern_timeout_expired());
+
+    model_run_until(t0_us + 2200000U);
+    TEST_CHECK(led_pattern_timeout_expired());
+    test_expect(expected, CY_ARRAY_SIZE(expected), t0_us);
+    led_pattern_stop();
+
+    test_start();
+    t0_us = model_time_us;
+
+    led_pattern_timeout_start(LED_PATTERN_TIMEOUT_MAX_MS);
+    led_pattern_timeout_stop();
+    led_pattern_play_dwell(3000U);
+    led_pattern_wait();
+    TEST_CHECK(!led_pattern_timeout_expired());
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the pattern sequencing tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_active_blink();
+    test_hibernate_hold();
+    test_set_timing();
+    test_error_code();
+    test_dwell();
+    test_timeout();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,409 @@
+/*******************************************************************************
+ * File Name:   test_lpcomp_calib.c
+ *
+ * Description: This file contains the host test of lpcomp_calib.c. The fit
+ *              is checked against a simulated comparator with a per-device
+ *              offset and Gaussian input noise, the table codec against
+ *              corrupted tables, and the production test sequence against
+ *              the hardware model. The test ends with a report of the fit
+ *              accuracy vs. the sweep time.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include "lpcomp_calib.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_MAX_SAMPLES                (64U * 64U)
+#define TEST_TRIALS                     (400U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t test_samples[TEST_MAX_SAMPLES / 32U];
+
+/* Comparator of the production test model, per power mode */
+static double test_trip_rise_mv[4];
+static double test_trip_fall_mv[4];
+static double test_noise_mv;
+static uint32_t test_output;
+
+/*******************************************************************************
+* Function Name: test_sweep
+********************************************************************************
+* Summary:
+* Fills test_samples with one edge of a sweep from start_mv to end_mv, taken
+* in the middle of each sample period like calib_sweep_edge(). The sample is
+* set when the comparator with the given trip point and input noise is in
+* the new state.
+*
+*******************************************************************************/
+static void test_sweep(uint32_t num_samples, double start_mv, double end_mv,
+                       double trip_mv, double noise_mv)
+{
+    bool rising = end_mv > start_mv;
+
+    memset(test_samples, 0, sizeof(test_samples));
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        double level = start_mv + ((end_mv - start_mv) * (i + 0.5) / num_samples) +
+                       (noise_mv * model_gauss());
+
+        if (rising ? (level > trip_mv) : (level < trip_mv))
+        {
+            test_samples[i / 32U] |= 1UL << (i % 32U);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_fit
+********************************************************************************
+* Summary:
+* Runs the fit of the firmware on test_samples.
+*
+*******************************************************************************/
+static bool test_fit(uint32_t num_bins, uint16_t samples_per_bin,
+                     int16_t start_mv, int16_t end_mv, int16_t *trip_mv,
+                     uint16_t *band_mv)
+{
+    return lpcomp_calib_fit(test_samples, num_bins, samples_per_bin, start_mv,
+                            end_mv, trip_mv, band_mv);
+}
+
+/*******************************************************************************
+* Function Name: test_fit_noiseless
+********************************************************************************
+* Summary:
+* A noiseless comparator must be located to within one sample and must give
+* a noise band of 0 on both edges, wherever the trip point lies in a bin.
+*
+*******************************************************************************/
+static void test_fit_noiseless(void)
+{
+    int16_t trip;
+    uint16_t band;
+    double step = (double)(LPCOMP_CALIB_RAMP_END_MV - LPCOMP_CALIB_RAMP_START_MV) /
+                  LPCOMP_CALIB_NUM_SAMPLES;
+
+    for (double t = 100.0; t < 800.0; t += 3.7)
+    {
+        test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_START_MV,
+                   LPCOMP_CALIB_RAMP_END_MV, t, 0.0);
+        TEST_CHECK(test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                            LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                            &trip, &band));
+        TEST_CHECK_RANGE(trip - t, -step - 1.0, step + 1.0);
+        TEST_CHECK(0U == band);
+
+        test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_END_MV,
+                   LPCOMP_CALIB_RAMP_START_MV, t, 0.0);
+        TEST_CHECK(test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                            LPCOMP_CALIB_RAMP_END_MV, LPCOMP_CALIB_RAMP_START_MV,
+                            &trip, &band));
+        TEST_CHECK_RANGE(trip - t, -step - 1.0, step + 1.0);
+        TEST_CHECK(0U == band);
+    }
+
+    /* Transitions outside the ramp are rejected */
+    test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_START_MV,
+               LPCOMP_CALIB_RAMP_END_MV, 950.0, 0.0);
+    TEST_CHECK(!test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                         LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                         &trip, &band));
+    test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_START_MV,
+               LPCOMP_CALIB_RAMP_END_MV, -10.0, 0.0);
+    TEST_CHECK(!test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                         LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                         &trip, &band));
+}
+
+/*******************************************************************************
+* Function Name: test_fit_noise
+********************************************************************************
+* Summary:
+* With Gaussian input noise, the trip point must stay unbiased and the noise
+* band must follow the 10%..90% width of the noise, 2.563 sigma. Below about
+* two samples of noise, the band is no longer resolved and only has to stay
+* below the hysteresis threshold.
+*
+*******************************************************************************/
+static void test_fit_noise(void)
+{
+    static const double sigmas[] = { 2.0, 4.0, 8.0 };
+    int16_t trip;
+    uint16_t band;
+
+    for (uint32_t k = 0U; k < (sizeof(sigmas) / sizeof(sigmas[0])); k++)
+    {
+        double err_sum = 0.0;
+        double err_sq = 0.0;
+        double band_sum = 0.0;
+
+        for (uint32_t n = 0U; n < TEST_TRIALS; n++)
+        {
+            double t = 200.0 + (500.0 * model_uniform());
+
+            test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_START_MV,
+                       LPCOMP_CALIB_RAMP_END_MV, t, sigmas[k]);
+            TEST_CHECK(test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                                LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                                &trip, &band));
+            err_sum += trip - t;
+            err_sq += (trip - t) * (trip - t);
+            band_sum += band;
+        }
+
+        TEST_CHECK_RANGE(err_sum / TEST_TRIALS, -1.0, 1.0);
+        TEST_CHECK_RANGE(sqrt(err_sq / TEST_TRIALS), 0.0, 1.0 + (sigmas[k] / 2.0));
+        TEST_CHECK_RANGE(band_sum / TEST_TRIALS, 0.6 * 2.563 * sigmas[k],
+                         1.4 * 2.563 * sigmas[k]);
+    }
+
+    for (uint32_t n = 0U; n < TEST_TRIALS; n++)
+    {
+        test_sweep(LPCOMP_CALIB_NUM_SAMPLES, LPCOMP_CALIB_RAMP_START_MV,
+                   LPCOMP_CALIB_RAMP_END_MV, 200.0 + (500.0 * model_uniform()), 1.0);
+        TEST_CHECK(test_fit(LPCOMP_CALIB_NUM_BINS, LPCOMP_CALIB_SAMPLES_PER_BIN,
+                            LPCOMP_CALIB_RAMP_START_MV, LPCOMP_CALIB_RAMP_END_MV,
+                            &trip, &band));
+        TEST_CHECK(band <= LPCOMP_CALIB_HYST_THRESHOLD_MV);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_comparator
+********************************************************************************
+* Summary:
+* Comparator of the production test model. The tester starts the triangular
+* ramp when the firmware flushes the ready marker. The comparator has the
+* trip points of the current power mode, input noise, and keeps its state
+* between the two trip points.
+*
+*******************************************************************************/
+static uint32_t test_comparator(uint64_t time_us)
+{
+    double t = (double)(time_us - model_mark_us) / 1000.0;
+    double d = (double)LPCOMP_CALIB_RAMP_DURATION_MS;
+    double span = (double)(LPCOMP_CALIB_RAMP_END_MV - LPCOMP_CALIB_RAMP_START_MV);
+    double level = (t < d) ? (LPCOMP_CALIB_RAMP_START_MV + (span * t / d)) :
+                             (LPCOMP_CALIB_RAMP_END_MV - (span * (t - d) / d));
+
+    level += test_noise_mv * model_gauss();
+
+    if (level > test_trip_rise_mv[model_lpcomp_power])
+    {
+        test_output = 1U;
+    }
+    else if (level < test_trip_fall_mv[model_lpcomp_power])
+    {
+        test_output = 0U;
+    }
+
+    return test_output;
+}
+
+/*******************************************************************************
+* Function Name: test_production
+********************************************************************************
+* Summary:
+* Runs lpcomp_calib_run() against the model and checks the stored table, the
+* CRC protection, the versioning, the hysteresis decision and the power mode
+* the comparator is returned to.
+*
+*******************************************************************************/
+static void test_production(void)
+{
+    static const cy_en_lpcomp_pwr_t modes[] =
+    {
+        CY_LPCOMP_MODE_ULP, CY_LPCOMP_MODE_LP, CY_LPCOMP_MODE_NORMAL
+    };
+    lpcomp_calib_table_t *table = (lpcomp_calib_table_t *)model_rram;
+    const lpcomp_calib_entry_t *entry;
+    LPCOMP_Type lpcomp;
+    cy_stc_lpcomp_context_t context;
+
+    model_reset();
+    model_lpcomp = test_comparator;
+    test_output = 0U;
+    test_noise_mv = 0.0;
+
+    /* Uncalibrated device */
+    TEST_CHECK(NULL == lpcomp_calib_get(CY_LPCOMP_MODE_ULP));
+    TEST_CHECK(NULL == lpcomp_calib_apply(&lpcomp, CY_LPCOMP_CHANNEL_0,
+                                          CY_LPCOMP_MODE_ULP));
+
+    /* Per-mode offsets, the LP mode trips outside the tester ramp */
+    test_trip_rise_mv[CY_LPCOMP_MODE_ULP] = 472.3;
+    test_trip_fall_mv[CY_LPCOMP_MODE_ULP] = 461.8;
+    test_trip_rise_mv[CY_LPCOMP_MODE_LP] = 960.0;
+    test_trip_fall_mv[CY_LPCOMP_MODE_LP] = 955.0;
+    test_trip_rise_mv[CY_LPCOMP_MODE_NORMAL] = 431.0;
+    test_trip_fall_mv[CY_LPCOMP_MODE_NORMAL] = 428.5;
+
+    TEST_CHECK(lpcomp_calib_run(&lpcomp, CY_LPCOMP_CHANNEL_0, CY_LPCOMP_MODE_LP, &context));
+    TEST_CHECK((uint32_t)CY_LPCOMP_MODE_LP == model_lpcomp_power);
+    TEST_CHECK(0x5U == table->valid_mask);
+    TEST_CHECK(NULL == lpcomp_calib_get(CY_LPCOMP_MODE_LP));
+    TEST_CHECK(NULL == lpcomp_calib_get(CY_LPCOMP_MODE_OFF));
+
+    for (uint32_t i = 0U; i < 3U; i += 2U)
+    {
+        cy_en_lpcomp_pwr_t mode = modes[i];
+
+        entry = lpcomp_calib_get(mode);
+        TEST_CHECK(NULL != entry);
+        if (NULL != entry)
+        {
+            TEST_CHECK_RANGE(entry->trip_rise_mv - test_trip_rise_mv[mode], -1.5, 1.5);
+            TEST_CHECK_RANGE(entry->trip_fall_mv - test_trip_fall_mv[mode], -1.5, 1.5);
+            TEST_CHECK_RANGE(entry->offset_mv -
+                             (((test_trip_rise_mv[mode] + test_trip_fall_mv[mode]) / 2.0) -
+                              LPCOMP_CALIB_NOMINAL_TRIP_MV), -1.5, 1.5);
+            TEST_CHECK(entry->noise_band_mv <= LPCOMP_CALIB_HYST_THRESHOLD_MV);
+        }
+    }
+
+    /* A noiseless device runs without hysteresis */
+    model_lpcomp_hyst = (uint32_t)CY_LPCOMP_HYST_ENABLE;
+    TEST_CHECK(NULL != lpcomp_calib_apply(&lpcomp, CY_LPCOMP_CHANNEL_0,
+                                          CY_LPCOMP_MODE_ULP));
+    TEST_CHECK((uint32_t)CY_LPCOMP_HYST_DISABLE == model_lpcomp_hyst);
+
+    /* Any changed byte invalidates the table */
+    for (uint32_t i = 0U; i < sizeof(lpcomp_calib_table_t); i++)
+    {
+        model_rram[i] ^= 0x10U;
+        TEST_CHECK(NULL == lpcomp_calib_get(CY_LPCOMP_MODE_ULP));
+        model_rram[i] ^= 0x10U;
+    }
+    TEST_CHECK(NULL != lpcomp_calib_get(CY_LPCOMP_MODE_ULP));
+
+    /* Tables of another version are ignored, even with a valid CRC */
+    table->version = LPCOMP_CALIB_VERSION - 1U;
+    table->crc = lpcomp_calib_crc16(model_rram, offsetof(lpcomp_calib_table_t, crc));
+    TEST_CHECK(NULL == lpcomp_calib_get(CY_LPCOMP_MODE_ULP));
+
+    /* A noisy device without inherent hysteresis gets hysteresis */
+    model_reset();
+    model_lpcomp = test_comparator;
+    test_noise_mv = 10.0;
+    test_trip_fall_mv[CY_LPCOMP_MODE_ULP] = test_trip_rise_mv[CY_LPCOMP_MODE_ULP];
+    TEST_CHECK(lpcomp_calib_run(&lpcomp, CY_LPCOMP_CHANNEL_0, CY_LPCOMP_MODE_ULP, &context));
+    TEST_CHECK((uint32_t)CY_LPCOMP_MODE_ULP == model_lpcomp_power);
+    entry = lpcomp_calib_apply(&lpcomp, CY_LPCOMP_CHANNEL_0, CY_LPCOMP_MODE_ULP);
+    TEST_CHECK(NULL != entry);
+    if (NULL != entry)
+    {
+        TEST_CHECK(entry->noise_band_mv > LPCOMP_CALIB_HYST_THRESHOLD_MV);
+    }
+    TEST_CHECK((uint32_t)CY_LPCOMP_HYST_ENABLE == model_lpcomp_hyst);
+
+    /* Nothing is stored when no mode can be calibrated */
+    model_reset();
+    model_lpcomp = NULL;
+    TEST_CHECK(!lpcomp_calib_run(&lpcomp, CY_LPCOMP_CHANNEL_0, CY_LPCOMP_MODE_NORMAL, &context));
+    TEST_CHECK((uint32_t)CY_LPCOMP_MODE_NORMAL == model_lpcomp_power);
+    TEST_CHECK(0xFFU == model_rram[0]);
+}
+
+/*******************************************************************************
+* Function Name: test_report
+********************************************************************************
+* Summary:
+* Prints the fit accuracy vs. the sweep time. The sample period of the
+* firmware is kept and the number of samples per bin is varied.
+*
+*******************************************************************************/
+static void test_report(void)
+{
+    static const uint16_t spb[] = { 2U, 4U, 8U, 16U, 32U, 64U };
+    static const double sigmas[] = { 0.0, 2.0, 5.0 };
+    int16_t trip;
+    uint16_t band;
+
+    printf("\nFit accuracy vs. sweep time, %u bins, %u us per sample, %u trials\n",
+           (unsigned int)LPCOMP_CALIB_NUM_BINS,
+           (unsigned int)LPCOMP_CALIB_SAMPLE_PERIOD_US, (unsigned int)TEST_TRIALS);
+    printf("%-10s %-8s %-14s %-14s %-14s\n", "sweep_ms", "noise", "trip_rms_mv",
+           "trip_max_mv", "band_mean_mv");
+
+    for (uint32_t k = 0U; k < (sizeof(sigmas) / sizeof(sigmas[0])); k++)
+    {
+        for (uint32_t j = 0U; j < (sizeof(spb) / sizeof(spb[0])); j++)
+        {
+            uint32_t num_samples = LPCOMP_CALIB_NUM_BINS * spb[j];
+            double err_sq = 0.0;
+            double err_max = 0.0;
+            double band_sum = 0.0;
+
+            for (uint32_t n = 0U; n < TEST_TRIALS; n++)
+            {
+                double t = 200.0 + (500.0 * model_uniform());
+
+                test_sweep(num_samples, LPCOMP_CALIB_RAMP_START_MV,
+                           LPCOMP_CALIB_RAMP_END_MV, t, sigmas[k]);
+                TEST_CHECK(test_fit(LPCOMP_CALIB_NUM_BINS, spb[j],
+                                    LPCOMP_CALIB_RAMP_START_MV,
+                                    LPCOMP_CALIB_RAMP_END_MV, &trip, &band));
+                err_sq += (trip - t) * (trip - t);
+                err_max = fmax(err_max, fabs(trip - t));
+                band_sum += band;
+            }
+
+            printf("%-10lu %-8.1f %-14.2f %-14.2f %-14.2f\n",
+                   (unsigned long)((num_samples * LPCOMP_CALIB_SAMPLE_PERIOD_US) / 1000U),
+                   sigmas[k], sqrt(err_sq / TEST_TRIALS), err_max,
+                   band_sum / TEST_TRIALS);
+        }
+    }
+}
+
+int main(void)
+{
+    model_reset();
+    model_seed(26U);
+
+    test_fit_noiseless();
+    test_fit_noise();
+    test_production();
+    test_report();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
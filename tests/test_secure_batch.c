@@ -0,0 +1,611 @@
+/*******************************************************************************
+ * File Name:   test_secure_batch.c
+ *
+ * Description: This file contains the host test of the batched secure service
+ *              interface: the batch builder, validation and dispatcher of
+ *              secure_batch.c, and the non-secure callable functions of
+ *              secure_services.c with the CMSE address check of the model.
+ *              Random batches are checked against a reference dispatcher.
+ *              Built with TEST_SECURE_BATCH_BENCH, the test also reports the
+ *              host cost per request of one secure call per request and of
+ *              one batch, and the number of secure entries per request. The
+ *              cost of the state transitions is not modelled.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "secure_services.h"
+#include "retained_data.h"
+#include "xip_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_RANDOM_SEED                (3636U)
+#define TEST_RANDOM_BATCHES             (20000U)
+
+/* Cycles counted by test_cycles() per call */
+#define TEST_CYCLES_STEP                (10U)
+
+#define TEST_RESET_REASON               (0x00000004UL)
+#define TEST_RETAINED_VALUE             (0x5A5AA5A5UL)
+
+#if defined(TEST_SECURE_BATCH_BENCH)
+#define TEST_BENCH_REQUESTS             (4000000U)
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t test_cycle_count;
+static uint32_t test_handler_calls;
+
+/*******************************************************************************
+* Function Name: test_cycles
+********************************************************************************
+* Summary:
+* Cycle counter for the dispatcher that advances by TEST_CYCLES_STEP on
+* every read.
+*
+*******************************************************************************/
+static uint32_t test_cycles(void)
+{
+    test_cycle_count += TEST_CYCLES_STEP;
+
+    return test_cycle_count;
+}
+
+/*******************************************************************************
+* Function Name: test_svc_echo / test_svc_reject
+********************************************************************************
+* Summary:
+* Service handlers of the dispatcher tests. test_svc_echo() returns its
+* argument plus one, test_svc_reject() rejects odd arguments.
+*
+*******************************************************************************/
+static secure_status_t test_svc_echo(uint32_t arg, uint32_t *result)
+{
+    test_handler_calls++;
+    *result = arg + 1U;
+
+    return SECURE_STATUS_OK;
+}
+
+static secure_status_t test_svc_reject(uint32_t arg, uint32_t *result)
+{
+    test_handler_calls++;
+    *result = arg;
+
+    return (0U != (arg & 1U)) ? SECURE_STATUS_BAD_ARG : SECURE_STATUS_OK;
+}
+
+/* Dispatcher test table: no handler for SECURE_SVC_XIP_PROFILE */
+static const secure_service_fn_t test_services[SECURE_NUM_SVCS] =
+{
+    [SECURE_SVC_NOP]            = test_svc_echo,
+    [SECURE_SVC_RESET_REASON]   = test_svc_echo,
+    [SECURE_SVC_SMIF_STATUS]    = test_svc_reject,
+    [SECURE_SVC_XIP_PROFILE]    = NULL,
+    [SECURE_SVC_RETAINED_READ]  = test_svc_reject
+};
+
+/*******************************************************************************
+* Function Name: test_ns_batch
+********************************************************************************
+* Summary:
+* Returns an empty batch in the non-secure RAM of the model.
+*
+*******************************************************************************/
+static secure_batch_t *test_ns_batch(void)
+{
+    secure_batch_t *batch = (secure_batch_t *)model_ns_ram;
+
+    secure_batch_init(batch);
+
+    return batch;
+}
+
+/*******************************************************************************
+* Function Name: test_start
+********************************************************************************
+* Summary:
+* Resets the model and runs the secure boot part of the services.
+*
+*******************************************************************************/
+static void test_start(void)
+{
+    model_reset();
+    model_backup[RETAINED_PARAMS_WORD] = TEST_RETAINED_VALUE;
+    secure_services_init(TEST_RESET_REASON, CY_SMIF_SUCCESS);
+}
+
+/*******************************************************************************
+* Function Name: test_add
+********************************************************************************
+* Summary:
+* A batch takes SECURE_BATCH_MAX_REQUESTS requests, each one pending, and
+* rejects the next one without changing the batch.
+*
+*******************************************************************************/
+static void test_add(void)
+{
+    secure_batch_t batch;
+
+    memset(&batch, 0xEE, sizeof(batch));
+    secure_batch_init(&batch);
+    TEST_CHECK(SECURE_BATCH_MAGIC == batch.magic);
+    TEST_CHECK((0U == batch.count) && (0U == batch.cycles));
+
+    for (uint32_t i = 0U; i < SECURE_BATCH_MAX_REQUESTS; i++)
+    {
+        TEST_CHECK(SECURE_STATUS_OK == secure_batch_add(&batch, SECURE_SVC_RETAINED_READ, i));
+        TEST_CHECK(SECURE_SVC_RETAINED_READ == batch.requests[i].service);
+        TEST_CHECK(SECURE_STATUS_PENDING == batch.requests[i].status);
+        TEST_CHECK((i == batch.requests[i].arg) && (0U == batch.requests[i].result));
+    }
+
+    TEST_CHECK(SECURE_STATUS_FULL == secure_batch_add(&batch, SECURE_SVC_NOP, 0U));
+    TEST_CHECK(SECURE_BATCH_MAX_REQUESTS == batch.count);
+}
+
+/*******************************************************************************
+* Function Name: test_validate
+********************************************************************************
+* Summary:
+* Only a batch with the magic number and 1 to SECURE_BATCH_MAX_REQUESTS
+* requests is valid.
+*
+*******************************************************************************/
+static void test_validate(void)
+{
+    secure_batch_t batch;
+
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_validate(NULL));
+
+    secure_batch_init(&batch);
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_validate(&batch));
+
+    (void)secure_batch_add(&batch, SECURE_SVC_NOP, 0U);
+    TEST_CHECK(SECURE_STATUS_OK == secure_batch_validate(&batch));
+
+    batch.magic ^= 1U;
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_validate(&batch));
+    batch.magic ^= 1U;
+
+    batch.count = SECURE_BATCH_MAX_REQUESTS;
+    TEST_CHECK(SECURE_STATUS_OK == secure_batch_validate(&batch));
+    batch.count = SECURE_BATCH_MAX_REQUESTS + 1U;
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_validate(&batch));
+    batch.count = UINT32_MAX;
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_validate(&batch));
+}
+
+/*******************************************************************************
+* Function Name: test_dispatch
+********************************************************************************
+* Summary:
+* Each request gets its own status, result and cycle count. Unknown
+* services and services without a handler fail alone, with the stale result
+* cleared, and the batch cycles cover the whole dispatch.
+*
+*******************************************************************************/
+static void test_dispatch(void)
+{
+    secure_batch_t batch;
+
+    secure_batch_init(&batch);
+    (void)secure_batch_add(&batch, SECURE_SVC_NOP, 41U);
+    (void)secure_batch_add(&batch, SECURE_SVC_SMIF_STATUS, 3U);
+    (void)secure_batch_add(&batch, SECURE_SVC_XIP_PROFILE, 0U);
+    (void)secure_batch_add(&batch, (secure_svc_t)SECURE_NUM_SVCS, 0U);
+    (void)secure_batch_add(&batch, SECURE_SVC_RESET_REASON, 7U);
+    batch.requests[2].result = 0xDEADU;
+    batch.requests[3].result = 0xDEADU;
+    batch.requests[3].service = UINT16_MAX;
+
+    test_cycle_count = 0U;
+    test_handler_calls = 0U;
+    TEST_CHECK(SECURE_STATUS_OK == secure_batch_dispatch(&batch, test_services, test_cycles));
+    TEST_CHECK(3U == test_handler_calls);
+
+    TEST_CHECK(SECURE_STATUS_OK == batch.requests[0].status);
+    TEST_CHECK(42U == batch.requests[0].result);
+    TEST_CHECK(SECURE_STATUS_BAD_ARG == batch.requests[1].status);
+    TEST_CHECK(SECURE_STATUS_BAD_SERVICE == batch.requests[2].status);
+    TEST_CHECK(0U == batch.requests[2].result);
+    TEST_CHECK(SECURE_STATUS_BAD_SERVICE == batch.requests[3].status);
+    TEST_CHECK(0U == batch.requests[3].result);
+    TEST_CHECK(SECURE_STATUS_OK == batch.requests[4].status);
+    TEST_CHECK(8U == batch.requests[4].result);
+
+    /* Two reads per executed request and two for the batch */
+    TEST_CHECK(TEST_CYCLES_STEP == batch.requests[0].cycles);
+    TEST_CHECK(0U == batch.requests[2].cycles);
+    TEST_CHECK(test_cycle_count == (2U * 4U * TEST_CYCLES_STEP));
+    TEST_CHECK(batch.cycles == (test_cycle_count - TEST_CYCLES_STEP));
+}
+
+/*******************************************************************************
+* Function Name: test_dispatch_bad_batch
+********************************************************************************
+* Summary:
+* A rejected batch is left as it is and no service runs.
+*
+*******************************************************************************/
+static void test_dispatch_bad_batch(void)
+{
+    secure_batch_t batch;
+    secure_batch_t copy;
+
+    secure_batch_init(&batch);
+    (void)secure_batch_add(&batch, SECURE_SVC_NOP, 0U);
+    batch.count = SECURE_BATCH_MAX_REQUESTS + 1U;
+    memcpy(&copy, &batch, sizeof(copy));
+
+    test_handler_calls = 0U;
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_dispatch(&batch, test_services, test_cycles));
+    TEST_CHECK(0U == test_handler_calls);
+    TEST_CHECK(0 == memcmp(&batch, &copy, sizeof(copy)));
+}
+
+/*******************************************************************************
+* Function Name: test_random
+********************************************************************************
+* Summary:
+* Dispatches random batches, with corrupted headers and unknown services,
+* and checks every request against the expected outcome.
+*
+*******************************************************************************/
+static void test_random(void)
+{
+    secure_batch_t batch;
+    secure_status_t status;
+    uint32_t failures = 0U;
+    bool valid;
+
+    srand(TEST_RANDOM_SEED);
+
+    for (uint32_t n = 0U; n < TEST_RANDOM_BATCHES; n++)
+    {
+        secure_batch_init(&batch);
+        for (uint32_t i = 0U; i < SECURE_BATCH_MAX_REQUESTS; i++)
+        {
+            batch.requests[i].service = (uint16_t)((uint32_t)rand() % (SECURE_NUM_SVCS + 3U));
+            batch.requests[i].status = (uint16_t)SECURE_STATUS_PENDING;
+            batch.requests[i].arg = (uint32_t)rand();
+            batch.requests[i].result = 0xDEADU;
+        }
+        batch.count = (uint32_t)rand() % (SECURE_BATCH_MAX_REQUESTS + 2U);
+        if (0 == (rand() % 16))
+        {
+            batch.magic = (uint32_t)rand();
+        }
+        valid = (SECURE_BATCH_MAGIC == batch.magic) && (0U != batch.count) &&
+                (batch.count <= SECURE_BATCH_MAX_REQUESTS);
+
+        status = secure_batch_dispatch(&batch, test_services, test_cycles);
+        if (status != (valid ? SECURE_STATUS_OK : SECURE_STATUS_BAD_BATCH))
+        {
+            failures++;
+            continue;
+        }
+
+        for (uint32_t i = 0U; i < SECURE_BATCH_MAX_REQUESTS; i++)
+        {
+            const secure_request_t *request = &batch.requests[i];
+            secure_status_t expected = SECURE_STATUS_PENDING;
+            uint32_t result = 0xDEADU;
+
+            if (valid && (i < batch.count))
+            {
+                switch (request->service)
+                {
+                    case SECURE_SVC_NOP:
+                    case SECURE_SVC_RESET_REASON:
+                        expected = SECURE_STATUS_OK;
+                        result = request->arg + 1U;
+                        break;
+                    case SECURE_SVC_SMIF_STATUS:
+                    case SECURE_SVC_RETAINED_READ:
+                        expected = (0U != (request->arg & 1U)) ?
+                                   SECURE_STATUS_BAD_ARG : SECURE_STATUS_OK;
+                        result = request->arg;
+                        break;
+                    default:
+                        expected = SECURE_STATUS_BAD_SERVICE;
+                        result = 0U;
+                        break;
+                }
+            }
+
+            if ((expected != request->status) || (result != request->result))
+            {
+                failures++;
+            }
+        }
+    }
+
+    TEST_CHECK(0U == failures);
+}
+
+/*******************************************************************************
+* Function Name: test_batch_call
+********************************************************************************
+* Summary:
+* secure_batch_call() executes the services of the secure project on a
+* batch in non-secure memory. Only the descriptors of the batch are written
+* back.
+*
+*******************************************************************************/
+static void test_batch_call(void)
+{
+    secure_batch_t *batch;
+    secure_request_t spare;
+
+    test_start();
+    batch = test_ns_batch();
+    (void)secure_batch_add(batch, SECURE_SVC_RESET_REASON, 0U);
+    (void)secure_batch_add(batch, SECURE_SVC_SMIF_STATUS, 0U);
+    (void)secure_batch_add(batch, SECURE_SVC_XIP_PROFILE, 0U);
+    (void)secure_batch_add(batch, SECURE_SVC_RETAINED_READ, RETAINED_PARAMS_WORD);
+    (void)secure_batch_add(batch, SECURE_SVC_RETAINED_READ, RETAINED_NUM_WORDS);
+    (void)secure_batch_add(batch, (secure_svc_t)SECURE_NUM_SVCS, 0U);
+    memset(&batch->requests[batch->count], 0xEE, sizeof(spare));
+    memcpy(&spare, &batch->requests[batch->count], sizeof(spare));
+
+    TEST_CHECK(SECURE_STATUS_OK == secure_batch_call(batch));
+
+    TEST_CHECK(SECURE_STATUS_OK == batch->requests[0].status);
+    TEST_CHECK(TEST_RESET_REASON == batch->requests[0].result);
+    TEST_CHECK(SECURE_STATUS_OK == batch->requests[1].status);
+    TEST_CHECK((uint32_t)CY_SMIF_SUCCESS == batch->requests[1].result);
+    TEST_CHECK(SECURE_STATUS_OK == batch->requests[2].status);
+    TEST_CHECK(XIP_PROFILE == batch->requests[2].result);
+    TEST_CHECK(SECURE_STATUS_OK == batch->requests[3].status);
+    TEST_CHECK(TEST_RETAINED_VALUE == batch->requests[3].result);
+    TEST_CHECK(SECURE_STATUS_BAD_ARG == batch->requests[4].status);
+    TEST_CHECK(SECURE_STATUS_BAD_SERVICE == batch->requests[5].status);
+    TEST_CHECK(0 == memcmp(&batch->requests[batch->count], &spare, sizeof(spare)));
+
+    /* The secure boot enabled the cycle counter */
+    TEST_CHECK(0U != (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk));
+    TEST_CHECK(0U != (DCB->DEMCR & DCB_DEMCR_TRCENA_Msk));
+}
+
+/*******************************************************************************
+* Function Name: test_batch_call_rejected
+********************************************************************************
+* Summary:
+* Batches in secure memory, across the end of the non-secure RAM or with a
+* bad header are rejected as a whole, and a rejected non-secure batch is not
+* written.
+*
+*******************************************************************************/
+static void test_batch_call_rejected(void)
+{
+    secure_batch_t secure;
+    secure_batch_t *batch;
+    secure_batch_t copy;
+
+    test_start();
+
+    secure_batch_init(&secure);
+    (void)secure_batch_add(&secure, SECURE_SVC_NOP, 0U);
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_call(&secure));
+
+    batch = (secure_batch_t *)&model_ns_ram[MODEL_NS_RAM_SIZE - sizeof(*batch) + 4U];
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_call(batch));
+
+    batch = test_ns_batch();
+    (void)secure_batch_add(batch, SECURE_SVC_RESET_REASON, 0U);
+    batch->magic = 0U;
+    memcpy(&copy, batch, sizeof(copy));
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_call(batch));
+    TEST_CHECK(0 == memcmp(batch, &copy, sizeof(copy)));
+
+    batch = test_ns_batch();
+    TEST_CHECK(SECURE_STATUS_BAD_BATCH == secure_batch_call(batch));
+}
+
+/*******************************************************************************
+* Function Name: test_service_call
+********************************************************************************
+* Summary:
+* secure_service_call() executes one service, and writes its result only
+* to non-secure memory.
+*
+*******************************************************************************/
+static void test_service_call(void)
+{
+    uint32_t *result = (uint32_t *)model_ns_ram;
+    uint32_t secure = 0U;
+
+    test_start();
+
+    TEST_CHECK(SECURE_STATUS_OK == secure_service_call(SECURE_SVC_RESET_REASON, 0U, result));
+    TEST_CHECK(TEST_RESET_REASON == *result);
+    TEST_CHECK(SECURE_STATUS_OK == secure_service_call(SECURE_SVC_RETAINED_READ,
+                                                       RETAINED_PARAMS_WORD, result));
+    TEST_CHECK(TEST_RETAINED_VALUE == *result);
+    TEST_CHECK(SECURE_STATUS_BAD_ARG == secure_service_call(SECURE_SVC_RETAINED_READ,
+                                                            RETAINED_NUM_WORDS, result));
+    TEST_CHECK(SECURE_STATUS_BAD_SERVICE == secure_service_call(SECURE_NUM_SVCS, 0U, result));
+    TEST_CHECK(SECURE_STATUS_BAD_SERVICE == secure_service_call(UINT32_MAX, 0U, result));
+
+    TEST_CHECK(SECURE_STATUS_BAD_ARG == secure_service_call(SECURE_SVC_RESET_REASON, 0U, &secure));
+    TEST_CHECK(0U == secure);
+}
+
+/*******************************************************************************
+* Function Name: test_entries
+********************************************************************************
+* Summary:
+* Each call into the secure state checks the caller memory once, so the
+* number of checks is the number of secure entries: one per request without
+* batching, one per batch with it.
+*
+*******************************************************************************/
+static void test_entries(void)
+{
+    uint32_t *result = (uint32_t *)&model_ns_ram[MODEL_NS_RAM_SIZE - sizeof(uint32_t)];
+    secure_batch_t *batch;
+
+    test_start();
+
+    for (uint32_t i = 0U; i < SECURE_BATCH_MAX_REQUESTS; i++)
+    {
+        (void)secure_service_call(SECURE_SVC_NOP, 0U, result);
+    }
+    TEST_CHECK(SECURE_BATCH_MAX_REQUESTS == model_cmse_checks);
+
+    model_cmse_checks = 0U;
+    batch = test_ns_batch();
+    for (uint32_t i = 0U; i < SECURE_BATCH_MAX_REQUESTS; i++)
+    {
+        (void)secure_batch_add(batch, SECURE_SVC_NOP, 0U);
+    }
+    TEST_CHECK(SECURE_STATUS_OK == secure_batch_call(batch));
+    TEST_CHECK(1U == model_cmse_checks);
+}
+
+#if defined(TEST_SECURE_BATCH_BENCH)
+/*******************************************************************************
+* Function Name: test_elapsed_ns
+********************************************************************************
+* Summary:
+* Returns the nanoseconds from start to now.
+*
+*******************************************************************************/
+static uint64_t test_elapsed_ns(const struct timespec *start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return ((uint64_t)(end.tv_sec - start->tv_sec) * 1000000000U) +
+           (uint64_t)end.tv_nsec - (uint64_t)start->tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: test_batched_vs_single
+********************************************************************************
+* Summary:
+* Reports the host cost per request of 1, 2, 4 and 8 no-op requests, sent
+* with one secure call each and as one batch, as the firmware benchmark of
+* secure_client.c does, and the secure entries per request. The batch is
+* built for every call, as in the firmware.
+*
+*******************************************************************************/
+static void test_batched_vs_single(void)
+{
+    uint32_t *result = (uint32_t *)&model_ns_ram[MODEL_NS_RAM_SIZE - sizeof(uint32_t)];
+    struct timespec start;
+    secure_batch_t *batch;
+    uint64_t single_ns;
+    uint64_t batched_ns;
+    uint32_t single_entries;
+    uint32_t batched_entries;
+    uint32_t calls;
+
+    test_start();
+
+    for (uint32_t count = 1U; count <= SECURE_BATCH_MAX_REQUESTS; count *= 2U)
+    {
+        calls = TEST_BENCH_REQUESTS / count;
+
+        model_cmse_checks = 0U;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t n = 0U; n < calls; n++)
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                (void)secure_service_call(SECURE_SVC_NOP, 0U, result);
+            }
+        }
+        single_ns = test_elapsed_ns(&start);
+        single_entries = model_cmse_checks;
+
+        model_cmse_checks = 0U;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t n = 0U; n < calls; n++)
+        {
+            batch = test_ns_batch();
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                (void)secure_batch_add(batch, SECURE_SVC_NOP, 0U);
+            }
+            (void)secure_batch_call(batch);
+        }
+        batched_ns = test_elapsed_ns(&start);
+        batched_entries = model_cmse_checks;
+
+        TEST_CHECK(single_entries == (calls * count));
+        TEST_CHECK(batched_entries == calls);
+        printf("%u requests: single %5.1f ns, batched %5.1f ns per request, "
+               "secure entries per request %.3f vs %.3f\n", (unsigned int)count,
+               (double)single_ns / (double)(calls * count),
+               (double)batched_ns / (double)(calls * count),
+               (double)single_entries / (double)(calls * count),
+               (double)batched_entries / (double)(calls * count));
+    }
+}
+#endif /* defined(TEST_SECURE_BATCH_BENCH) */
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the secure batch tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_add();
+    test_validate();
+    test_dispatch();
+    test_dispatch_bad_batch();
+    test_random();
+    test_batch_call();
+    test_batch_call_rejected();
+    test_service_call();
+    test_entries();
+#if defined(TEST_SECURE_BATCH_BENCH)
+    test_batched_vs_single();
+#endif
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
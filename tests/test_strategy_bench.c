@@ -0,0 +1,477 @@
+/*******************************************************************************
+ * File Name:   test_strategy_bench.c
+ *
+ * Description: This file contains the host test of strategy_bench.c and
+ *              of the CSV trace loader in strategy_trace_csv.c. The event
+ *              accounting is checked on the built-in traces for every
+ *              strategy and parameter set, and a wake storm trace checks
+ *              that the governed strategy follows wake_governor.c: the
+ *              storm is detected at the wakeup that exceeds the budget, the
+ *              following wakeups are served from DeepSleep, and Hibernate
+ *              returns once the back-off level has decayed. Built with
+ *              TEST_STRATEGY_BENCH, it also prints the benchmark report of
+ *              the CSV traces given on the command line, or of the built-in
+ *              traces.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "test.h"
+#include "strategy_bench.h"
+#include "strategy_trace_csv.h"
+#include "wake_governor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Storm trace: TEST_STORM_PULSES pulses of TEST_PULSE_MS every
+ * TEST_STORM_PERIOD_MS from TEST_STORM_START_MS, then two pulses after a
+ * quiet period long enough for the back-off to decay */
+#define TEST_STORM_PULSES               (12U)
+#define TEST_STORM_START_MS             (10000U)
+#define TEST_STORM_PERIOD_MS            (6000U)
+#define TEST_PULSE_MS                   (600U)
+#define TEST_LATE_PULSE_MS              (250000U)
+#define TEST_LATE_PERIOD_MS             (10000U)
+#define TEST_STORM_DURATION_MS          (300000U)
+
+#define TEST_STORM_EDGES                (2U * (TEST_STORM_PULSES + 2U))
+
+/* Parameter set of the storm trace */
+#define TEST_PARAMS_CALIB_TABLE         (3U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static strategy_edge_t test_storm_edges[TEST_STORM_EDGES];
+
+static const strategy_trace_t test_storm_trace =
+{
+    "storm", test_storm_edges, TEST_STORM_EDGES, TEST_STORM_DURATION_MS
+};
+
+/*******************************************************************************
+* Function Name: test_rising_edges
+********************************************************************************
+* Summary:
+* Returns the number of rising edges of a trace.
+*
+*******************************************************************************/
+static uint32_t test_rising_edges(const strategy_trace_t *trace)
+{
+    uint32_t count = 0U;
+    uint8_t level = 0U;
+
+    for (uint32_t i = 0U; i < trace->num_edges; i++)
+    {
+        if ((0U == level) && (0U != trace->edges[i].level))
+        {
+            count++;
+        }
+        level = trace->edges[i].level;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: test_accounting
+********************************************************************************
+* Summary:
+* Checks the event accounting of every strategy on the built-in traces.
+*
+*******************************************************************************/
+static void test_accounting(void)
+{
+    strategy_result_t result;
+    strategy_result_t hibernate;
+
+    for (uint32_t t = 0U; t < STRATEGY_BENCH_NUM_TRACES; t++)
+    {
+        const strategy_trace_t *trace = &strategy_traces[t];
+
+        for (uint32_t p = 0U; p < STRATEGY_BENCH_NUM_PARAMS; p++)
+        {
+            for (uint32_t s = 0U; s < (uint32_t)STRATEGY_NUM; s++)
+            {
+                strategy_bench_simulate((strategy_id_t)s, trace,
+                                        &strategy_params[p], &result);
+
+                TEST_CHECK(test_rising_edges(trace) == result.events);
+                TEST_CHECK((result.detected + result.missed) == result.events);
+                TEST_CHECK(result.energy_nj > 0U);
+                if ((STRATEGY_DEEPSLEEP_TIMER == s) || (STRATEGY_INTERRUPT == s))
+                {
+                    TEST_CHECK(0U == result.resets);
+                }
+                if (STRATEGY_HIBERNATE_GOVERNED != s)
+                {
+                    TEST_CHECK((0U == result.absorbed) && (0U == result.storms));
+                }
+            }
+
+            /* Without a storm, the governor does not change anything */
+            strategy_bench_simulate(STRATEGY_HIBERNATE, trace,
+                                    &strategy_params[p], &hibernate);
+            strategy_bench_simulate(STRATEGY_HIBERNATE_GOVERNED, trace,
+                                    &strategy_params[p], &result);
+            if (0U == result.storms)
+            {
+                TEST_CHECK(hibernate.energy_nj == result.energy_nj);
+                TEST_CHECK(hibernate.resets == result.resets);
+                TEST_CHECK(0U == result.absorbed);
+            }
+        }
+    }
+
+    /* The sparse trace stays within the budget, the chatter trace does not */
+    strategy_bench_simulate(STRATEGY_HIBERNATE_GOVERNED, &strategy_traces[0],
+                            &strategy_params[0], &result);
+    TEST_CHECK(0U == result.storms);
+    strategy_bench_simulate(STRATEGY_HIBERNATE_GOVERNED, &strategy_traces[1],
+                            &strategy_params[0], &result);
+    TEST_CHECK(0U != result.storms);
+}
+
+/*******************************************************************************
+* Function Name: test_polled
+********************************************************************************
+* Summary:
+* The polled strategy is the original loop: it reacts and hibernates like
+* the hibernate strategy, but waits with the CPU active while it blinks the
+* LED and during the LED hold, so it costs more energy on every trace.
+*
+*******************************************************************************/
+static void test_polled(void)
+{
+    strategy_result_t polled;
+    strategy_result_t hibernate;
+
+    for (uint32_t t = 0U; t < STRATEGY_BENCH_NUM_TRACES; t++)
+    {
+        for (uint32_t p = 0U; p < STRATEGY_BENCH_NUM_PARAMS; p++)
+        {
+            strategy_bench_simulate(STRATEGY_POLLED, &strategy_traces[t],
+                                    &strategy_params[p], &polled);
+            strategy_bench_simulate(STRATEGY_HIBERNATE, &strategy_traces[t],
+                                    &strategy_params[p], &hibernate);
+
+            TEST_CHECK(polled.resets == hibernate.resets);
+            TEST_CHECK(polled.detected == hibernate.detected);
+            TEST_CHECK(polled.latency_sum_ms == hibernate.latency_sum_ms);
+            TEST_CHECK(polled.energy_nj > hibernate.energy_nj);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_params
+********************************************************************************
+* Summary:
+* The first parameter set is the baseline, and each of the others only
+* lowers costs of the wake path, so none of them may cost more energy than
+* the baseline with the Hibernate strategies.
+*
+*******************************************************************************/
+static void test_params(void)
+{
+    const strategy_params_t *base = &strategy_params[0];
+    strategy_result_t baseline;
+    strategy_result_t result;
+
+    TEST_CHECK(0 == strcmp("baseline", base->name));
+
+    for (uint32_t p = 1U; p < STRATEGY_BENCH_NUM_PARAMS; p++)
+    {
+        const strategy_params_t *params = &strategy_params[p];
+
+        TEST_CHECK(params->active_uw <= base->active_uw);
+        TEST_CHECK(params->deepsleep_uw <= base->deepsleep_uw);
+        TEST_CHECK(params->wake_nj <= base->wake_nj);
+        TEST_CHECK((params->boot_ms + params->calib_ms) < (base->boot_ms + base->calib_ms) ||
+                   (params->active_uw < base->active_uw));
+        TEST_CHECK((params->toggle_ms == base->toggle_ms) &&
+                   (params->hold_ms == base->hold_ms) &&
+                   (params->hibernate_uw == base->hibernate_uw) &&
+                   (params->led_uw == base->led_uw));
+
+        for (uint32_t t = 0U; t < STRATEGY_BENCH_NUM_TRACES; t++)
+        {
+            strategy_bench_simulate(STRATEGY_HIBERNATE, &strategy_traces[t], base, &baseline);
+            strategy_bench_simulate(STRATEGY_HIBERNATE, &strategy_traces[t], params, &result);
+            TEST_CHECK(result.energy_nj < baseline.energy_nj);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_csv_load
+********************************************************************************
+* Summary:
+* Loads CSV text with strategy_csv_read() through a temporary file.
+*
+*******************************************************************************/
+static strategy_csv_status_t test_csv_load(const char *text, strategy_trace_t *trace,
+                                           uint32_t *line)
+{
+    strategy_csv_status_t status = STRATEGY_CSV_IO;
+    FILE *file = tmpfile();
+
+    if (NULL != file)
+    {
+        fputs(text, file);
+        rewind(file);
+        status = strategy_csv_read(file, "csv", trace, line);
+        fclose(file);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: test_csv
+********************************************************************************
+* Summary:
+* Checks the CSV trace loader: header, comments, merged rows, the trace end,
+* and the rejected files. A loaded trace replays like the same built-in one.
+*
+*******************************************************************************/
+static void test_csv(void)
+{
+    static const strategy_edge_t expected[] =
+    {
+        { 1000U, 1U }, { 1500U, 0U }, { 4000U, 1U }, { 9000U, 0U }
+    };
+    static const strategy_trace_t reference =
+    {
+        "reference", expected, 4U, 12000U
+    };
+    strategy_trace_t trace;
+    strategy_result_t loaded;
+    strategy_result_t built_in;
+    uint32_t line;
+
+    TEST_CHECK(STRATEGY_CSV_OK == test_csv_load(
+        "time_ms,level\n"
+        "# capture of the comparator output\n"
+        "0,0\n"
+        "1000,1\n"
+        "1200, 1\n"
+        "1500,0\r\n"
+        "\n"
+        "4000,1\n"
+        "9000,0\n"
+        "12000,0\n", &trace, &line));
+    TEST_CHECK(10U == line);
+    TEST_CHECK(4U == trace.num_edges);
+    TEST_CHECK(12000U == trace.duration_ms);
+    TEST_CHECK(0 == strcmp("csv", trace.name));
+    if (4U == trace.num_edges)
+    {
+        for (uint32_t i = 0U; i < trace.num_edges; i++)
+        {
+            TEST_CHECK((expected[i].time_ms == trace.edges[i].time_ms) &&
+                       (expected[i].level == trace.edges[i].level));
+        }
+
+        for (uint32_t s = 0U; s < (uint32_t)STRATEGY_NUM; s++)
+        {
+            strategy_bench_simulate((strategy_id_t)s, &trace, &strategy_params[0], &loaded);
+            strategy_bench_simulate((strategy_id_t)s, &reference, &strategy_params[0],
+                                    &built_in);
+            TEST_CHECK(0 == memcmp(&loaded, &built_in, sizeof(loaded)));
+        }
+    }
+    strategy_csv_free(&trace);
+    TEST_CHECK((NULL == trace.edges) && (0U == trace.num_edges));
+
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("0,0\n100;1\n", &trace, &line));
+    TEST_CHECK(2U == line);
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("0,0\n100,2\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("0,0\n100,1,5\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("time,level\nms,x\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("0,0\n-5,1\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_SYNTAX == test_csv_load("4294967296,1\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_ORDER == test_csv_load("0,0\n200,1\n100,0\n", &trace, &line));
+    TEST_CHECK(3U == line);
+    TEST_CHECK(STRATEGY_CSV_EMPTY == test_csv_load("time_ms,level\n", &trace, &line));
+    TEST_CHECK(STRATEGY_CSV_EMPTY == test_csv_load("0,1\n", &trace, &line));
+    TEST_CHECK(0 == strcmp("time goes backwards",
+                           strategy_csv_status_name(STRATEGY_CSV_ORDER)));
+}
+
+/*******************************************************************************
+* Function Name: test_storm
+********************************************************************************
+* Summary:
+* Replays the storm trace and checks the wakeups against the governor rules.
+* All wakeups until the one at TEST_LATE_PULSE_MS fall into two windows: the
+* first one has the storm, and the second one stays within the budget but
+* does not lower the back-off level, because the storm window does not count
+* as quiet. The quiet period before TEST_LATE_PULSE_MS ends the back-off, so
+* the last pulse wakes the device from Hibernate again.
+*
+*******************************************************************************/
+static void test_storm(void)
+{
+    const strategy_params_t *params = &strategy_params[TEST_PARAMS_CALIB_TABLE];
+    strategy_result_t hibernate;
+    strategy_result_t governed;
+    uint32_t storm_window_wakes;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_STORM_PULSES; i++)
+    {
+        test_storm_edges[2U * i].time_ms = TEST_STORM_START_MS + (i * TEST_STORM_PERIOD_MS);
+        test_storm_edges[2U * i].level = 1U;
+        test_storm_edges[(2U * i) + 1U].time_ms = test_storm_edges[2U * i].time_ms + TEST_PULSE_MS;
+        test_storm_edges[(2U * i) + 1U].level = 0U;
+    }
+    for (uint32_t k = 0U; k < 2U; k++, i++)
+    {
+        test_storm_edges[2U * i].time_ms = TEST_LATE_PULSE_MS + (k * TEST_LATE_PERIOD_MS);
+        test_storm_edges[2U * i].level = 1U;
+        test_storm_edges[(2U * i) + 1U].time_ms = test_storm_edges[2U * i].time_ms + TEST_PULSE_MS;
+        test_storm_edges[(2U * i) + 1U].level = 0U;
+    }
+
+    /* Each pulse outlasts the boot, which needs the stored calibration */
+    TEST_CHECK(0 == strcmp("calib_table", params->name));
+    TEST_CHECK(TEST_PULSE_MS > (params->boot_ms + params->calib_ms));
+
+    /* The period leaves room for the pulse, the LED toggle that sees the
+     * input LOW, the hold and the first dwell, so no pulse arrives while the
+     * governed model is busy */
+    TEST_CHECK(TEST_STORM_PERIOD_MS > (TEST_PULSE_MS + params->toggle_ms +
+                                       params->hold_ms + WAKE_GOVERNOR_DWELL_BASE_MS));
+
+    strategy_bench_simulate(STRATEGY_HIBERNATE, &test_storm_trace, params, &hibernate);
+    strategy_bench_simulate(STRATEGY_HIBERNATE_GOVERNED, &test_storm_trace, params, &governed);
+
+    TEST_CHECK((TEST_STORM_PULSES + 2U) == hibernate.events);
+    TEST_CHECK((TEST_STORM_PULSES + 2U) == hibernate.resets);
+    TEST_CHECK(0U == hibernate.missed);
+
+    storm_window_wakes = ((WAKE_GOVERNOR_WINDOW_S * 1000U) - TEST_STORM_START_MS +
+                          TEST_STORM_PERIOD_MS - 1U) / TEST_STORM_PERIOD_MS;
+    TEST_CHECK(storm_window_wakes > (WAKE_GOVERNOR_BUDGET + 1U));
+
+    TEST_CHECK((TEST_STORM_PULSES + 2U) == governed.events);
+    TEST_CHECK(0U == governed.missed);
+    TEST_CHECK(1U == governed.storms);
+    TEST_CHECK((WAKE_GOVERNOR_BUDGET + 1U + 1U) == governed.resets);
+    TEST_CHECK((TEST_STORM_PULSES - (WAKE_GOVERNOR_BUDGET + 1U) + 1U) == governed.absorbed);
+    TEST_CHECK(governed.energy_nj < hibernate.energy_nj);
+
+    printf("Storm trace: hibernate %lu uJ, %lu resets; governed %lu uJ, "
+           "%lu resets, %lu absorbed\n",
+           (unsigned long)(hibernate.energy_nj / 1000U), (unsigned long)hibernate.resets,
+           (unsigned long)(governed.energy_nj / 1000U), (unsigned long)governed.resets,
+           (unsigned long)governed.absorbed);
+}
+
+#if defined(TEST_STRATEGY_BENCH)
+/*******************************************************************************
+* Function Name: test_report_csv
+********************************************************************************
+* Summary:
+* Prints the benchmark report of a trace loaded from a CSV file.
+*
+*******************************************************************************/
+static bool test_report_csv(const char *path)
+{
+    strategy_trace_t trace;
+    strategy_csv_status_t status;
+    uint32_t line;
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file)
+    {
+        perror(path);
+        return false;
+    }
+
+    status = strategy_csv_read(file, path, &trace, &line);
+    fclose(file);
+    if (STRATEGY_CSV_OK != status)
+    {
+        printf("%s:%lu: %s\n", path, (unsigned long)line,
+               strategy_csv_status_name(status));
+        return false;
+    }
+
+    strategy_bench_report(&trace);
+    strategy_csv_free(&trace);
+
+    return true;
+}
+#endif /* defined(TEST_STRATEGY_BENCH) */
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the strategy model tests. The benchmark build then prints the report
+* of the CSV traces given on the command line, or of the built-in traces.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    test_accounting();
+    test_polled();
+    test_params();
+    test_csv();
+    test_storm();
+
+#if defined(TEST_STRATEGY_BENCH)
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            TEST_CHECK(test_report_csv(argv[i]));
+        }
+        printf("\n");
+    }
+    else
+    {
+        strategy_bench_run();
+    }
+#else
+    (void)argc;
+    (void)argv;
+#endif
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,488 @@
+/*******************************************************************************
+ * File Name:   test_telemetry.c
+ *
+ * Description: This file contains the host test of telemetry.c and of the
+ *              host reader in telemetry_reader.c. After checks of the block
+ *              layout, the header and the reader errors, one writer thread
+ *              per core updates its section with telemetry_begin() and
+ *              telemetry_end() while reader threads take snapshots with
+ *              telemetry_read() and telemetry_reader_snapshot(). Every
+ *              snapshot taken must be consistent. Built with
+ *              TEST_TELEMETRY_BENCH, the test runs longer and reports the
+ *              read and update cost.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "test.h"
+#include "telemetry.h"
+#include "telemetry_reader.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(TEST_TELEMETRY_BENCH)
+#define TEST_UPDATES                    (20000000U)
+#else
+#define TEST_UPDATES                    (500000U)
+#endif
+
+#define TEST_READERS                    (2U)
+#define TEST_READER_RETRIES             (64U)
+#define TEST_TIMED_READS                (1000000U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Snapshot counts of one reader thread */
+typedef struct
+{
+    telemetry_core_t core;
+    bool use_library;               /* telemetry_reader_snapshot() */
+    uint64_t ok;
+    uint64_t busy;
+    uint64_t torn;
+    uint32_t last;                  /* Highest update seen */
+    uint64_t backwards;             /* Snapshots older than an earlier one */
+} test_reader_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static telemetry_block_t * const test_block = (telemetry_block_t *)MODEL_SHARED_ADDR;
+static volatile bool test_writers_done;
+
+/*******************************************************************************
+* Function Name: test_fill / test_consistent
+********************************************************************************
+* Summary:
+* Writes every field of a section from an update number n, field by field,
+* and checks that a snapshot holds the fields of a single update.
+*
+*******************************************************************************/
+static void test_fill(telemetry_section_t *section, uint32_t n)
+{
+    section->boot_time_us = n;
+    section->last_wake = n % 5U;
+    section->deepsleep_wakes = n * 3U;
+    section->sleep_entries = n * 5U;
+    section->storms = n ^ 0x5A5AU;
+    section->absorbed = ~n;
+    section->idle_hint_ms = n + 7U;
+    section->idle_state = n & 3U;
+    section->off_request = n & 1U;
+    for (uint32_t i = 0U; i < TELEMETRY_HIST_BINS; i++)
+    {
+        section->active_hist[i] = n + i;
+    }
+}
+
+static bool test_consistent(const telemetry_section_t *section)
+{
+    uint32_t n = section->boot_time_us;
+    bool ok = (section->last_wake == (n % 5U)) &&
+              (section->deepsleep_wakes == (n * 3U)) &&
+              (section->sleep_entries == (n * 5U)) &&
+              (section->storms == (n ^ 0x5A5AU)) &&
+              (section->absorbed == ~n) &&
+              (section->idle_hint_ms == (n + 7U)) &&
+              (section->idle_state == (n & 3U)) &&
+              (section->off_request == (n & 1U)) &&
+              (section->seq == (2U * n));
+
+    for (uint32_t i = 0U; i < TELEMETRY_HIST_BINS; i++)
+    {
+        ok = ok && (section->active_hist[i] == (n + i));
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: test_now_ns
+********************************************************************************
+* Summary:
+* Returns the monotonic clock in nanoseconds.
+*
+*******************************************************************************/
+static uint64_t test_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: test_layout
+********************************************************************************
+* Summary:
+* Each section starts on a cache line and fills whole lines, so the CM55
+* cache maintenance of its own section never covers the CM33 section.
+*
+*******************************************************************************/
+static void test_layout(void)
+{
+    TEST_CHECK(0U == (offsetof(telemetry_block_t, core) % TELEMETRY_CACHE_LINE));
+    TEST_CHECK(0U == (sizeof(telemetry_section_t) % TELEMETRY_CACHE_LINE));
+    TEST_CHECK(0U == (offsetof(telemetry_block_t, core[1]) % TELEMETRY_CACHE_LINE));
+    TEST_CHECK((offsetof(telemetry_block_t, core[0].active_hist) +
+                sizeof(test_block->core[0].active_hist)) <=
+               offsetof(telemetry_block_t, core[1]));
+    TEST_CHECK(sizeof(telemetry_block_t) <= MODEL_SHARED_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: test_single
+********************************************************************************
+* Summary:
+* Header, sequence counter, histogram bins and the snapshot results of both
+* readers without a concurrent writer.
+*
+*******************************************************************************/
+static void test_single(void)
+{
+    telemetry_reader_t reader = { telemetry_reader_memory, test_block, 4U };
+    telemetry_section_t snapshot;
+    telemetry_section_t *section;
+    FILE *dump;
+    char text[1024] = { 0 };
+
+    model_reset();
+    telemetry_init(TELEMETRY_CORE_CM33);
+    TEST_CHECK(TELEMETRY_MAGIC == test_block->magic);
+    TEST_CHECK(TELEMETRY_VERSION == test_block->version);
+    TEST_CHECK(sizeof(telemetry_block_t) == test_block->size);
+    TEST_CHECK(0U == test_block->core[TELEMETRY_CORE_CM55].seq);
+
+    /* The CM55 clears its own section only */
+    section = telemetry_begin(TELEMETRY_CORE_CM33);
+    TEST_CHECK(1U == section->seq);
+    test_fill(section, 1U);
+    telemetry_end(TELEMETRY_CORE_CM33);
+    telemetry_init(TELEMETRY_CORE_CM55);
+    TEST_CHECK(2U == test_block->core[TELEMETRY_CORE_CM33].seq);
+    TEST_CHECK(telemetry_read(test_block, TELEMETRY_CORE_CM33, &snapshot));
+    TEST_CHECK(test_consistent(&snapshot));
+    TEST_CHECK(TELEMETRY_READER_OK ==
+               telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM33, &snapshot));
+    TEST_CHECK(test_consistent(&snapshot));
+
+    /* Log2 bins, clamped to the last one */
+    section = telemetry_begin(TELEMETRY_CORE_CM55);
+    telemetry_hist_add(section, 0U);
+    telemetry_hist_add(section, 1U);
+    telemetry_hist_add(section, 3U);
+    telemetry_hist_add(section, 1000U);
+    telemetry_hist_add(section, 0xFFFFFFFFU);
+    telemetry_end(TELEMETRY_CORE_CM55);
+    TEST_CHECK(2U == test_block->core[TELEMETRY_CORE_CM55].active_hist[0]);
+    TEST_CHECK(1U == test_block->core[TELEMETRY_CORE_CM55].active_hist[1]);
+    TEST_CHECK(1U == test_block->core[TELEMETRY_CORE_CM55].active_hist[9]);
+    TEST_CHECK(1U == test_block->core[TELEMETRY_CORE_CM55].active_hist[
+                                                    TELEMETRY_HIST_BINS - 1U]);
+
+    /* A writer that stopped in the middle of an update */
+    (void)telemetry_begin(TELEMETRY_CORE_CM55);
+    TEST_CHECK(!telemetry_read(test_block, TELEMETRY_CORE_CM55, &snapshot));
+    TEST_CHECK(TELEMETRY_READER_BUSY ==
+               telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM55, &snapshot));
+    telemetry_end(TELEMETRY_CORE_CM55);
+    TEST_CHECK(TELEMETRY_READER_OK ==
+               telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM55, &snapshot));
+
+    /* A memory dump, and a dump cut short */
+    dump = tmpfile();
+    TEST_CHECK(NULL != dump);
+    if (NULL != dump)
+    {
+        reader.read = telemetry_reader_file;
+        reader.context = dump;
+        fwrite(test_block, sizeof(*test_block), 1U, dump);
+        TEST_CHECK(TELEMETRY_READER_OK ==
+                   telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM33, &snapshot));
+        TEST_CHECK(test_consistent(&snapshot));
+        TEST_CHECK(0 == fflush(dump));
+        TEST_CHECK(0 == ftruncate(fileno(dump), 64));
+        TEST_CHECK(TELEMETRY_READER_IO ==
+                   telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM55, &snapshot));
+        fclose(dump);
+    }
+
+    /* Printed form */
+    dump = fmemopen(text, sizeof(text) - 1U, "w");
+    TEST_CHECK(NULL != dump);
+    if (NULL != dump)
+    {
+        (void)telemetry_read(test_block, TELEMETRY_CORE_CM33, &snapshot);
+        telemetry_reader_print(dump, TELEMETRY_CORE_CM33, &snapshot);
+        fclose(dump);
+        TEST_CHECK(NULL != strstr(text, "core cm33\n"));
+        TEST_CHECK(NULL != strstr(text, "last_wake hibernate\n"));
+        TEST_CHECK(NULL != strstr(text, "active_hist 1 2 3 "));
+    }
+
+    /* Header errors */
+    reader.read = telemetry_reader_memory;
+    reader.context = test_block;
+    test_block->version = TELEMETRY_VERSION - 1U;
+    TEST_CHECK(!telemetry_read(test_block, TELEMETRY_CORE_CM33, &snapshot));
+    TEST_CHECK(TELEMETRY_READER_VERSION ==
+               telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM33, &snapshot));
+    test_block->magic = 0U;
+    TEST_CHECK(!telemetry_read(test_block, TELEMETRY_CORE_CM33, &snapshot));
+    TEST_CHECK(TELEMETRY_READER_NO_BLOCK ==
+               telemetry_reader_snapshot(&reader, TELEMETRY_CORE_CM33, &snapshot));
+    TEST_CHECK(0 == strcmp("no_block",
+                           telemetry_reader_status_name(TELEMETRY_READER_NO_BLOCK)));
+}
+
+/*******************************************************************************
+* Function Name: test_writer_thread / test_reader_thread
+********************************************************************************
+* Summary:
+* The writer updates one section up to update TEST_UPDATES. The reader takes
+* snapshots of one section until the writers are done and counts the
+* consistent, busy and torn ones.
+*
+*******************************************************************************/
+static void *test_writer_thread(void *arg)
+{
+    telemetry_core_t core = *(const telemetry_core_t *)arg;
+
+    for (uint32_t n = 2U; n <= TEST_UPDATES; n++)
+    {
+        test_fill(telemetry_begin(core), n);
+        telemetry_end(core);
+
+        /* Idle for a varying time, so that readers start their copies both
+         * between and during updates */
+        for (volatile uint32_t i = 0U; i < ((n * 7U) % 128U); i++)
+        {
+        }
+    }
+
+    return NULL;
+}
+
+static void *test_reader_thread(void *arg)
+{
+    test_reader_t *reader = (test_reader_t *)arg;
+    telemetry_reader_t access =
+    {
+        telemetry_reader_memory, test_block, TEST_READER_RETRIES
+    };
+    telemetry_section_t snapshot;
+    bool ok;
+
+    while (!test_writers_done)
+    {
+        if (reader->use_library)
+        {
+            ok = (TELEMETRY_READER_OK ==
+                  telemetry_reader_snapshot(&access, reader->core, &snapshot));
+        }
+        else
+        {
+            ok = telemetry_read(test_block, reader->core, &snapshot);
+        }
+
+        if (!ok)
+        {
+            reader->busy++;
+        }
+        else if (!test_consistent(&snapshot))
+        {
+            reader->torn++;
+        }
+        else
+        {
+            reader->ok++;
+            if (snapshot.boot_time_us < reader->last)
+            {
+                reader->backwards++;
+            }
+            reader->last = snapshot.boot_time_us;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: test_torture
+********************************************************************************
+* Summary:
+* Runs one writer per core and TEST_READERS readers per core and per reader
+* implementation concurrently, then checks that no torn or out-of-order
+* snapshot was returned.
+*
+*******************************************************************************/
+static void test_torture(void)
+{
+    static const telemetry_core_t cores[TELEMETRY_NUM_CORES] =
+    {
+        TELEMETRY_CORE_CM33, TELEMETRY_CORE_CM55
+    };
+    pthread_t writers[TELEMETRY_NUM_CORES];
+    pthread_t readers[TELEMETRY_NUM_CORES * 2U * TEST_READERS];
+    test_reader_t counts[TELEMETRY_NUM_CORES * 2U * TEST_READERS];
+    uint64_t start_ns;
+    uint64_t elapsed_ns;
+
+    model_reset();
+    telemetry_init(TELEMETRY_CORE_CM33);
+    telemetry_init(TELEMETRY_CORE_CM55);
+    test_writers_done = false;
+
+    /* Update 1 of both sections, so that every snapshot has a value */
+    for (uint32_t i = 0U; i < TELEMETRY_NUM_CORES; i++)
+    {
+        test_fill(telemetry_begin(cores[i]), 1U);
+        telemetry_end(cores[i]);
+    }
+
+    memset(counts, 0, sizeof(counts));
+    for (uint32_t i = 0U; i < CY_ARRAY_SIZE(counts); i++)
+    {
+        counts[i].core = cores[i % TELEMETRY_NUM_CORES];
+        counts[i].use_library = (0U != ((i / TELEMETRY_NUM_CORES) & 1U));
+        TEST_CHECK(0 == pthread_create(&readers[i], NULL, test_reader_thread,
+                                       &counts[i]));
+    }
+
+    start_ns = test_now_ns();
+    for (uint32_t i = 0U; i < TELEMETRY_NUM_CORES; i++)
+    {
+        TEST_CHECK(0 == pthread_create(&writers[i], NULL, test_writer_thread,
+                                       (void *)&cores[i]));
+    }
+    for (uint32_t i = 0U; i < TELEMETRY_NUM_CORES; i++)
+    {
+        pthread_join(writers[i], NULL);
+    }
+    elapsed_ns = test_now_ns() - start_ns;
+
+    test_writers_done = true;
+    for (uint32_t i = 0U; i < CY_ARRAY_SIZE(counts); i++)
+    {
+        pthread_join(readers[i], NULL);
+    }
+
+    printf("\nSeqlock torture, %u updates per core, %.1f ns per update and idle gap\n",
+           (unsigned int)TEST_UPDATES, (double)elapsed_ns / TEST_UPDATES);
+    printf("%-6s %-16s %-12s %-12s %-6s\n", "core", "reader", "ok", "busy", "torn");
+    for (uint32_t i = 0U; i < CY_ARRAY_SIZE(counts); i++)
+    {
+        printf("%-6s %-16s %-12llu %-12llu %-6llu\n",
+               (TELEMETRY_CORE_CM33 == counts[i].core) ? "cm33" : "cm55",
+               counts[i].use_library ? "reader_library" : "telemetry_read",
+               (unsigned long long)counts[i].ok,
+               (unsigned long long)counts[i].busy,
+               (unsigned long long)counts[i].torn);
+
+        TEST_CHECK(0U == counts[i].torn);
+        TEST_CHECK(0U == counts[i].backwards);
+    }
+
+    /* The final state is readable by both readers */
+    for (uint32_t i = 0U; i < TELEMETRY_NUM_CORES; i++)
+    {
+        telemetry_section_t snapshot;
+
+        TEST_CHECK(telemetry_read(test_block, cores[i], &snapshot));
+        TEST_CHECK(test_consistent(&snapshot));
+        TEST_CHECK(TEST_UPDATES == snapshot.boot_time_us);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_read_cost
+********************************************************************************
+* Summary:
+* Reports the cost of a snapshot with both readers while no writer runs.
+*
+*******************************************************************************/
+static void test_read_cost(void)
+{
+    telemetry_reader_t access = { telemetry_reader_memory, test_block, 4U };
+    telemetry_section_t snapshot;
+    uint64_t start_ns;
+    double read_ns;
+    double library_ns;
+    uint32_t ok = 0U;
+
+    start_ns = test_now_ns();
+    for (uint32_t i = 0U; i < TEST_TIMED_READS; i++)
+    {
+        ok += telemetry_read(test_block, TELEMETRY_CORE_CM33, &snapshot) ? 1U : 0U;
+    }
+    read_ns = (double)(test_now_ns() - start_ns) / TEST_TIMED_READS;
+
+    start_ns = test_now_ns();
+    for (uint32_t i = 0U; i < TEST_TIMED_READS; i++)
+    {
+        ok += (TELEMETRY_READER_OK ==
+               telemetry_reader_snapshot(&access, TELEMETRY_CORE_CM33, &snapshot)) ?
+              1U : 0U;
+    }
+    library_ns = (double)(test_now_ns() - start_ns) / TEST_TIMED_READS;
+
+    TEST_CHECK((2U * TEST_TIMED_READS) == ok);
+    printf("Uncontended snapshot: telemetry_read %.1f ns, reader_library %.1f ns\n",
+           read_ns, library_ns);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the telemetry tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_layout();
+    test_single();
+    test_torture();
+    test_read_cost();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
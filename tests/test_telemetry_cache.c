@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * File Name:   test_telemetry_cache.c
+ *
+ * Description: This file contains the host test of the data cache
+ *              maintenance in telemetry.c. The CM55 writes its section
+ *              through the data cache model of pdl_model.c, which writes
+ *              lines back to memory only on clean operations, DSBs and
+ *              random evictions. After every line write-back, the section
+ *              in memory is checked the way the CM33 sees it: an even
+ *              sequence counter must come with the fields of a single
+ *              update, and telemetry_read() must never accept a torn
+ *              snapshot.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "test.h"
+#include "telemetry.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_RANDOM_SEED                (2929U)
+#define TEST_UPDATES                    (200000U)
+#define TEST_MAX_WRITE_BACKS            (16U)
+
+/* Cache lines of the CM55 section */
+#define TEST_FIRST_LINE                 ((uint32_t)(offsetof(telemetry_block_t, \
+                                            core[TELEMETRY_CORE_CM55]) / MODEL_DCACHE_LINE))
+#define TEST_SECTION_LINES              ((uint32_t)(sizeof(telemetry_section_t) / \
+                                            MODEL_DCACHE_LINE))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* The reader's view of memory. The writer's view is the cache. */
+static const telemetry_block_t * const test_memory = (telemetry_block_t *)MODEL_SHARED_ADDR;
+
+static uint32_t test_write_backs[TEST_MAX_WRITE_BACKS];
+static uint32_t test_num_write_backs;
+static uint32_t test_torn;
+static uint32_t test_accepted;
+
+/*******************************************************************************
+* Function Name: test_fill / test_consistent
+********************************************************************************
+* Summary:
+* Writes every field of a section from an update number n and checks that a
+* section holds the fields of a single update, as in test_telemetry.c.
+*
+*******************************************************************************/
+static void test_fill(telemetry_section_t *section, uint32_t n)
+{
+    section->boot_time_us = n;
+    section->last_wake = n % 5U;
+    section->deepsleep_wakes = n * 3U;
+    section->sleep_entries = n * 5U;
+    section->storms = n ^ 0x5A5AU;
+    section->absorbed = ~n;
+    section->idle_hint_ms = n + 7U;
+    section->idle_state = n & 3U;
+    section->off_request = n & 1U;
+    for (uint32_t i = 0U; i < TELEMETRY_HIST_BINS; i++)
+    {
+        section->active_hist[i] = n + i;
+    }
+}
+
+static bool test_consistent(const telemetry_section_t *section)
+{
+    uint32_t n = section->boot_time_us;
+    bool ok = (section->last_wake == (n % 5U)) &&
+              (section->deepsleep_wakes == (n * 3U)) &&
+              (section->sleep_entries == (n * 5U)) &&
+              (section->storms == (n ^ 0x5A5AU)) &&
+              (section->absorbed == ~n) &&
+              (section->idle_hint_ms == (n + 7U)) &&
+              (section->idle_state == (n & 3U)) &&
+              (section->off_request == (n & 1U)) &&
+              (section->seq == (2U * n));
+
+    for (uint32_t i = 0U; i < TELEMETRY_HIST_BINS; i++)
+    {
+        ok = ok && (section->active_hist[i] == (n + i));
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: test_write_back
+********************************************************************************
+* Summary:
+* Data cache hook. Records the line and checks the CM55 section in memory
+* as the CM33 reader sees it at this instant.
+*
+*******************************************************************************/
+static void test_write_back(uint32_t line)
+{
+    const telemetry_section_t *section = &test_memory->core[TELEMETRY_CORE_CM55];
+    telemetry_section_t snapshot;
+
+    if (test_num_write_backs < TEST_MAX_WRITE_BACKS)
+    {
+        test_write_backs[test_num_write_backs] = line;
+    }
+    test_num_write_backs++;
+
+    if ((0U == (section->seq & 1U)) && !test_consistent(section))
+    {
+        test_torn++;
+    }
+
+    if (telemetry_read(test_memory, TELEMETRY_CORE_CM55, &snapshot))
+    {
+        test_accepted++;
+        if (!test_consistent(&snapshot))
+        {
+            test_torn++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_init
+********************************************************************************
+* Summary:
+* Writes the block header as the CM33 does, directly to memory, and clears
+* the CM55 section through the cache.
+*
+*******************************************************************************/
+static void test_init(void)
+{
+    model_reset();
+    telemetry_init(TELEMETRY_CORE_CM33);
+    memcpy(model_shared, model_dcache, sizeof(telemetry_block_t));
+    telemetry_init(TELEMETRY_CORE_CM55);
+    test_num_write_backs = 0U;
+    test_torn = 0U;
+    test_accepted = 0U;
+}
+
+/*******************************************************************************
+* Function Name: test_order
+********************************************************************************
+* Summary:
+* Without evictions, telemetry_begin() writes back the counter line alone,
+* and telemetry_end() writes back the whole section before the counter line
+* with the even counter.
+*
+*******************************************************************************/
+static void test_order(void)
+{
+    telemetry_section_t *section;
+
+    test_init();
+    TEST_CHECK(0 == memcmp(model_shared, model_dcache, sizeof(telemetry_block_t)));
+    model_dcache_hook = test_write_back;
+
+    test_num_write_backs = 0U;
+    section = telemetry_begin(TELEMETRY_CORE_CM55);
+    TEST_CHECK(1U == test_num_write_backs);
+    TEST_CHECK(TEST_FIRST_LINE == test_write_backs[0]);
+    TEST_CHECK(1U == test_memory->core[TELEMETRY_CORE_CM55].seq);
+
+    test_fill(section, 1U);
+    test_num_write_backs = 0U;
+    telemetry_end(TELEMETRY_CORE_CM55);
+    TEST_CHECK((TEST_SECTION_LINES + 1U) == test_num_write_backs);
+    for (uint32_t i = 0U; i < TEST_SECTION_LINES; i++)
+    {
+        TEST_CHECK((TEST_FIRST_LINE + i) == test_write_backs[i]);
+    }
+    TEST_CHECK(TEST_FIRST_LINE == test_write_backs[TEST_SECTION_LINES]);
+    TEST_CHECK(2U == test_memory->core[TELEMETRY_CORE_CM55].seq);
+    TEST_CHECK(0 == memcmp(model_shared, model_dcache, sizeof(telemetry_block_t)));
+    TEST_CHECK(0U == test_torn);
+    TEST_CHECK(1U == test_accepted);
+}
+
+/*******************************************************************************
+* Function Name: test_evictions
+********************************************************************************
+* Summary:
+* Updates with random evictions and random completion order of the pending
+* write-backs. No torn section may be visible in memory, and every update
+* must be in memory when telemetry_end() returns.
+*
+*******************************************************************************/
+static void test_evictions(void)
+{
+    telemetry_section_t *section;
+    uint32_t mismatches = 0U;
+
+    test_init();
+    model_seed(TEST_RANDOM_SEED);
+    model_dcache_hook = test_write_back;
+    model_dcache_evict = true;
+
+    for (uint32_t n = 1U; n <= TEST_UPDATES; n++)
+    {
+        section = telemetry_begin(TELEMETRY_CORE_CM55);
+        test_fill(section, n);
+        telemetry_end(TELEMETRY_CORE_CM55);
+
+        if ((0 != memcmp(&test_memory->core[TELEMETRY_CORE_CM55], section,
+                         sizeof(*section))) ||
+            ((2U * n) != test_memory->core[TELEMETRY_CORE_CM55].seq))
+        {
+            mismatches++;
+        }
+    }
+
+    TEST_CHECK(0U == mismatches);
+    TEST_CHECK(0U == test_torn);
+    TEST_CHECK(test_accepted >= TEST_UPDATES);
+    printf("Write-backs: %u, snapshots accepted: %u, torn: %u\n",
+           test_num_write_backs, test_accepted, test_torn);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the telemetry cache tests.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_order();
+    test_evictions();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
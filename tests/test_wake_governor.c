@@ -0,0 +1,595 @@
+/*******************************************************************************
+ * File Name:   test_wake_governor.c
+ *
+ * Description: This file contains the host test of wake_governor.c. The
+ *              budget, back-off and hysteresis rules are checked on the RTC
+ *              and backup register model, including the state retained in
+ *              Hibernate. The test then replays synthetic pathological input
+ *              traces through a model of the main loop, once with and once
+ *              without the governor, and reports the energy saved.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include "wake_governor.h"
+#include "retained_data.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RTC time at the start of every test, 1 January 2026 */
+#define TEST_RTC_START_S                (820454400UL)
+
+/* Comparator of the replay: trip point and hysteresis band */
+#define TEST_TRIP_MV                    (450.0)
+#define TEST_HYST_MV                    (30.0)
+
+/* Correlation time of the input noise */
+#define TEST_NOISE_TAU_MS               (50.0)
+
+/* Power and timing of the device in the replay, in uW, nJ and ms. The
+ * values match the "baseline" parameter set of strategy_traces.c. */
+#define TEST_ACTIVE_UW                  (20000U)
+#define TEST_DEEPSLEEP_UW               (50U)
+#define TEST_HIBERNATE_UW               (3U)
+#define TEST_LED_UW                     (3300U)
+#define TEST_WAKE_NJ                    (2000U)
+#define TEST_TOGGLE_MS                  (500U)
+#define TEST_HOLD_MS                    (2000U)
+#define TEST_BOOT_MS                    (250U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Synthetic input trace: voltage in mV at a time in ms */
+typedef struct
+{
+    const char *name;
+    double (*input_mv)(uint32_t time_ms);
+    uint32_t duration_ms;
+    bool storm;                         /* The trace causes wake storms */
+} test_trace_t;
+
+/* Main loop state in the replay */
+typedef enum
+{
+    SIM_BOOT,
+    SIM_BLINK,
+    SIM_HOLD,
+    SIM_DWELL,
+    SIM_DEEPSLEEP,
+    SIM_HIBERNATE
+} sim_state_t;
+
+/* Result of one replay */
+typedef struct
+{
+    uint64_t energy_nj;
+    uint32_t resets;
+    uint32_t storms;
+    uint32_t absorbed;
+    uint32_t hyst_ms;                   /* Time with the hysteresis enabled */
+    uint8_t backoff;                    /* Back-off level at the end */
+    uint32_t hyst;                      /* Hysteresis setting at the end */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static double test_noise_mv;
+
+/*******************************************************************************
+* Function Name: test_power_on / test_advance_s / test_wakes
+********************************************************************************
+* Summary:
+* Helpers for the rule tests: a power-on reset with erased backup registers,
+* advancing the RTC, and a number of wakeups one second apart.
+*
+*******************************************************************************/
+static void test_power_on(void)
+{
+    model_reset();
+    model_rtc_base_s = TEST_RTC_START_S;
+    wake_governor_init();
+}
+
+static void test_advance_s(uint32_t seconds)
+{
+    model_time_us += (uint64_t)seconds * 1000000U;
+}
+
+static void test_wakes(uint32_t count, bool absorbed)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        test_advance_s(1U);
+        wake_governor_record_wake(absorbed);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_budget
+********************************************************************************
+* Summary:
+* Wakeups within the budget leave the governor idle. The first wakeup over
+* the budget is a storm: DeepSleep, a dwell and hysteresis. Further storms
+* raise the back-off level up to the maximum.
+*
+*******************************************************************************/
+static void test_budget(void)
+{
+    const wake_governor_state_t *state = wake_governor_get_state();
+
+    test_power_on();
+    TEST_CHECK(0U == state->backoff);
+    TEST_CHECK(WAKE_STRATEGY_HIBERNATE == wake_governor_get_strategy());
+    TEST_CHECK(0U == wake_governor_get_dwell_ms());
+    TEST_CHECK(CY_LPCOMP_HYST_DISABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+    TEST_CHECK(CY_LPCOMP_HYST_ENABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_ENABLE));
+
+    test_wakes(WAKE_GOVERNOR_BUDGET, false);
+    TEST_CHECK(0U == state->storms);
+    TEST_CHECK(WAKE_STRATEGY_HIBERNATE == wake_governor_get_strategy());
+
+    test_wakes(1U, false);
+    TEST_CHECK(1U == state->storms);
+    TEST_CHECK(1U == state->backoff);
+    TEST_CHECK(WAKE_STRATEGY_DEEPSLEEP == wake_governor_get_strategy());
+    TEST_CHECK(WAKE_GOVERNOR_DWELL_BASE_MS == wake_governor_get_dwell_ms());
+    TEST_CHECK(CY_LPCOMP_HYST_ENABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+
+    /* More wakeups in the same window are not a new storm */
+    test_wakes(10U, true);
+    TEST_CHECK(1U == state->storms);
+    TEST_CHECK(10U == state->absorbed);
+
+    /* A storm in each of the next windows, up to the maximum level */
+    for (uint32_t i = 0U; i < (WAKE_GOVERNOR_MAX_BACKOFF + 2U); i++)
+    {
+        test_advance_s(WAKE_GOVERNOR_WINDOW_S);
+        test_wakes(WAKE_GOVERNOR_BUDGET + 1U, true);
+    }
+    TEST_CHECK(WAKE_GOVERNOR_MAX_BACKOFF == state->backoff);
+    TEST_CHECK((WAKE_GOVERNOR_MAX_BACKOFF + 3U) == state->storms);
+    TEST_CHECK((WAKE_GOVERNOR_DWELL_BASE_MS *
+                ((1UL << WAKE_GOVERNOR_MAX_BACKOFF) - 1UL)) ==
+               wake_governor_get_dwell_ms());
+}
+
+/*******************************************************************************
+* Function Name: test_decay
+********************************************************************************
+* Summary:
+* The back-off level survives Hibernate in the backup registers, and decays
+* by one for each quiet window. The hysteresis stays enabled while backing
+* off and returns to the calibrated setting once the level reaches zero.
+*
+*******************************************************************************/
+static void test_decay(void)
+{
+    const wake_governor_state_t *state = wake_governor_get_state();
+
+    test_power_on();
+    for (uint32_t i = 0U; i < WAKE_GOVERNOR_MAX_BACKOFF; i++)
+    {
+        test_advance_s(WAKE_GOVERNOR_WINDOW_S);
+        test_wakes(WAKE_GOVERNOR_BUDGET + 1U, false);
+    }
+    TEST_CHECK(WAKE_GOVERNOR_MAX_BACKOFF == state->backoff);
+
+    /* Hibernate: only the backup registers and the RTC are kept */
+    test_advance_s(5U);
+    wake_governor_init();
+    TEST_CHECK(WAKE_GOVERNOR_MAX_BACKOFF == state->backoff);
+    TEST_CHECK(CY_LPCOMP_HYST_ENABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+
+    /* Three windows later: the storm window does not count as quiet */
+    test_advance_s(3U * WAKE_GOVERNOR_WINDOW_S);
+    test_wakes(1U, false);
+    TEST_CHECK(1U == state->backoff);
+    TEST_CHECK(CY_LPCOMP_HYST_ENABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+
+    test_advance_s(WAKE_GOVERNOR_WINDOW_S);
+    wake_governor_init();
+    test_wakes(1U, false);
+    TEST_CHECK(0U == state->backoff);
+    TEST_CHECK(WAKE_STRATEGY_HIBERNATE == wake_governor_get_strategy());
+    TEST_CHECK(0U == wake_governor_get_dwell_ms());
+    TEST_CHECK(CY_LPCOMP_HYST_DISABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+    TEST_CHECK(CY_LPCOMP_HYST_ENABLE ==
+               wake_governor_get_hysteresis(CY_LPCOMP_HYST_ENABLE));
+
+    /* The RTC moving backwards starts a new window, which is not quiet
+     * after a storm */
+    test_wakes(WAKE_GOVERNOR_BUDGET + 1U, false);
+    TEST_CHECK(1U == state->backoff);
+    model_rtc_base_s -= 3600U;
+    test_wakes(1U, false);
+    TEST_CHECK(1U == state->backoff);
+    TEST_CHECK(1U == state->window_wakes);
+}
+
+/*******************************************************************************
+* Function Name: test_restore
+********************************************************************************
+* Summary:
+* A state that is not valid in the backup registers is reset, while a valid
+* one, including the counters, is kept.
+*
+*******************************************************************************/
+static void test_restore(void)
+{
+    const wake_governor_state_t *state = wake_governor_get_state();
+    uint32_t words[RETAINED_GOVERNOR_NUM_WORDS];
+
+    test_power_on();
+    test_wakes(WAKE_GOVERNOR_BUDGET + 3U, true);
+    TEST_CHECK(1U == state->storms);
+
+    wake_governor_init();
+    TEST_CHECK(1U == state->storms);
+    TEST_CHECK((WAKE_GOVERNOR_BUDGET + 3U) == state->absorbed);
+
+    /* Back-off level out of range */
+    Cy_SysPm_BackupWordReStore(RETAINED_GOVERNOR_WORD, words,
+                               RETAINED_GOVERNOR_NUM_WORDS);
+    ((wake_governor_state_t *)words)->backoff = WAKE_GOVERNOR_MAX_BACKOFF + 1U;
+    Cy_SysPm_BackupWordStore(RETAINED_GOVERNOR_WORD, words,
+                             RETAINED_GOVERNOR_NUM_WORDS);
+    wake_governor_init();
+    TEST_CHECK(0U == state->storms);
+    TEST_CHECK(0U == state->backoff);
+
+    /* Bad magic */
+    test_wakes(WAKE_GOVERNOR_BUDGET + 1U, false);
+    Cy_SysPm_BackupWordReStore(RETAINED_GOVERNOR_WORD, words,
+                               RETAINED_GOVERNOR_NUM_WORDS);
+    ((wake_governor_state_t *)words)->magic ^= 1U;
+    Cy_SysPm_BackupWordStore(RETAINED_GOVERNOR_WORD, words,
+                             RETAINED_GOVERNOR_NUM_WORDS);
+    wake_governor_init();
+    TEST_CHECK(0U == state->storms);
+}
+
+/*******************************************************************************
+* Function Name: trace_*
+********************************************************************************
+* Summary:
+* Synthetic inputs. Each is called once per millisecond and adds noise with
+* a correlation time of TEST_NOISE_TAU_MS.
+*
+*  sparse:  a few long HIGH periods well within the budget
+*  hover:   the input resting just above the trip point, so that the
+*           comparator output chatters
+*  sine:    a slow oscillation around the trip point, larger than the
+*           hysteresis band
+*  pulses:  short pulses every 4 s for five minutes, then quiet, then one
+*           long HIGH period
+*
+*******************************************************************************/
+static double trace_noise(double sigma_mv)
+{
+    const double a = exp(-1.0 / TEST_NOISE_TAU_MS);
+
+    test_noise_mv = (a * test_noise_mv) + (sqrt(1.0 - (a * a)) * model_gauss());
+
+    return sigma_mv * test_noise_mv;
+}
+
+static double trace_sparse(uint32_t time_ms)
+{
+    uint32_t phase_ms = time_ms % 120000U;
+    double level = ((phase_ms >= 30000U) && (phase_ms < 36000U)) ? 600.0 : 300.0;
+
+    return level + trace_noise(2.0);
+}
+
+static double trace_hover(uint32_t time_ms)
+{
+    (void)time_ms;
+
+    return TEST_TRIP_MV + 2.0 + trace_noise(4.0);
+}
+
+static double trace_sine(uint32_t time_ms)
+{
+    return TEST_TRIP_MV + (25.0 * sin(2.0 * M_PI * (double)time_ms / 12000.0)) +
+           trace_noise(2.0);
+}
+
+static double trace_pulses(uint32_t time_ms)
+{
+    double level = 300.0;
+
+    if ((time_ms < 300000U) && ((time_ms % 4000U) < 100U))
+    {
+        level = 600.0;
+    }
+    else if ((time_ms >= 540000U) && (time_ms < 545000U))
+    {
+        level = 600.0;
+    }
+
+    return level + trace_noise(2.0);
+}
+
+static const test_trace_t test_traces[] =
+{
+    { "sparse", trace_sparse, 600000U, false },
+    { "hover",  trace_hover,  600000U, true  },
+    { "sine",   trace_sine,   600000U, true  },
+    { "pulses", trace_pulses, 600000U, true  }
+};
+
+/*******************************************************************************
+* Function Name: sim_compare
+********************************************************************************
+* Summary:
+* Comparator of the replay. With hysteresis the output switches HIGH above
+* the trip point plus half the band and LOW below it minus half the band.
+*
+*******************************************************************************/
+static uint32_t sim_compare(double input_mv, uint32_t output)
+{
+    double half_mv = (CY_LPCOMP_HYST_ENABLE == model_lpcomp_hyst) ?
+                     (TEST_HYST_MV / 2.0) : 0.0;
+
+    if (input_mv > (TEST_TRIP_MV + half_mv))
+    {
+        return 1U;
+    }
+    if (input_mv < (TEST_TRIP_MV - half_mv))
+    {
+        return 0U;
+    }
+
+    return output;
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Replays a trace through a model of the main loop of the CM33 non-secure
+* application from power-on, in steps of 1 ms. With the governor, the model
+* calls wake_governor.c where main.c does: after each boot from Hibernate,
+* before the low-power entry for the hysteresis and the dwell, and after a
+* DeepSleep wakeup. Without it, the device always hibernates.
+*
+*******************************************************************************/
+static void sim_run(const test_trace_t *trace, bool governed,
+                    sim_result_t *result)
+{
+    sim_state_t state = SIM_BOOT;
+    uint32_t state_start_ms = 0U;
+    uint32_t dwell_ms = 0U;
+    uint32_t output = 0U;
+    bool hib_wakeup = false;
+
+    test_power_on();
+    model_seed(0x5EED0028U);
+    test_noise_mv = 0.0;
+    memset(result, 0, sizeof(*result));
+
+    for (uint32_t now_ms = 0U; now_ms < trace->duration_ms; now_ms++)
+    {
+        uint32_t elapsed_ms = now_ms - state_start_ms;
+
+        model_time_us = (uint64_t)now_ms * 1000U;
+        output = sim_compare(trace->input_mv(now_ms), output);
+        if (CY_LPCOMP_HYST_ENABLE == model_lpcomp_hyst)
+        {
+            result->hyst_ms++;
+        }
+
+        /* uW * 1 ms = nJ */
+        switch (state)
+        {
+            case SIM_BOOT:
+                result->energy_nj += TEST_ACTIVE_UW;
+                if (elapsed_ms >= TEST_BOOT_MS)
+                {
+                    /* Cy_LPComp_Init() restores the design configuration */
+                    Cy_LPComp_SetHysteresis(NULL, CY_LPCOMP_CHANNEL_0,
+                                            CY_LPCOMP_HYST_DISABLE);
+                    if (governed)
+                    {
+                        wake_governor_init();
+                        if (hib_wakeup)
+                        {
+                            wake_governor_record_wake(false);
+                        }
+                    }
+                    state = (0U != output) ? SIM_BLINK : SIM_HOLD;
+                    state_start_ms = now_ms;
+                }
+                break;
+
+            case SIM_BLINK:
+                result->energy_nj += TEST_DEEPSLEEP_UW + (TEST_LED_UW / 2U);
+                if ((0U != elapsed_ms) && (0U == (elapsed_ms % TEST_TOGGLE_MS)))
+                {
+                    result->energy_nj += TEST_WAKE_NJ;
+                    if (0U == output)
+                    {
+                        state = SIM_HOLD;
+                        state_start_ms = now_ms;
+                    }
+                }
+                break;
+
+            case SIM_HOLD:
+                result->energy_nj += TEST_DEEPSLEEP_UW + TEST_LED_UW;
+                if (elapsed_ms >= TEST_HOLD_MS)
+                {
+                    dwell_ms = 0U;
+                    if (governed)
+                    {
+                        Cy_LPComp_SetHysteresis(NULL, CY_LPCOMP_CHANNEL_0,
+                            wake_governor_get_hysteresis(CY_LPCOMP_HYST_DISABLE));
+                        dwell_ms = wake_governor_get_dwell_ms();
+                    }
+                    state = SIM_DWELL;
+                    state_start_ms = now_ms;
+                }
+                break;
+
+            case SIM_DWELL:
+                result->energy_nj += TEST_DEEPSLEEP_UW;
+                if (elapsed_ms >= dwell_ms)
+                {
+                    state = (governed && (WAKE_STRATEGY_DEEPSLEEP ==
+                                          wake_governor_get_strategy())) ?
+                            SIM_DEEPSLEEP : SIM_HIBERNATE;
+                    state_start_ms = now_ms;
+                }
+                break;
+
+            case SIM_DEEPSLEEP:
+                result->energy_nj += TEST_DEEPSLEEP_UW;
+                if (0U != output)
+                {
+                    result->energy_nj += TEST_WAKE_NJ;
+                    wake_governor_record_wake(true);
+                    state = SIM_BLINK;
+                    state_start_ms = now_ms;
+                }
+                break;
+
+            case SIM_HIBERNATE:
+            default:
+                /* The wakeup is level sensitive */
+                result->energy_nj += TEST_HIBERNATE_UW;
+                if (0U != output)
+                {
+                    result->resets++;
+                    hib_wakeup = true;
+                    state = SIM_BOOT;
+                    state_start_ms = now_ms;
+                }
+                break;
+        }
+    }
+
+    result->storms = wake_governor_get_state()->storms;
+    result->absorbed = wake_governor_get_state()->absorbed;
+    result->backoff = wake_governor_get_state()->backoff;
+    result->hyst = model_lpcomp_hyst;
+}
+
+/*******************************************************************************
+* Function Name: test_replay
+********************************************************************************
+* Summary:
+* Replays every trace with and without the governor, checks that the
+* governor saves energy on the storm traces and changes nothing on the
+* sparse one, and prints the energy saved.
+*
+*******************************************************************************/
+static void test_replay(void)
+{
+    sim_result_t plain;
+    sim_result_t governed;
+
+    printf("\nWake storm replay, %u s window, budget %u\n",
+           (unsigned int)WAKE_GOVERNOR_WINDOW_S, (unsigned int)WAKE_GOVERNOR_BUDGET);
+    printf("%-8s %-10s %-10s %-7s %-7s %-7s %-7s %-9s %-7s\n", "trace",
+           "plain_mJ", "gov_mJ", "saved%", "resets", "g_rst", "storms",
+           "absorbed", "hyst_s");
+
+    for (uint32_t i = 0U; i < CY_ARRAY_SIZE(test_traces); i++)
+    {
+        const test_trace_t *trace = &test_traces[i];
+        double saved;
+
+        sim_run(trace, false, &plain);
+        sim_run(trace, true, &governed);
+
+        saved = 100.0 * (1.0 - ((double)governed.energy_nj /
+                                (double)plain.energy_nj));
+        printf("%-8s %-10.1f %-10.1f %-7.1f %-7u %-7u %-7u %-9u %-7.1f\n",
+               trace->name, (double)plain.energy_nj / 1e6,
+               (double)governed.energy_nj / 1e6, saved,
+               (unsigned int)plain.resets, (unsigned int)governed.resets,
+               (unsigned int)governed.storms, (unsigned int)governed.absorbed,
+               (double)governed.hyst_ms / 1000.0);
+
+        if (trace->storm)
+        {
+            TEST_CHECK(governed.storms > 0U);
+            TEST_CHECK(governed.resets < plain.resets);
+            TEST_CHECK_RANGE(saved, 20.0, 100.0);
+        }
+        else
+        {
+            TEST_CHECK(0U == governed.storms);
+            TEST_CHECK(governed.resets == plain.resets);
+            TEST_CHECK(governed.energy_nj == plain.energy_nj);
+            TEST_CHECK(0U == governed.hyst_ms);
+        }
+    }
+
+    /* After the pulse train the back-off decays during the quiet period and
+     * the long HIGH period; the hysteresis is disabled again */
+    sim_run(&test_traces[3], true, &governed);
+    TEST_CHECK(0U == governed.backoff);
+    TEST_CHECK(CY_LPCOMP_HYST_DISABLE == governed.hyst);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the wake governor tests and the trace replay.
+*
+*******************************************************************************/
+int main(void)
+{
+    test_budget();
+    test_decay();
+    test_restore();
+    test_replay();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
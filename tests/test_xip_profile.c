@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * File Name:   test_xip_profile.c
+ *
+ * Description: This file contains the host test of xip_profile.c. The profile
+ *              table and the validation rules are checked against a model of
+ *              the generated QSPI memory configuration, and the profile
+ *              selected with XIP_PROFILE is applied to it. The Makefile
+ *              builds the test once for each profile.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+* (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is owned by
+* Infineon Technologies AG or one of its affiliates ("Infineon") and is protected
+* by and subject to worldwide patent protection, worldwide copyright laws, and
+* international treaty provisions. Therefore, you may use this Software only as
+* provided in the license agreement accompanying the software package from which
+* you obtained this Software. If no license agreement applies, then any use,
+* reproduction, modification, translation, or compilation of this Software is
+* prohibited without the express written permission of Infineon.
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING,
+* BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF THIRD-PARTY RIGHTS AND
+* IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A SPECIFIC USE/PURPOSE OR
+* MERCHANTABILITY. Infineon reserves the right to make changes to the Software
+* without notice. You are responsible for properly designing, programming, and
+* testing the functionality and safety of your intended application of the
+* Software, as well as complying with any legal requirements related to its
+* use. Infineon does not guarantee that the Software will be free from intrusion,
+* data theft or loss, or other breaches ("Security Breaches"), and Infineon
+* shall have no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any application
+* where a failure of the Product or any consequences of the use thereof can
+* reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "test.h"
+#include "xip_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Read command of the generated configuration: Quad I/O fast read */
+#define TEST_READ_CMD                   (0xEBU)
+#define TEST_READ_DUMMY_CYCLES          (8U)
+
+/* Number of built-in profiles */
+#define TEST_NUM_PROFILES               (XIP_PROFILE_LOW_POWER + 1U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Model of the configuration generated by the QSPI Configurator. Merging is
+ * enabled so that the low power profile has something to turn off. */
+static cy_stc_smif_mem_cmd_t gen_read_cmd =
+{
+    .command        = TEST_READ_CMD,
+    .dummyCycles    = TEST_READ_DUMMY_CYCLES
+};
+
+static cy_stc_smif_mem_device_cfg_t gen_device_cfg =
+{
+    .numOfAddrBytes = 3U,
+    .memSize        = 0x4000000U,
+    .readCmd        = &gen_read_cmd
+};
+
+static cy_stc_smif_mem_config_t gen_mem_cfg =
+{
+    .baseAddress    = 0x60000000U,
+    .memMappedSize  = 0x4000000U,
+    .flags          = CY_SMIF_FLAG_WR_EN | CY_SMIF_FLAG_MERGE_ENABLE,
+    .deviceCfg      = &gen_device_cfg,
+    .mergeTimeout   = CY_SMIF_MERGE_TIMEOUT_16_CYCLES
+};
+
+static cy_stc_smif_mem_config_t *gen_mem_cfg_list[2] =
+{
+    &gen_mem_cfg,
+    &gen_mem_cfg
+};
+
+static cy_stc_smif_block_config_t gen_block_cfg =
+{
+    .memCount       = 1U,
+    .memConfig      = gen_mem_cfg_list,
+    .majorVersion   = 2U,
+    .minorVersion   = 1U
+};
+
+/*******************************************************************************
+* Function Name: test_table
+********************************************************************************
+* Summary:
+* Checks that every built-in profile is valid for the generated configuration
+* and does what its description says.
+*
+*******************************************************************************/
+static void test_table(void)
+{
+    const xip_profile_t *profile;
+
+    for (uint32_t id = 0U; id < TEST_NUM_PROFILES; id++)
+    {
+        profile = xip_profile_get(id);
+        TEST_CHECK(NULL != profile);
+        if (NULL == profile)
+        {
+            continue;
+        }
+
+        TEST_CHECK(XIP_PROFILE_OK == xip_profile_validate(profile, &gen_mem_cfg));
+        TEST_CHECK(XIP_PROFILE_KEEP_DUMMY_CYCLES == profile->read_dummy_cycles);
+    }
+
+    TEST_CHECK(NULL == xip_profile_get(TEST_NUM_PROFILES));
+    TEST_CHECK(NULL == xip_profile_get(UINT32_MAX));
+
+    TEST_CHECK(xip_profile_get(XIP_PROFILE_PERFORMANCE)->merge_enable);
+    TEST_CHECK(CY_SMIF_MERGE_TIMEOUT_1_CYCLE <
+               xip_profile_get(XIP_PROFILE_PERFORMANCE)->merge_timeout);
+    TEST_CHECK(!xip_profile_get(XIP_PROFILE_LOW_POWER)->merge_enable);
+}
+
+/*******************************************************************************
+* Function Name: test_validate
+********************************************************************************
+* Summary:
+* Checks the validation rules with custom profiles.
+*
+*******************************************************************************/
+static void test_validate(void)
+{
+    xip_profile_t profile =
+    {
+        .merge_enable       = true,
+        .merge_timeout      = CY_SMIF_MERGE_TIMEOUT_65536_CYCLE,
+        .read_dummy_cycles  = XIP_PROFILE_KEEP_DUMMY_CYCLES
+    };
+
+    TEST_CHECK(XIP_PROFILE_OK == xip_profile_validate(&profile, &gen_mem_cfg));
+
+    /* Merge timeout out of range, ignored if merging is off */
+    profile.merge_timeout = (cy_en_smif_merge_timeout_t)(CY_SMIF_MERGE_TIMEOUT_65536_CYCLE + 1U);
+    TEST_CHECK(XIP_PROFILE_ERR_MERGE_TIMEOUT == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.merge_enable = false;
+    TEST_CHECK(XIP_PROFILE_OK == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.merge_timeout = CY_SMIF_MERGE_TIMEOUT_1_CYCLE;
+
+    /* Dummy cycles: the device minimum up to the SMIF limit */
+    profile.read_dummy_cycles = TEST_READ_DUMMY_CYCLES;
+    TEST_CHECK(XIP_PROFILE_OK == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.read_dummy_cycles = TEST_READ_DUMMY_CYCLES - 1U;
+    TEST_CHECK(XIP_PROFILE_ERR_DUMMY_CYCLES == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.read_dummy_cycles = 0U;
+    TEST_CHECK(XIP_PROFILE_ERR_DUMMY_CYCLES == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.read_dummy_cycles = XIP_PROFILE_MAX_DUMMY_CYCLES;
+    TEST_CHECK(XIP_PROFILE_OK == xip_profile_validate(&profile, &gen_mem_cfg));
+    profile.read_dummy_cycles = XIP_PROFILE_MAX_DUMMY_CYCLES + 1U;
+    TEST_CHECK(XIP_PROFILE_ERR_DUMMY_CYCLES == xip_profile_validate(&profile, &gen_mem_cfg));
+}
+
+/*******************************************************************************
+* Function Name: test_apply
+********************************************************************************
+* Summary:
+* Applies the profile selected by XIP_PROFILE and checks the result. The
+* generated configuration must not change.
+*
+*******************************************************************************/
+static void test_apply(void)
+{
+    const xip_profile_t *profile = xip_profile_get(XIP_PROFILE);
+    cy_stc_smif_mem_cmd_t read_cmd = gen_read_cmd;
+    cy_stc_smif_mem_device_cfg_t device_cfg = gen_device_cfg;
+    cy_stc_smif_mem_config_t mem_cfg = gen_mem_cfg;
+    cy_stc_smif_block_config_t block_cfg = gen_block_cfg;
+    const cy_stc_smif_block_config_t *block;
+    const cy_stc_smif_mem_config_t *mem;
+
+    printf("XIP_PROFILE %u\n", (unsigned int)XIP_PROFILE);
+
+    block = xip_profile_apply(&gen_block_cfg);
+
+    TEST_CHECK(0 == memcmp(&read_cmd, &gen_read_cmd, sizeof(read_cmd)));
+    TEST_CHECK(0 == memcmp(&device_cfg, &gen_device_cfg, sizeof(device_cfg)));
+    TEST_CHECK(0 == memcmp(&mem_cfg, &gen_mem_cfg, sizeof(mem_cfg)));
+    TEST_CHECK(0 == memcmp(&block_cfg, &gen_block_cfg, sizeof(block_cfg)));
+
+    if (XIP_PROFILE_DEFAULT == XIP_PROFILE)
+    {
+        TEST_CHECK(&gen_block_cfg == block);
+        return;
+    }
+
+    TEST_CHECK(&gen_block_cfg != block);
+    TEST_CHECK(1U == block->memCount);
+    TEST_CHECK(gen_block_cfg.majorVersion == block->majorVersion);
+    TEST_CHECK(gen_block_cfg.minorVersion == block->minorVersion);
+
+    mem = block->memConfig[0];
+    TEST_CHECK(&gen_mem_cfg != mem);
+    TEST_CHECK(gen_mem_cfg.baseAddress == mem->baseAddress);
+    TEST_CHECK(gen_mem_cfg.memMappedSize == mem->memMappedSize);
+    TEST_CHECK(0U != (mem->flags & CY_SMIF_FLAG_WR_EN));
+    TEST_CHECK(profile->merge_enable == (0U != (mem->flags & CY_SMIF_FLAG_MERGE_ENABLE)));
+    TEST_CHECK(profile->merge_timeout == mem->mergeTimeout);
+    TEST_CHECK(gen_device_cfg.memSize == mem->deviceCfg->memSize);
+    TEST_CHECK(TEST_READ_CMD == mem->deviceCfg->readCmd->command);
+    TEST_CHECK(TEST_READ_DUMMY_CYCLES == mem->deviceCfg->readCmd->dummyCycles);
+
+    /* Profiles are only applied to a single memory */
+    gen_block_cfg.memCount = 2U;
+    TEST_CHECK(&gen_block_cfg == xip_profile_apply(&gen_block_cfg));
+    gen_block_cfg.memCount = 1U;
+}
+
+int main(void)
+{
+    test_table();
+    test_validate();
+    test_apply();
+
+    return TEST_RESULT();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+################################################################################
+# \file test_xip_report.py
+# \version 1.0
+#
+# \brief
+# Host test of scripts/xip_report.py. The sample logs below have the format
+# printed by xip_benchmark.c, including the carriage returns, a boot banner
+# and two boots in one log. The cycle counts are made up for the test and
+# are not measurements.
+#
+################################################################################
+# \copyright
+# (c) 2025, Infineon Technologies AG, or an affiliate of Infineon Technologies AG.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import contextlib
+import io
+import os
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "scripts"))
+import xip_report  # noqa: E402
+
+LOG_DEFAULT = (
+    "\x1b[2J\x1b[;H****************** PSOC Edge MCU: LPCOMP hibernate wakeup ******************\r\n"
+    "XIP_BENCH core clock 200000000 Hz, 8 runs\r\n"
+    "XIP_BENCH seq_read   min 400000 avg 410000 max 430000 cycles, 31226 KB/s\r\n"
+    "XIP_BENCH rand_read  min 900000 avg 920000 max 950000 cycles, 3396 KB/s\r\n"
+    "XIP_BENCH code_exec  min 120000 avg 121000 max 123000 cycles, 0 KB/s\r\n"
+    "\r\n"
+    "XIP_BENCH core clock 200000000 Hz, 8 runs\r\n"
+    "XIP_BENCH seq_read   min 395000 avg 400000 max 420000 cycles, 32827 KB/s\r\n"
+    "XIP_BENCH rand_read  min 910000 avg 930000 max 960000 cycles, 3359 KB/s\r\n"
+    "XIP_BENCH code_exec  min 119000 avg 121000 max 125000 cycles, 0 KB/s\r\n"
+)
+
+LOG_PERFORMANCE = (
+    "XIP_BENCH core clock 200000000 Hz, 8 runs\r\n"
+    "XIP_BENCH seq_read   min 300000 avg 300000 max 310000 cycles, 42666 KB/s\r\n"
+    "XIP_BENCH rand_read  min 900000 avg 925000 max 990000 cycles, 3378 KB/s\r\n"
+    "XIP_BENCH code_exec  min 100000 avg 110000 max 180000 cycles, 0 KB/s\r\n"
+)
+
+
+class ParseTest(unittest.TestCase):
+
+    def test_combines_boots(self):
+        clock, results = xip_report.parse_log(LOG_DEFAULT.splitlines())
+        self.assertEqual(clock, 200000000)
+        self.assertEqual(list(results), ["seq_read", "rand_read", "code_exec"])
+        seq = results["seq_read"]
+        self.assertEqual(seq.runs, 16)
+        self.assertEqual(seq.min, 395000)
+        self.assertEqual(seq.max, 430000)
+        self.assertAlmostEqual(seq.avg, 405000.0)
+        self.assertAlmostEqual(seq.spread, 100.0 * 35000 / 405000)
+        self.assertAlmostEqual(results["code_exec"].avg_kbps, 0.0)
+
+    def test_errors(self):
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.parse_log(["boot\r\n", "no results\r\n"])
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.parse_log(LOG_DEFAULT.replace("avg 400000", "avg 390000").splitlines())
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.parse_log(LOG_PERFORMANCE.splitlines()[1:])
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.parse_log((LOG_PERFORMANCE + LOG_PERFORMANCE.replace(
+                "200000000", "100000000")).splitlines())
+
+
+class CompareTest(unittest.TestCase):
+
+    def setUp(self):
+        self.default = xip_report.parse_log(LOG_DEFAULT.splitlines())
+        self.performance = xip_report.parse_log(LOG_PERFORMANCE.splitlines())
+
+    def test_change(self):
+        rows = xip_report.compare([("default", self.default), ("performance", self.performance)])
+        self.assertEqual([(t, l) for t, l, _, _ in rows],
+                         [("seq_read", "default"), ("seq_read", "performance"),
+                          ("rand_read", "default"), ("rand_read", "performance"),
+                          ("code_exec", "default"), ("code_exec", "performance")])
+        changes = dict(((t, l), c) for t, l, _, c in rows)
+        self.assertAlmostEqual(changes[("seq_read", "default")], 0.0)
+        self.assertAlmostEqual(changes[("seq_read", "performance")], 100.0 * (300000 - 405000) / 405000)
+        self.assertAlmostEqual(changes[("code_exec", "performance")], 100.0 * (110000 - 121000) / 121000)
+
+    def test_mismatch(self):
+        slow = xip_report.parse_log(LOG_PERFORMANCE.replace("200000000", "100000000").splitlines())
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.compare([("default", self.default), ("slow", slow)])
+        missing = xip_report.parse_log(LOG_PERFORMANCE.splitlines()[:2])
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.compare([("default", self.default), ("missing", missing)])
+
+
+class MainTest(unittest.TestCase):
+
+    def run_main(self, args, logs):
+        with tempfile.TemporaryDirectory() as tmp:
+            paths = []
+            for label, text in logs:
+                path = os.path.join(tmp, label + ".log")
+                with open(path, "w", encoding="utf-8", newline="") as f:
+                    f.write(text)
+                paths.append("%s=%s" % (label, path))
+            out = io.StringIO()
+            with contextlib.redirect_stdout(out):
+                status = xip_report.main(args + paths)
+            return status, out.getvalue().splitlines()
+
+    def test_table(self):
+        logs = [("default", LOG_DEFAULT), ("performance", LOG_PERFORMANCE)]
+        status, lines = self.run_main([], logs)
+        self.assertEqual(status, 0)
+        self.assertEqual(len(lines), 7)
+        self.assertTrue(lines[2].startswith("seq_read   performance"))
+        self.assertIn("-25.9%", lines[2])
+
+        # code_exec of the performance log spreads by 64 %
+        status, lines = self.run_main(["--max-spread", "50"], logs)
+        self.assertEqual(status, 1)
+        self.assertEqual([l.split()[0] for l in lines if l.endswith(" noisy")], ["code_exec"])
+
+    def test_csv(self):
+        status, lines = self.run_main(["--csv"], [("performance", LOG_PERFORMANCE)])
+        self.assertEqual(status, 0)
+        self.assertEqual(lines[0], "test,profile,runs,min,avg,max,kbps,change_pct,spread_pct")
+        self.assertEqual(lines[1], "seq_read,performance,8,300000,300000,310000,42666,0.0,3.3")
+
+    def test_bad_argument(self):
+        with self.assertRaises(xip_report.ReportError):
+            xip_report.main(["default"])
+
+
+if __name__ == "__main__":
+    unittest.main()